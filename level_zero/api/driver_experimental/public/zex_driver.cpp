@@ -34,6 +34,17 @@ zexDriverGetHostPointerBaseAddress(
     return L0::DriverHandle::fromHandle(hDriver)->getHostPointerBaseAddress(ptr, baseAddress);
 }
 
+ze_result_t ZE_APICALL
+zexDriverHostSynchronizeEvents(
+    ze_driver_handle_t hDriver,
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    ze_bool_t waitAll,
+    uint64_t timeout,
+    uint32_t *pSignaledEventIndex) {
+    return L0::DriverHandle::fromHandle(hDriver)->hostSynchronizeEvents(numEvents, phEvents, waitAll, timeout, pSignaledEventIndex);
+}
+
 } // namespace L0
 
 extern "C" {
@@ -60,4 +71,15 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress) {
     return L0::zexDriverGetHostPointerBaseAddress(hDriver, ptr, baseAddress);
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexDriverHostSynchronizeEvents(
+    ze_driver_handle_t hDriver,
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    ze_bool_t waitAll,
+    uint64_t timeout,
+    uint32_t *pSignaledEventIndex) {
+    return L0::zexDriverHostSynchronizeEvents(hDriver, numEvents, phEvents, waitAll, timeout, pSignaledEventIndex);
+}
 }
\ No newline at end of file
@@ -35,6 +35,16 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress          ///< [out] if not null, returns address of the base pointer of the imported pointer
 );
 
+ze_result_t ZE_APICALL
+zexDriverHostSynchronizeEvents(
+    ze_driver_handle_t hDriver,   ///< [in] handle of the driver
+    uint32_t numEvents,           ///< [in] number of events to wait for
+    ze_event_handle_t *phEvents,  ///< [in][range(0, numEvents)] handles of the events
+    ze_bool_t waitAll,            ///< [in] if true, wait until all events are signaled, otherwise until any event is signaled
+    uint64_t timeout,             ///< [in] timeout in nanoseconds, UINT64_MAX waits indefinitely
+    uint32_t *pSignaledEventIndex ///< [out][optional] index of the signaled event when waitAll is false
+);
+
 } // namespace L0
 
 #endif // _ZEX_DRIVER_H
@@ -26,6 +26,12 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
 
     ret.cacheFileExtension = ".l0_cache";
 
+    std::string maxSizeKeyName = L0::registryPath;
+    maxSizeKeyName += "l0_cache_max_size";
+    std::unique_ptr<NEO::SettingsReader> maxSizeSettingsReader(NEO::SettingsReader::createOsReader(false, maxSizeKeyName));
+    auto cacheSize = maxSizeSettingsReader->getSetting(maxSizeSettingsReader->appSpecificLocation(maxSizeKeyName), static_cast<int64_t>(0));
+    ret.cacheSize = cacheSize > 0 ? static_cast<size_t>(cacheSize) : 0u;
+
     return ret;
 }
 
@@ -8,6 +8,7 @@
 #include "level_zero/core/source/context/context_imp.h"
 
 #include "shared/source/command_container/implicit_scaling.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
@@ -50,6 +51,10 @@ ContextImp::ContextImp(DriverHandle *driverHandle) {
     this->driverHandle = static_cast<DriverHandleImp *>(driverHandle);
 }
 
+ContextImp::~ContextImp() {
+    usmPoolAllocator.releasePools();
+}
+
 ze_result_t ContextImp::allocHostMem(const ze_host_mem_alloc_desc_t *hostDesc,
                                      size_t size,
                                      size_t alignment,
@@ -85,12 +90,17 @@ ze_result_t ContextImp::allocHostMem(const ze_host_mem_alloc_desc_t *hostDesc,
         unifiedMemoryProperties.allocationFlags.flags.locallyUncachedResource = 1;
     }
 
+    void *usmPtr = nullptr;
     if (hostDesc->flags & ZEX_HOST_MEM_ALLOC_FLAG_USE_HOST_PTR) {
         unifiedMemoryProperties.allocationFlags.hostptr = reinterpret_cast<uintptr_t>(*ptr);
+    } else if (hostDesc->pNext == nullptr) {
+        usmPtr = usmPoolAllocator.allocate(size, alignment, unifiedMemoryProperties, nullptr);
     }
 
-    auto usmPtr = this->driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(size,
-                                                                                          unifiedMemoryProperties);
+    if (usmPtr == nullptr) {
+        usmPtr = this->driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(size,
+                                                                                         unifiedMemoryProperties);
+    }
     if (usmPtr == nullptr) {
         return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -181,8 +191,13 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
         unifiedMemoryProperties.allocationFlags.flags.resource48Bit = 1;
     }
 
-    void *usmPtr =
-        this->driverHandle->svmAllocsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    void *usmPtr = nullptr;
+    if (deviceDesc->pNext == nullptr && !unifiedMemoryProperties.allocationFlags.flags.shareable) {
+        usmPtr = usmPoolAllocator.allocate(size, alignment, unifiedMemoryProperties, nullptr);
+    }
+    if (usmPtr == nullptr) {
+        usmPtr = this->driverHandle->svmAllocsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    }
     if (usmPtr == nullptr) {
         return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
     }
@@ -283,10 +298,15 @@ ze_result_t ContextImp::allocSharedMem(ze_device_handle_t hDevice,
         usmPtr = this->driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(size,
                                                                                          unifiedMemoryProperties);
     } else {
-        usmPtr =
-            this->driverHandle->svmAllocsManager->createSharedUnifiedMemoryAllocation(size,
-                                                                                      unifiedMemoryProperties,
-                                                                                      static_cast<void *>(neoDevice->getSpecializedDevice<L0::Device>()));
+        auto cmdQ = static_cast<void *>(neoDevice->getSpecializedDevice<L0::Device>());
+        if (deviceDesc->pNext == nullptr && hostDesc->pNext == nullptr) {
+            usmPtr = usmPoolAllocator.allocate(size, alignment, unifiedMemoryProperties, cmdQ);
+        }
+        if (usmPtr == nullptr) {
+            usmPtr = this->driverHandle->svmAllocsManager->createSharedUnifiedMemoryAllocation(size,
+                                                                                               unifiedMemoryProperties,
+                                                                                               cmdQ);
+        }
     }
 
     if (usmPtr == nullptr) {
@@ -321,6 +341,26 @@ ze_result_t ContextImp::freeMem(const void *ptr) {
 }
 
 ze_result_t ContextImp::freeMem(const void *ptr, bool blocking) {
+    if (usmPoolAllocator.isInPool(ptr)) {
+        if (blocking) {
+            // chunk is reused right after free, so GPU work using the pool has to complete first
+            auto poolAllocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
+            auto memoryManager = this->driverHandle->getMemoryManager();
+            if (poolAllocData->cpuAllocation) {
+                memoryManager->waitForEnginesCompletion(*poolAllocData->cpuAllocation);
+            }
+            for (auto &gpuAllocation : poolAllocData->gpuAllocations.getGraphicsAllocations()) {
+                if (gpuAllocation) {
+                    memoryManager->waitForEnginesCompletion(*gpuAllocation);
+                }
+            }
+        }
+        return usmPoolAllocator.free(ptr) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return freeUsmAllocation(ptr, blocking);
+}
+
+ze_result_t ContextImp::freeUsmAllocation(const void *ptr, bool blocking) {
     auto allocation = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocation == nullptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
@@ -417,6 +457,9 @@ ze_result_t ContextImp::evictImage(ze_device_handle_t hDevice, ze_image_handle_t
 ze_result_t ContextImp::getMemAddressRange(const void *ptr,
                                            void **pBase,
                                            size_t *pSize) {
+    if (usmPoolAllocator.getChunkRange(ptr, pBase, pSize)) {
+        return ZE_RESULT_SUCCESS;
+    }
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         NEO::GraphicsAllocation *alloc;
@@ -441,6 +484,9 @@ ze_result_t ContextImp::closeIpcMemHandle(const void *ptr) {
 
 ze_result_t ContextImp::getIpcMemHandle(const void *ptr,
                                         ze_ipc_mem_handle_t *pIpcHandle) {
+    if (usmPoolAllocator.isInPool(ptr)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         uint64_t handle = allocData->gpuAllocations.getDefaultGraphicsAllocation()->peekInternalHandle(this->driverHandle->getMemoryManager());
@@ -457,6 +503,9 @@ ze_result_t ContextImp::getIpcMemHandle(const void *ptr,
 ze_result_t ContextImp::getIpcMemHandles(const void *ptr,
                                          uint32_t *numIpcHandles,
                                          ze_ipc_mem_handle_t *pIpcHandles) {
+    if (usmPoolAllocator.isInPool(ptr)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
         auto alloc = allocData->gpuAllocations.getDefaultGraphicsAllocation();
@@ -813,4 +862,193 @@ bool ContextImp::isAllocationSuitableForCompression(const StructuresLookupTable
     return structuresLookupTable.compressedHint;
 }
 
+size_t ContextImp::UsmPoolAllocator::getSizeClass(size_t size) {
+    return std::max(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(size))), UsmPoolAllocator::chunkAlignment);
+}
+
+size_t ContextImp::UsmPoolAllocator::getPoolSize() const {
+    if (NEO::DebugManager.flags.USMAllocationPoolSize.get() != -1) {
+        return alignUp(static_cast<size_t>(NEO::DebugManager.flags.USMAllocationPoolSize.get()), MemoryConstants::pageSize);
+    }
+    return UsmPoolAllocator::defaultPoolSize;
+}
+
+size_t ContextImp::UsmPoolAllocator::getThreshold() const {
+    if (NEO::DebugManager.flags.USMAllocationPoolThreshold.get() != -1) {
+        return static_cast<size_t>(NEO::DebugManager.flags.USMAllocationPoolThreshold.get());
+    }
+    return UsmPoolAllocator::defaultThreshold;
+}
+
+bool ContextImp::UsmPoolAllocator::UsmPool::isCompatible(const UsmPool &other) const {
+    return this->memoryType == other.memoryType &&
+           this->device == other.device &&
+           this->allocationFlags == other.allocationFlags &&
+           this->allocFlags == other.allocFlags;
+}
+
+bool ContextImp::UsmPoolAllocator::UsmPool::isCompatible(const NEO::SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) const {
+    return this->memoryType == memoryProperties.memoryType &&
+           this->device == memoryProperties.device &&
+           this->allocationFlags == memoryProperties.allocationFlags.allFlags &&
+           this->allocFlags == memoryProperties.allocationFlags.allAllocFlags;
+}
+
+void *ContextImp::UsmPoolAllocator::allocate(size_t size, size_t alignment, const NEO::SVMAllocsManager::UnifiedMemoryProperties &memoryProperties, void *cmdQ) {
+    if (!this->isEnabled() ||
+        size == 0u ||
+        alignment > UsmPoolAllocator::chunkAlignment) {
+        return nullptr;
+    }
+    auto chunkSize = getSizeClass(size);
+    auto poolSize = this->getPoolSize();
+    if (size > this->getThreshold() || chunkSize > poolSize) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    for (auto poolIndex = 0u;; poolIndex++) {
+        if (poolIndex == this->pools.size() && !this->addPool(memoryProperties, cmdQ)) {
+            break;
+        }
+        auto &pool = this->pools[poolIndex];
+        if (!pool.isCompatible(memoryProperties)) {
+            continue;
+        }
+        auto sizeToAllocate = chunkSize;
+        auto chunkAddress = pool.chunkAllocator->allocate(sizeToAllocate);
+        if (chunkAddress == 0u) {
+            continue;
+        }
+        auto chunkPtr = reinterpret_cast<void *>(static_cast<uintptr_t>(chunkAddress));
+        pool.chunks.insert({chunkPtr, UsmChunk{size, sizeToAllocate}});
+        this->statistics.allocationsFromPool++;
+        return chunkPtr;
+    }
+    this->statistics.allocationsNotFromPool++;
+    return nullptr;
+}
+
+bool ContextImp::UsmPoolAllocator::addPool(const NEO::SVMAllocsManager::UnifiedMemoryProperties &memoryProperties, void *cmdQ) {
+    auto sameTypePools = std::count_if(this->pools.begin(), this->pools.end(), [&memoryProperties](const UsmPool &pool) {
+        return pool.isCompatible(memoryProperties);
+    });
+    if (static_cast<size_t>(sameTypePools) >= UsmPoolAllocator::defaultMaxPoolsCount) {
+        return false;
+    }
+
+    auto svmAllocsManager = this->context->driverHandle->svmAllocsManager;
+    UsmPool pool{};
+    pool.size = this->getPoolSize();
+    switch (memoryProperties.memoryType) {
+    case InternalMemoryType::HOST_UNIFIED_MEMORY:
+        pool.ptr = svmAllocsManager->createHostUnifiedMemoryAllocation(pool.size, memoryProperties);
+        break;
+    case InternalMemoryType::DEVICE_UNIFIED_MEMORY:
+        pool.ptr = svmAllocsManager->createUnifiedMemoryAllocation(pool.size, memoryProperties);
+        break;
+    case InternalMemoryType::SHARED_UNIFIED_MEMORY:
+        pool.ptr = svmAllocsManager->createSharedUnifiedMemoryAllocation(pool.size, memoryProperties, cmdQ);
+        break;
+    default:
+        break;
+    }
+    if (pool.ptr == nullptr) {
+        return false;
+    }
+    pool.memoryType = memoryProperties.memoryType;
+    pool.device = memoryProperties.device;
+    pool.allocationFlags = memoryProperties.allocationFlags.allFlags;
+    pool.allocFlags = memoryProperties.allocationFlags.allAllocFlags;
+    pool.chunkAllocator.reset(new NEO::HeapAllocator(castToUint64(pool.ptr), pool.size, UsmPoolAllocator::chunkAlignment));
+    this->pools.push_back(std::move(pool));
+    this->statistics.poolsCreated++;
+    return true;
+}
+
+std::vector<ContextImp::UsmPoolAllocator::UsmPool>::iterator ContextImp::UsmPoolAllocator::findPool(const void *ptr) {
+    return std::find_if(this->pools.begin(), this->pools.end(), [ptr](const UsmPool &pool) {
+        return pool.contains(ptr);
+    });
+}
+
+bool ContextImp::UsmPoolAllocator::isInPool(const void *ptr) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return ptr != nullptr && this->findPool(ptr) != this->pools.end();
+}
+
+bool ContextImp::UsmPoolAllocator::free(const void *ptr) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto pool = this->findPool(ptr);
+    if (pool == this->pools.end()) {
+        return false;
+    }
+    auto chunk = pool->chunks.find(ptr);
+    if (chunk == pool->chunks.end()) {
+        return false;
+    }
+    pool->chunkAllocator->free(castToUint64(ptr), chunk->second.allocatedSize);
+    pool->chunks.erase(chunk);
+
+    // keep one pool of each kind, so a single allocation churn does not recreate pools
+    if (pool->chunks.empty()) {
+        auto otherCompatiblePool = std::find_if(this->pools.begin(), this->pools.end(), [&pool](const UsmPool &otherPool) {
+            return &otherPool != &*pool && otherPool.isCompatible(*pool);
+        });
+        if (otherCompatiblePool != this->pools.end()) {
+            this->releasePool(*pool);
+            this->pools.erase(pool);
+            this->statistics.poolsReleased++;
+        }
+    }
+    return true;
+}
+
+bool ContextImp::UsmPoolAllocator::getChunkRange(const void *ptr, void **pBase, size_t *pSize) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto pool = this->findPool(ptr);
+    if (pool == this->pools.end()) {
+        return false;
+    }
+    auto chunk = pool->chunks.upper_bound(ptr);
+    if (chunk == pool->chunks.begin()) {
+        return false;
+    }
+    chunk--;
+    if (ptr >= ptrOffset(chunk->first, chunk->second.size)) {
+        return false;
+    }
+    if (pBase) {
+        *pBase = const_cast<void *>(chunk->first);
+    }
+    if (pSize) {
+        *pSize = chunk->second.size;
+    }
+    return true;
+}
+
+void ContextImp::UsmPoolAllocator::releasePool(UsmPool &pool) {
+    this->context->freeUsmAllocation(pool.ptr, false);
+    pool.ptr = nullptr;
+}
+
+void ContextImp::UsmPoolAllocator::releasePools() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->statistics.print(NEO::DebugManager.flags.PrintUSMAllocationPoolStatistics.get(), "USM allocation pool", "allocations");
+    for (auto &pool : this->pools) {
+        this->releasePool(pool);
+    }
+    this->pools.clear();
+}
+
+size_t ContextImp::UsmPoolAllocator::getPoolsCount() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->pools.size();
+}
+
+ContextImp::UsmPoolAllocator::Statistics ContextImp::UsmPoolAllocator::getStatistics() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->statistics;
+}
+
 } // namespace L0
@@ -7,12 +7,20 @@
 
 #pragma once
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/pool_allocation_statistics.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "level_zero/core/source/context/context.h"
 
 #include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace L0 {
 struct StructuresLookupTable;
@@ -20,8 +28,74 @@ struct DriverHandleImp;
 struct Device;
 
 struct ContextImp : Context {
+    // Suballocates small USM allocations of the same type, device and flags from shared pool allocations
+    class UsmPoolAllocator {
+      public:
+        static constexpr size_t defaultPoolSize = 2 * MemoryConstants::megaByte;
+        static constexpr size_t defaultThreshold = 4 * MemoryConstants::kiloByte;
+        static constexpr size_t chunkAlignment = 64u;
+        static constexpr size_t defaultMaxPoolsCount = 16u;
+
+        using Statistics = NEO::PoolAllocationStatistics;
+
+        UsmPoolAllocator(ContextImp *context) : context(context) {}
+
+        inline bool isEnabled() const {
+            constexpr bool enable = false;
+            if (NEO::DebugManager.flags.ExperimentalEnableUSMAllocationPool.get() != -1) {
+                return !!NEO::DebugManager.flags.ExperimentalEnableUSMAllocationPool.get();
+            }
+            return enable;
+        }
+
+        void *allocate(size_t size, size_t alignment, const NEO::SVMAllocsManager::UnifiedMemoryProperties &memoryProperties, void *cmdQ);
+        bool isInPool(const void *ptr);
+        bool free(const void *ptr);
+        bool getChunkRange(const void *ptr, void **pBase, size_t *pSize);
+        void releasePools();
+
+        size_t getPoolsCount();
+        Statistics getStatistics();
+        size_t getPoolSize() const;
+        size_t getThreshold() const;
+        static size_t getSizeClass(size_t size);
+
+      protected:
+        struct UsmChunk {
+            size_t size = 0u;
+            // chunk allocator may return more than the size class, this is what has to be freed
+            size_t allocatedSize = 0u;
+        };
+
+        struct UsmPool {
+            void *ptr = nullptr;
+            size_t size = 0u;
+            InternalMemoryType memoryType = InternalMemoryType::NOT_SPECIFIED;
+            NEO::Device *device = nullptr;
+            uint32_t allocationFlags = 0u;
+            uint32_t allocFlags = 0u;
+            std::unique_ptr<NEO::HeapAllocator> chunkAllocator;
+            std::map<const void *, UsmChunk> chunks;
+
+            bool contains(const void *ptr) const {
+                return ptr >= this->ptr && ptr < ptrOffset(this->ptr, this->size);
+            }
+            bool isCompatible(const UsmPool &other) const;
+            bool isCompatible(const NEO::SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) const;
+        };
+
+        std::vector<UsmPool>::iterator findPool(const void *ptr);
+        bool addPool(const NEO::SVMAllocsManager::UnifiedMemoryProperties &memoryProperties, void *cmdQ);
+        void releasePool(UsmPool &pool);
+
+        std::vector<UsmPool> pools;
+        ContextImp *context = nullptr;
+        Statistics statistics;
+        std::mutex mutex;
+    };
+
     ContextImp(DriverHandle *driverHandle);
-    ~ContextImp() override = default;
+    ~ContextImp() override;
     ze_result_t destroy() override;
     ze_result_t getStatus() override;
     DriverHandle *getDriverHandle() override;
@@ -141,6 +215,7 @@ struct ContextImp : Context {
     }
 
     void freePeerAllocations(const void *ptr, bool blocking, Device *device);
+    UsmPoolAllocator &getUsmPoolAllocator() { return usmPoolAllocator; }
 
     RootDeviceIndicesContainer rootDeviceIndices;
     std::map<uint32_t, NEO::DeviceBitfield> deviceBitfields;
@@ -152,8 +227,11 @@ struct ContextImp : Context {
   protected:
     bool isAllocationSuitableForCompression(const StructuresLookupTable &structuresLookupTable, Device &device, size_t allocSize);
 
+    ze_result_t freeUsmAllocation(const void *ptr, bool blocking);
+
     std::map<uint32_t, ze_device_handle_t> devices;
     DriverHandleImp *driverHandle = nullptr;
+    UsmPoolAllocator usmPoolAllocator{this};
 };
 
 } // namespace L0
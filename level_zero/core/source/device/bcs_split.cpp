@@ -8,9 +8,13 @@
 #include "level_zero/core/source/device/bcs_split.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 
 #include "level_zero/core/source/device/device_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr) {
@@ -48,8 +52,13 @@ bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_
             UNRECOVERABLE_IF(result != ZE_RESULT_SUCCESS);
 
             this->cmdQs.push_back(commandQueue);
+            this->csrs.push_back(csr);
         }
     }
+    this->statistics.splitCallsCount = 0u;
+    for (auto &bytes : this->statistics.bytesPerEngine) {
+        bytes = 0u;
+    }
 
     return true;
 }
@@ -59,14 +68,90 @@ void BcsSplit::releaseResources() {
     this->clientCount--;
 
     if (this->clientCount == 0u) {
+        if (NEO::DebugManager.flags.PrintBcsSplitStatistics.get()) {
+            PRINT_DEBUG_STRING(true, stderr, "BCS split statistics: split copies: %llu\n", static_cast<unsigned long long>(this->statistics.splitCallsCount.load()));
+            for (size_t i = 0; i < this->csrs.size(); i++) {
+                PRINT_DEBUG_STRING(true, stderr, "  %s: %llu B\n", NEO::EngineHelpers::engineTypeToString(this->csrs[i]->getOsContext().getEngineType()).c_str(),
+                                   static_cast<unsigned long long>(this->statistics.bytesPerEngine[i].load()));
+            }
+        }
         for (auto cmdQ : cmdQs) {
             cmdQ->destroy();
         }
         cmdQs.clear();
+        csrs.clear();
         this->events.releaseResources();
     }
 }
 
+void BcsSplit::getSplitSizes(size_t size, uint64_t baseAddress, SplitSizes &splitSizes) const {
+    size_t minChunkSize = defaultMinChunkSize;
+    if (NEO::DebugManager.flags.SplitBcsMinChunkSize.get() > 0) {
+        minChunkSize = static_cast<size_t>(NEO::DebugManager.flags.SplitBcsMinChunkSize.get());
+    }
+    bool loadBalancing = NEO::DebugManager.flags.SplitBcsLoadBalancing.get() != 0;
+
+    EngineLoads engineLoads;
+    for (auto csr : this->csrs) {
+        uint32_t outstandingTasks = 0u;
+        if (loadBalancing) {
+            auto taskCount = csr->peekTaskCount();
+            auto completedTaskCount = *csr->getTagAddress();
+            outstandingTasks = taskCount > completedTaskCount ? taskCount - completedTaskCount : 0u;
+        }
+        engineLoads.push_back(outstandingTasks);
+    }
+
+    distributeSplit(size, baseAddress, minChunkSize, engineLoads, splitSizes);
+}
+
+void BcsSplit::distributeSplit(size_t size, uint64_t baseAddress, size_t minChunkSize, const EngineLoads &engineLoads, SplitSizes &splitSizes) {
+    const size_t engineCount = engineLoads.size();
+    splitSizes.clear();
+    splitSizes.resize(engineCount, 0u);
+    if (engineCount == 0u) {
+        return;
+    }
+
+    const size_t usedEnginesCount = std::clamp(size / std::max(minChunkSize, size_t{1u}), size_t{1u}, engineCount);
+
+    StackVec<size_t, 4> selectedEngines;
+    for (size_t i = 0; i < engineCount; i++) {
+        selectedEngines.push_back(i);
+    }
+    std::stable_sort(selectedEngines.begin(), selectedEngines.end(), [&engineLoads](size_t lhs, size_t rhs) { return engineLoads[lhs] < engineLoads[rhs]; });
+    selectedEngines.resize(usedEnginesCount);
+    std::sort(selectedEngines.begin(), selectedEngines.end());
+
+    uint32_t maxLoad = 0u;
+    for (auto engine : selectedEngines) {
+        maxLoad = std::max(maxLoad, std::min(engineLoads[engine], maxOutstandingTasksForWeight));
+    }
+    StackVec<uint64_t, 4> weights;
+    uint64_t totalWeight = 0u;
+    for (auto engine : selectedEngines) {
+        weights.push_back(maxLoad + 1u - std::min(engineLoads[engine], maxOutstandingTasksForWeight));
+        totalWeight += weights[weights.size() - 1];
+    }
+
+    const size_t alignment = (size / usedEnginesCount >= MemoryConstants::pageSize2Mb) ? MemoryConstants::pageSize2Mb : MemoryConstants::pageSize64k;
+
+    size_t offset = 0u;
+    for (size_t i = 0; i + 1 < usedEnginesCount; i++) {
+        auto share = static_cast<size_t>((size - offset) * weights[i] / totalWeight);
+        totalWeight -= weights[i];
+
+        auto chunkEnd = alignDown(baseAddress + offset + share, alignment);
+        if (chunkEnd <= baseAddress + offset) {
+            continue;
+        }
+        auto chunkSize = static_cast<size_t>(chunkEnd - baseAddress - offset);
+        splitSizes[selectedEngines[i]] = chunkSize;
+        offset += chunkSize;
+    }
+    splitSizes[selectedEngines[usedEnginesCount - 1]] = size - offset;
+}
+
 size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountInPool) {
     for (size_t i = 0; i < this->marker.size(); i++) {
         auto ret = this->marker[i]->queryStatus();
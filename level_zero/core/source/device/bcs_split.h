@@ -15,8 +15,11 @@
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/event/event.h"
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <mutex>
+#include <type_traits>
 #include <vector>
 
 namespace NEO {
@@ -50,13 +53,26 @@ struct BcsSplit {
     } events;
 
     std::vector<CommandQueue *> cmdQs;
+    std::vector<NEO::CommandStreamReceiver *> csrs;
     NEO::BcsInfoMask engines = NEO::EngineHelpers::oddLinkedCopyEnginesMask;
 
+    struct Statistics {
+        std::atomic<uint64_t> splitCallsCount{0u};
+        std::array<std::atomic<uint64_t>, NEO::bcsInfoMaskSize> bytesPerEngine = {};
+    } statistics;
+
+    static constexpr size_t defaultMinChunkSize = MemoryConstants::megaByte;
+    static constexpr uint32_t maxOutstandingTasksForWeight = 16u;
+
+    using SplitSizes = StackVec<size_t, 4>;
+    using EngineLoads = StackVec<uint32_t, 4>;
+
     template <GFXCORE_FAMILY gfxCoreFamily, typename T, typename K>
     ze_result_t appendSplitCall(CommandListCoreFamilyImmediate<gfxCoreFamily> *cmdList,
                                 T dstptr,
                                 K srcptr,
                                 size_t size,
+                                uint64_t dstBaseAddress,
                                 ze_event_handle_t hSignalEvent,
                                 std::function<ze_result_t(T, K, size_t, ze_event_handle_t)> appendCall) {
         ze_result_t result = ZE_RESULT_SUCCESS;
@@ -69,23 +85,37 @@ struct BcsSplit {
         auto subcopyEventIndex = markerEventIndex * this->cmdQs.size();
         StackVec<ze_event_handle_t, 4> eventHandles;
 
-        auto totalSize = size;
-        auto engineCount = this->cmdQs.size();
+        // chunks are aligned on the destination address, which is dstptr offset by dstBaseAddress
+        uint64_t baseAddress = dstBaseAddress;
+        if constexpr (std::is_pointer_v<T>) {
+            baseAddress += reinterpret_cast<uintptr_t>(dstptr);
+        } else {
+            baseAddress += static_cast<uint64_t>(dstptr);
+        }
+
+        SplitSizes splitSizes;
+        this->getSplitSizes(size, baseAddress, splitSizes);
+        this->statistics.splitCallsCount++;
+
+        size_t offset = 0u;
         for (size_t i = 0; i < this->cmdQs.size(); i++) {
-            auto localSize = totalSize / engineCount;
-            auto localDstPtr = ptrOffset(dstptr, size - totalSize);
-            auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
+            auto localSize = splitSizes[i];
+            if (localSize == 0u) {
+                continue;
+            }
+            auto localDstPtr = ptrOffset(dstptr, offset);
+            auto localSrcPtr = ptrOffset(srcptr, offset);
 
             auto eventHandle = this->events.subcopy[subcopyEventIndex + i]->toHandle();
             result = appendCall(localDstPtr, localSrcPtr, localSize, eventHandle);
             cmdList->executeCommandListImmediateImpl(true, this->cmdQs[i]);
             eventHandles.push_back(eventHandle);
 
-            totalSize -= localSize;
-            engineCount--;
+            this->statistics.bytesPerEngine[i] += localSize;
+            offset += localSize;
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(this->cmdQs.size()), eventHandles.data());
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data());
         cmdList->appendEventForProfilingAllWalkers(this->events.marker[markerEventIndex], false);
 
         if (hSignalEvent) {
@@ -98,6 +128,9 @@ struct BcsSplit {
     bool setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr);
     void releaseResources();
 
+    void getSplitSizes(size_t size, uint64_t baseAddress, SplitSizes &splitSizes) const;
+    static void distributeSplit(size_t size, uint64_t baseAddress, size_t minChunkSize, const EngineLoads &engineLoads, SplitSizes &splitSizes);
+
     BcsSplit(DeviceImp &device) : device(device), events(*this){};
 };
 
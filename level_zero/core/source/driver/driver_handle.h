@@ -59,6 +59,7 @@ struct DriverHandle : _ze_driver_handle_t {
     virtual ze_result_t importExternalPointer(void *ptr, size_t size) = 0;
     virtual ze_result_t releaseImportedPointer(void *ptr) = 0;
     virtual ze_result_t getHostPointerBaseAddress(void *ptr, void **baseAddress) = 0;
+    virtual ze_result_t hostSynchronizeEvents(uint32_t numEvents, ze_event_handle_t *phEvents, bool waitAll, uint64_t timeout, uint32_t *pSignaledEventIndex) = 0;
 
     virtual NEO::GraphicsAllocation *findHostPointerAllocation(void *ptr, size_t size, uint32_t rootDeviceIndex) = 0;
     virtual NEO::GraphicsAllocation *getDriverSystemMemoryAllocation(void *ptr,
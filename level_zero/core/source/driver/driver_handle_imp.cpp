@@ -7,6 +7,7 @@
 
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
@@ -19,13 +20,16 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
 #include "level_zero/core/source/driver/host_pointer_manager.h"
+#include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/fabric/fabric.h"
 
 #include "driver_version_l0.h"
 
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <map>
 #include <vector>
 
 namespace L0 {
@@ -152,7 +156,7 @@ DriverHandleImp::~DriverHandleImp() {
     if (memoryManager != nullptr) {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
         if (this->svmAllocsManager) {
-            this->svmAllocsManager->trimUSMDeviceAllocCache();
+            this->svmAllocsManager->trimUSMAllocCaches();
         }
     }
 
@@ -411,6 +415,107 @@ ze_result_t DriverHandleImp::getHostPointerBaseAddress(void *ptr, void **baseAdd
     return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
+ze_result_t DriverHandleImp::hostSynchronizeEvents(uint32_t numEvents, ze_event_handle_t *phEvents, bool waitAll, uint64_t timeout, uint32_t *pSignaledEventIndex) {
+    if (numEvents == 0 || phEvents == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    const auto spinTime = Event::getHostSynchronizeSpinTime();
+    const auto waitStartTime = std::chrono::high_resolution_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+    std::vector<bool> signaled(numEvents, false);
+    uint32_t numSignaled = 0;
+    bool csrWaitDone = false;
+
+    while (true) {
+        for (uint32_t i = 0; i < numEvents; i++) {
+            if (signaled[i]) {
+                continue;
+            }
+            if (Event::fromHandle(phEvents[i])->queryStatus() != ZE_RESULT_SUCCESS) {
+                continue;
+            }
+            signaled[i] = true;
+            numSignaled++;
+            if (!waitAll) {
+                if (pSignaledEventIndex) {
+                    *pSignaledEventIndex = i;
+                }
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+        if (numSignaled == numEvents) {
+            return ZE_RESULT_SUCCESS;
+        }
+        if (timeout == 0) {
+            return ZE_RESULT_NOT_READY;
+        }
+
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        auto elapsedTimeSinceGpuHangCheck = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime);
+        bool gpuHangChecked = false;
+        for (uint32_t i = 0; i < numEvents; i++) {
+            auto event = Event::fromHandle(phEvents[i]);
+            if (signaled[i] || event->csr == nullptr || elapsedTimeSinceGpuHangCheck < event->gpuHangCheckPeriod) {
+                continue;
+            }
+            gpuHangChecked = true;
+            if (event->csr->isGpuHangDetected()) {
+                return ZE_RESULT_ERROR_DEVICE_LOST;
+            }
+        }
+        if (gpuHangChecked) {
+            lastHangCheckTime = currentTime;
+        }
+
+        uint64_t timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+        if (timeout != std::numeric_limits<uint64_t>::max() && timeDiff >= timeout) {
+            return ZE_RESULT_NOT_READY;
+        }
+
+        if (csrWaitDone || std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime) < spinTime) {
+            continue;
+        }
+        csrWaitDone = true;
+
+        // Park once per CSR: on the latest task count for wait-all, on the earliest one for wait-any on a single CSR.
+        std::map<NEO::CommandStreamReceiver *, Event *> eventsToWaitOn;
+        bool canWaitOnCsrs = true;
+        for (uint32_t i = 0; i < numEvents; i++) {
+            if (signaled[i]) {
+                continue;
+            }
+            auto event = Event::fromHandle(phEvents[i]);
+            if (!event->canWaitForCompletionOnCsr()) {
+                canWaitOnCsrs = false;
+                break;
+            }
+            auto &eventToWaitOn = eventsToWaitOn[event->csr];
+            if (eventToWaitOn == nullptr ||
+                (waitAll && event->getCompletionTaskCount() > eventToWaitOn->getCompletionTaskCount()) ||
+                (!waitAll && event->getCompletionTaskCount() < eventToWaitOn->getCompletionTaskCount())) {
+                eventToWaitOn = event;
+            }
+        }
+        if (!canWaitOnCsrs || (!waitAll && eventsToWaitOn.size() > 1)) {
+            continue;
+        }
+        for (auto &[csr, event] : eventsToWaitOn) {
+            uint64_t remainingTimeout = std::numeric_limits<uint64_t>::max();
+            if (timeout != std::numeric_limits<uint64_t>::max()) {
+                timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - waitStartTime).count();
+                if (timeDiff >= timeout) {
+                    break;
+                }
+                remainingTimeout = timeout - timeDiff;
+            }
+            if (Event::waitForCompletionOnCsr(*csr, event->getCompletionTaskCount(), event->getCompletionFlushStamp(), remainingTimeout) == ZE_RESULT_ERROR_DEVICE_LOST) {
+                return ZE_RESULT_ERROR_DEVICE_LOST;
+            }
+        }
+    }
+}
+
 NEO::GraphicsAllocation *DriverHandleImp::findHostPointerAllocation(void *ptr, size_t size, uint32_t rootDeviceIndex) {
     if (hostPointerManager.get() != nullptr) {
         HostPointerData *hostData = hostPointerManager->getHostPointerAllocation(ptr);
@@ -61,6 +61,7 @@ struct DriverHandleImp : public DriverHandle {
     ze_result_t importExternalPointer(void *ptr, size_t size) override;
     ze_result_t releaseImportedPointer(void *ptr) override;
     ze_result_t getHostPointerBaseAddress(void *ptr, void **baseAddress) override;
+    ze_result_t hostSynchronizeEvents(uint32_t numEvents, ze_event_handle_t *phEvents, bool waitAll, uint64_t timeout, uint32_t *pSignaledEventIndex) override;
 
     NEO::GraphicsAllocation *findHostPointerAllocation(void *ptr, size_t size, uint32_t rootDeviceIndex) override;
     NEO::GraphicsAllocation *getDriverSystemMemoryAllocation(void *ptr,
@@ -158,6 +158,34 @@ ze_result_t EventPoolImp::createEvent(const ze_event_desc_t *desc, ze_event_hand
     return ZE_RESULT_SUCCESS;
 }
 
+bool Event::canWaitForCompletionOnCsr() const {
+    if (NEO::DebugManager.flags.EnableEventHostSynchronizeCsrWait.get() == 0) {
+        return false;
+    }
+    return this->csr != nullptr && this->completionTaskCount != uninitializedTaskCount;
+}
+
+ze_result_t Event::waitForCompletionOnCsr(NEO::CommandStreamReceiver &csr, uint32_t taskCount, FlushStamp flushStamp, uint64_t timeout) {
+    NEO::WaitStatus waitStatus = NEO::WaitStatus::NotReady;
+    if (timeout == std::numeric_limits<uint64_t>::max()) {
+        waitStatus = csr.waitForTaskCountWithKmdNotifyFallback(taskCount, flushStamp, false, NEO::QueueThrottle::MEDIUM);
+    } else {
+        auto timeoutMicroseconds = static_cast<int64_t>(std::min(timeout / 1000u, static_cast<uint64_t>(std::numeric_limits<int64_t>::max())));
+        waitStatus = csr.waitForCompletionWithTimeout(NEO::WaitParams{false, true, timeoutMicroseconds}, taskCount);
+    }
+    if (waitStatus == NEO::WaitStatus::GpuHang) {
+        return ZE_RESULT_ERROR_DEVICE_LOST;
+    }
+    return waitStatus == NEO::WaitStatus::Ready ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+}
+
+std::chrono::microseconds Event::getHostSynchronizeSpinTime() {
+    if (NEO::DebugManager.flags.EventHostSynchronizeSpinTime.get() != -1) {
+        return std::chrono::microseconds{NEO::DebugManager.flags.EventHostSynchronizeSpinTime.get()};
+    }
+    return std::chrono::microseconds{50};
+}
+
 ze_result_t Event::destroy() {
     delete this;
     return ZE_RESULT_SUCCESS;
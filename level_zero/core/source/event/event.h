@@ -11,6 +11,7 @@
 
 #include <level_zero/ze_api.h>
 
+#include <atomic>
 #include <bitset>
 #include <chrono>
 #include <limits>
@@ -19,6 +20,10 @@ struct _ze_event_handle_t {};
 
 struct _ze_event_pool_handle_t {};
 
+namespace NEO {
+class CommandStreamReceiver;
+} // namespace NEO
+
 namespace L0 {
 typedef uint64_t FlushStamp;
 struct EventPool;
@@ -101,6 +106,20 @@ struct Event : _ze_event_handle_t {
     void setCsr(NEO::CommandStreamReceiver *csr) {
         this->csr = csr;
     }
+    void setCompletionTaskCount(uint32_t taskCount, FlushStamp flushStamp) {
+        this->completionFlushStamp = flushStamp;
+        this->completionTaskCount = taskCount;
+    }
+    uint32_t getCompletionTaskCount() const {
+        return completionTaskCount;
+    }
+    FlushStamp getCompletionFlushStamp() const {
+        return completionFlushStamp;
+    }
+    bool canWaitForCompletionOnCsr() const;
+
+    static ze_result_t waitForCompletionOnCsr(NEO::CommandStreamReceiver &csr, uint32_t taskCount, FlushStamp flushStamp, uint64_t timeout);
+    static std::chrono::microseconds getHostSynchronizeSpinTime();
 
     void increaseKernelCount() {
         kernelCount++;
@@ -121,8 +140,11 @@ struct Event : _ze_event_handle_t {
 
     void resetCompletion() {
         this->isCompleted = false;
+        this->completionTaskCount = uninitializedTaskCount;
     }
 
+    static constexpr uint32_t uninitializedTaskCount = std::numeric_limits<uint32_t>::max();
+
     uint64_t globalStartTS;
     uint64_t globalEndTS;
     uint64_t contextStartTS;
@@ -154,6 +176,9 @@ struct Event : _ze_event_handle_t {
 
     uint32_t kernelCount = 1u;
 
+    FlushStamp completionFlushStamp = 0u;
+    std::atomic<uint32_t> completionTaskCount{uninitializedTaskCount};
+
     bool isTimestampEvent = false;
     bool usingContextEndOffset = false;
     std::atomic<bool> isCompleted{false};
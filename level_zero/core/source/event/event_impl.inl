@@ -251,6 +251,9 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
         return queryStatus();
     }
 
+    const auto spinTime = getHostSynchronizeSpinTime();
+    bool csrWaitDone = false;
+
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
     while (true) {
@@ -269,15 +272,19 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
             }
         }
 
-        if (timeout == std::numeric_limits<uint64_t>::max()) {
-            continue;
-        }
-
         timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
-
-        if (timeDiff >= timeout) {
+        if (timeout != std::numeric_limits<uint64_t>::max() && timeDiff >= timeout) {
             break;
         }
+
+        if (!csrWaitDone && canWaitForCompletionOnCsr() &&
+            std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime) >= spinTime) {
+            csrWaitDone = true;
+            auto remainingTimeout = timeout == std::numeric_limits<uint64_t>::max() ? timeout : timeout - timeDiff;
+            if (waitForCompletionOnCsr(*this->csr, this->completionTaskCount, this->completionFlushStamp, remainingTimeout) == ZE_RESULT_ERROR_DEVICE_LOST) {
+                return ZE_RESULT_ERROR_DEVICE_LOST;
+            }
+        }
     }
 
     return ret;
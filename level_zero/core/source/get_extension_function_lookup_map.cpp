@@ -17,6 +17,7 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
     addToMap(lookupMap, zexDriverImportExternalPointer);
     addToMap(lookupMap, zexDriverReleaseImportedPointer);
     addToMap(lookupMap, zexDriverGetHostPointerBaseAddress);
+    addToMap(lookupMap, zexDriverHostSynchronizeEvents);
 
     addToMap(lookupMap, zexKernelGetBaseAddress);
 
@@ -8,6 +8,7 @@
 #include "level_zero/core/source/kernel/kernel_imp.h"
 
 #include "shared/source/debugger/debugger_l0.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -22,6 +23,7 @@
 #include "shared/source/kernel/implicit_args.h"
 #include "shared/source/kernel/kernel_arg_descriptor.h"
 #include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/kernel/kernel_tuning_database.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -76,11 +78,16 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device
     UNRECOVERABLE_IF(!kernelInfo->heapInfo.pKernelHeap);
     const auto allocType = internalKernel ? NEO::AllocationType::KERNEL_ISA_INTERNAL : NEO::AllocationType::KERNEL_ISA;
 
-    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
-        {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
-    UNRECOVERABLE_IF(allocation == nullptr);
+    if (isaParentAllocation) {
+        UNRECOVERABLE_IF(isaParentAllocation->getAllocationType() != allocType);
+        UNRECOVERABLE_IF(isaSubAllocationSize < kernelIsaSize);
+    } else {
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+            {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
+        UNRECOVERABLE_IF(allocation == nullptr);
 
-    isaGraphicsAllocation.reset(allocation);
+        isaGraphicsAllocation.reset(allocation);
+    }
 
     if (neoDevice->getDebugger() && kernelInfo->kernelDescriptor.external.debugData.get()) {
         createRelocatedDebugData(globalConstBuffer, globalVarBuffer);
@@ -176,8 +183,8 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 
             memcpy_s(kernelInfo->kernelDescriptor.external.relocatedDebugData.get(), size, kernelInfo->kernelDescriptor.external.debugData->vIsa, kernelInfo->kernelDescriptor.external.debugData->vIsaSize);
 
-            NEO::Linker::SegmentInfo textSegment = {getIsaGraphicsAllocation()->getGpuAddress(),
-                                                    getIsaGraphicsAllocation()->getUnderlyingBufferSize()};
+            NEO::Linker::SegmentInfo textSegment = {static_cast<uintptr_t>(getIsaGraphicsAllocation()->getGpuAddress() + getIsaOffsetInParentAllocation()),
+                                                    getIsaSize()};
 
             NEO::Linker::applyDebugDataRelocations(decodedElf, ArrayRef<uint8_t>(kernelInfo->kernelDescriptor.external.relocatedDebugData.get(), size),
                                                    textSegment, globalData, constData);
@@ -188,12 +195,16 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 ze_result_t KernelImp::getBaseAddress(uint64_t *baseAddress) {
     if (baseAddress) {
         auto gmmHelper = module->getDevice()->getNEODevice()->getGmmHelper();
-        *baseAddress = gmmHelper->decanonize(this->kernelImmData->getIsaGraphicsAllocation()->getGpuAddress());
+        *baseAddress = gmmHelper->decanonize(this->kernelImmData->getIsaGraphicsAllocation()->getGpuAddress() +
+                                             this->kernelImmData->getIsaOffsetInParentAllocation());
     }
     return ZE_RESULT_SUCCESS;
 }
 
 uint32_t KernelImmutableData::getIsaSize() const {
+    if (isaParentAllocation) {
+        return static_cast<uint32_t>(isaSubAllocationSize);
+    }
     return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
 }
 
@@ -212,6 +223,9 @@ KernelImp::~KernelImp() {
         PrintfHandler::printOutput(kernelImmData, this->printfBuffer, module->getDevice());
         module->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(printfBuffer);
     }
+    if (kernelImmData != nullptr) {
+        localWorkSizeCache.printStatistics(NEO::DebugManager.flags.PrintLocalWorkSizeCacheStatistics.get(), kernelImmData->getDescriptor().kernelMetadata.kernelName);
+    }
     slmArgSizes.clear();
     crossThreadData.reset();
     surfaceStateHeapData.reset();
@@ -344,7 +358,16 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     uint32_t dim = (globalSizeY > 1U) ? 2 : 1U;
     dim = (globalSizeZ > 1U) ? 3 : dim;
 
-    if (NEO::DebugManager.flags.EnableComputeWorkSizeND.get()) {
+    bool useLocalWorkSizeCache = NEO::DebugManager.flags.EnableLocalWorkSizeCache.get() != 0;
+    NEO::LocalWorkSizeCache::Key localWorkSizeCacheKey{{workItems[0], workItems[1], workItems[2]}, dim, this->getSlmTotalSize(), maxWorkGroupSize};
+    NEO::LocalWorkSizeCache::Entry localWorkSizeCacheEntry;
+    bool localWorkSizeCacheHit = useLocalWorkSizeCache && localWorkSizeCache.find(localWorkSizeCacheKey, localWorkSizeCacheEntry);
+
+    if (localWorkSizeCacheHit) {
+        retGroupSize[0] = localWorkSizeCacheEntry.lws.x;
+        retGroupSize[1] = localWorkSizeCacheEntry.lws.y;
+        retGroupSize[2] = localWorkSizeCacheEntry.lws.z;
+    } else if (NEO::DebugManager.flags.EnableComputeWorkSizeND.get()) {
         auto usesImages = getImmutableData()->getDescriptor().kernelAttributes.flags.usesImages;
         auto neoDevice = module->getDevice()->getNEODevice();
         const auto hwInfo = &neoDevice->getHardwareInfo();
@@ -371,6 +394,14 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
         }
     }
 
+    if (useLocalWorkSizeCache && !localWorkSizeCacheHit) {
+        localWorkSizeCache.store(localWorkSizeCacheKey, {retGroupSize[0], retGroupSize[1], retGroupSize[2]});
+    }
+
+    if (NEO::DebugManager.flags.EnableKernelWorkgroupSizeTuning.get() == 1) {
+        getTunedGroupSize(workItems, retGroupSize);
+    }
+
     *groupSizeX = static_cast<uint32_t>(retGroupSize[0]);
     *groupSizeY = static_cast<uint32_t>(retGroupSize[1]);
     *groupSizeZ = static_cast<uint32_t>(retGroupSize[2]);
@@ -378,6 +409,45 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     return ZE_RESULT_SUCCESS;
 }
 
+uint32_t KernelImp::getMaxTunedGroupSize() const {
+    auto maxGroupSize = module->getMaxGroupSize();
+    auto &kernelAttributes = kernelImmData->getDescriptor().kernelAttributes;
+    if (kernelAttributes.numGrfRequired == GrfConfig::LargeGrfNumber && kernelAttributes.simdSize != 32) {
+        maxGroupSize >>= 1;
+    }
+    return maxGroupSize;
+}
+
+bool KernelImp::getTunedGroupSize(size_t globalSize[3], size_t groupSizeOut[3]) {
+    auto neoDevice = module->getDevice()->getNEODevice();
+    if (kernelTuningHash == 0u) {
+        kernelTuningHash = NEO::KernelTuningDatabase::computeKernelHash(*kernelImmData->getKernelInfo(), neoDevice->getHardwareInfo());
+    }
+
+    Vec3<size_t> tunedGroupSize = {0, 0, 0};
+    auto kernelTuningDatabase = neoDevice->getExecutionEnvironment()->getKernelTuningDatabase();
+    if (!kernelTuningDatabase->getWorkgroupSize(kernelTuningHash, {globalSize[0], globalSize[1], globalSize[2]}, tunedGroupSize)) {
+        return false;
+    }
+    if (tunedGroupSize.x * tunedGroupSize.y * tunedGroupSize.z > getMaxTunedGroupSize()) {
+        return false;
+    }
+    auto &requiredWorkgroupSize = kernelImmData->getDescriptor().kernelAttributes.requiredWorkgroupSize;
+    for (uint32_t i = 0; i < 3; i++) {
+        if (globalSize[i] % tunedGroupSize[i] != 0) {
+            return false;
+        }
+        if (requiredWorkgroupSize[i] != 0 && requiredWorkgroupSize[i] != tunedGroupSize[i]) {
+            return false;
+        }
+    }
+
+    groupSizeOut[0] = tunedGroupSize.x;
+    groupSizeOut[1] = tunedGroupSize.y;
+    groupSizeOut[2] = tunedGroupSize.z;
+    return true;
+}
+
 ze_result_t KernelImp::suggestMaxCooperativeGroupCount(uint32_t *totalGroupCount, NEO::EngineGroupType engineGroupType,
                                                        bool isEngineInstanced) {
     UNRECOVERABLE_IF(0 == groupSize[0]);
@@ -803,7 +873,7 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *isaAllocation),
                                                               *neoDevice,
                                                               isaAllocation,
-                                                              0,
+                                                              this->kernelImmData->getIsaOffsetInParentAllocation(),
                                                               this->kernelImmData->getKernelInfo()->heapInfo.pKernelHeap,
                                                               static_cast<size_t>(this->kernelImmData->getKernelInfo()->heapInfo.KernelHeapSize));
     }
@@ -1058,6 +1128,10 @@ NEO::GraphicsAllocation *KernelImp::getIsaAllocation() const {
     return getImmutableData()->getIsaGraphicsAllocation();
 }
 
+uint64_t KernelImp::getIsaOffsetInParentAllocation() const {
+    return getImmutableData()->getIsaOffsetInParentAllocation();
+}
+
 ze_result_t KernelImp::setSchedulingHintExp(ze_scheduling_hint_exp_desc_t *pHint) {
     auto &threadArbitrationPolicy = const_cast<NEO::ThreadArbitrationPolicy &>(getKernelDescriptor().kernelAttributes.threadArbitrationPolicy);
     if (pHint->flags == ZE_SCHEDULING_HINT_EXP_FLAG_OLDEST_FIRST) {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/command_stream/thread_arbitration_policy.h"
+#include "shared/source/helpers/local_work_size_cache.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
@@ -130,6 +131,7 @@ struct KernelImp : Kernel {
     }
 
     NEO::GraphicsAllocation *getIsaAllocation() const override;
+    uint64_t getIsaOffsetInParentAllocation() const override;
 
     uint32_t getRequiredWorkgroupOrder() const override { return requiredWorkgroupOrder; }
     bool requiresGenerationOfLocalIdsByRuntime() const override { return kernelRequiresGenerationOfLocalIdsByRuntime; }
@@ -178,6 +180,8 @@ struct KernelImp : Kernel {
     void setDebugSurface();
     virtual void evaluateIfRequiresGenerationOfLocalIdsByRuntime(const NEO::KernelDescriptor &kernelDescriptor) = 0;
     void *patchBindlessSurfaceState(NEO::GraphicsAllocation *alloc, uint32_t bindless);
+    bool getTunedGroupSize(size_t globalSize[3], size_t groupSizeOut[3]);
+    uint32_t getMaxTunedGroupSize() const;
 
     const KernelImmutableData *kernelImmData = nullptr;
     Module *module = nullptr;
@@ -218,6 +222,8 @@ struct KernelImp : Kernel {
     std::vector<bool> isArgUncached;
 
     uint32_t globalOffsets[3] = {};
+    uint64_t kernelTuningHash = 0u;
+    NEO::LocalWorkSizeCache localWorkSizeCache;
 
     ze_cache_config_flags_t cacheConfigFlags = 0u;
 
@@ -14,6 +14,8 @@
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
 namespace NEO {
+bool PageFaultManager::chunkedMigrationApiSupport = false;
+
 void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
 
@@ -26,7 +28,7 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
                                                              allocData->size, true);
     UNRECOVERABLE_IF(ret);
 }
-void PageFaultManager::transferToGpu(void *ptr, void *device) {
+void PageFaultManager::transferToGpu(void *ptr, size_t size, void *device) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
 
     NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
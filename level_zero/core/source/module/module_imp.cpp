@@ -19,6 +19,7 @@
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/helpers/addressing_mode_helper.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/compiler_hw_info_config.h"
 #include "shared/source/helpers/constants.h"
@@ -32,15 +33,18 @@
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module_build_log.h"
 
 #include "program_debug_data.h"
 
+#include <chrono>
 #include <list>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace L0 {
 
@@ -452,6 +456,7 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 
 ModuleImp::~ModuleImp() {
     kernelImmDatas.clear();
+    freeKernelIsaPools();
 }
 
 NEO::Debug::Segments ModuleImp::getZebinSegments() {
@@ -464,6 +469,7 @@ NEO::Debug::Segments ModuleImp::getZebinSegments() {
 }
 
 ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
+    auto creationStartTime = std::chrono::steady_clock::now();
     bool linkageSuccessful = true;
     ze_result_t result = ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
 
@@ -572,13 +578,20 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
         return result;
     }
 
-    kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
-    for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
-        std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
-        kernelImmData->initialize(ki, device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    kernelImmDatas.reserve(kernelInfos.size());
+    for (size_t i = 0; i < kernelInfos.size(); i++) {
+        kernelImmDatas.push_back(std::unique_ptr<KernelImmutableData>{new KernelImmutableData(this->device)});
+    }
+    allocateKernelIsaPools();
+
+    kernelImmDatasByName.reserve(kernelInfos.size());
+    for (size_t i = 0; i < kernelInfos.size(); i++) {
+        auto &kernelImmData = kernelImmDatas[i];
+        kernelImmData->initialize(kernelInfos[i], device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
                                   this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
                                   this->type == ModuleType::Builtin);
-        kernelImmDatas.push_back(std::move(kernelImmData));
+        kernelImmDatasByName.emplace(kernelImmData->getDescriptor().kernelMetadata.kernelName, kernelImmData.get());
     }
 
     auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->unpackedDeviceBinary.get(), translationUnit->unpackedDeviceBinarySize);
@@ -614,7 +627,7 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
             if (!ki->isIsaCopiedToAllocation()) {
 
                 NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *ki->getIsaGraphicsAllocation()),
-                                                                      *neoDevice, ki->getIsaGraphicsAllocation(), 0, ki->getKernelInfo()->heapInfo.pKernelHeap,
+                                                                      *neoDevice, ki->getIsaGraphicsAllocation(), ki->getIsaOffsetInParentAllocation(), ki->getKernelInfo()->heapInfo.pKernelHeap,
                                                                       static_cast<size_t>(ki->getKernelInfo()->heapInfo.KernelHeapSize));
 
                 ki->setIsaCopiedToAllocation();
@@ -630,6 +643,17 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
     if (linkageSuccessful == false) {
         result = ZE_RESULT_ERROR_MODULE_LINK_FAILURE;
     }
+
+    if (NEO::DebugManager.flags.PrintModuleCreationStatistics.get()) {
+        std::unordered_set<NEO::GraphicsAllocation *> isaAllocations;
+        for (auto &ki : kernelImmDatas) {
+            isaAllocations.insert(ki->getIsaGraphicsAllocation());
+        }
+        auto creationTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - creationStartTime).count();
+        PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintModuleCreationStatistics.get(), stderr,
+                           "Module creation statistics: kernels: %zu, ISA allocations: %zu, creation time: %lld us\n",
+                           kernelImmDatas.size(), isaAllocations.size(), static_cast<long long>(creationTimeUs));
+    }
     return result;
 }
 
@@ -677,6 +701,10 @@ void ModuleImp::passDebugData() {
 }
 
 const KernelImmutableData *ModuleImp::getKernelImmutableData(const char *kernelName) const {
+    if (kernelImmDatasByName.size() == kernelImmDatas.size()) {
+        auto it = kernelImmDatasByName.find(kernelName);
+        return (it != kernelImmDatasByName.end()) ? it->second : nullptr;
+    }
     for (auto &kernelImmData : kernelImmDatas) {
         if (kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(kernelName) == 0) {
             return kernelImmData.get();
@@ -826,7 +854,7 @@ void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSeg
             auto segmentId = &kernelImmData - &this->kernelImmDatas[0];
 
             NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *kernelImmData->getIsaGraphicsAllocation()),
-                                                                  *device->getNEODevice(), kernelImmData->getIsaGraphicsAllocation(), 0, isaSegmentsForPatching[segmentId].hostPointer,
+                                                                  *device->getNEODevice(), kernelImmData->getIsaGraphicsAllocation(), kernelImmData->getIsaOffsetInParentAllocation(), isaSegmentsForPatching[segmentId].hostPointer,
                                                                   isaSegmentsForPatching[segmentId].segmentSize);
 
             kernelImmData->setIsaCopiedToAllocation();
@@ -870,9 +898,10 @@ bool ModuleImp::linkBinary() {
     }
     if (linkerInput->getExportedFunctionsSegmentId() >= 0) {
         auto exportedFunctionHeapId = linkerInput->getExportedFunctionsSegmentId();
-        this->exportedFunctionsSurface = this->kernelImmDatas[exportedFunctionHeapId]->getIsaGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = exportedFunctionsSurface->getUnderlyingBufferSize();
+        auto &exportedFunctionsKernelImmData = this->kernelImmDatas[exportedFunctionHeapId];
+        this->exportedFunctionsSurface = exportedFunctionsKernelImmData->getIsaGraphicsAllocation();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch() + exportedFunctionsKernelImmData->getIsaOffsetInParentAllocation());
+        exportedFunctions.segmentSize = exportedFunctionsKernelImmData->getIsaSize();
     }
 
     Linker::KernelDescriptorsT kernelDescriptors;
@@ -884,7 +913,8 @@ bool ModuleImp::linkBinary() {
             auto &kernHeapInfo = kernelInfo->heapInfo;
             const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
             patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
-            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
+            auto isaGpuAddress = kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() + kernelImmDatas.at(i)->getIsaOffsetInParentAllocation();
+            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(isaGpuAddress), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
             kernelDescriptors.push_back(&kernelInfo->kernelDescriptor);
         }
     }
@@ -944,7 +974,7 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
-            *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress());
+            *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress() + kernelImmData->getIsaOffsetInParentAllocation());
             // Ensure that any kernel in this module which uses this kernel module function pointer has access to the memory.
             for (auto &data : this->getKernelImmutableDataVector()) {
                 if (data.get() != kernelImmData) {
@@ -1115,7 +1145,8 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                     auto &kernHeapInfo = kernelInfo->heapInfo;
                     const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
                     patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
-                    isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
+                    auto isaGpuAddress = kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() + kernelImmDatas.at(i)->getIsaOffsetInParentAllocation();
+                    isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(isaGpuAddress), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
                 }
             }
             for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
@@ -1324,8 +1355,13 @@ void ModuleImp::notifyModuleDestroy() {
 
 StackVec<NEO::GraphicsAllocation *, 32> ModuleImp::getModuleAllocations() {
     StackVec<NEO::GraphicsAllocation *, 32> allocs;
+    for (auto pool : isaPoolAllocations) {
+        allocs.push_back(pool);
+    }
     for (auto &kernImmData : kernelImmDatas) {
-        allocs.push_back(kernImmData->getIsaGraphicsAllocation());
+        if (!kernImmData->isIsaSubAllocated()) {
+            allocs.push_back(kernImmData->getIsaGraphicsAllocation());
+        }
     }
 
     if (translationUnit) {
@@ -1339,6 +1375,66 @@ StackVec<NEO::GraphicsAllocation *, 32> ModuleImp::getModuleAllocations() {
     return allocs;
 }
 
+bool ModuleImp::isKernelIsaPoolingEnabled() const {
+    // debuggers track ISA of each kernel by its own allocation
+    if (this->debugEnabled || device->getNEODevice()->getDebugger()) {
+        return false;
+    }
+    return NEO::DebugManager.flags.EnableKernelIsaPooling.get() == 1;
+}
+
+void ModuleImp::allocateKernelIsaPools() {
+    if (!isKernelIsaPoolingEnabled()) {
+        return;
+    }
+
+    // pools are allocated on the same device as dedicated ISA allocations of KernelImmutableData
+    auto neoDevice = static_cast<DeviceImp *>(device)->getActiveDevice();
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    const auto allocType = (this->type == ModuleType::Builtin) ? NEO::AllocationType::KERNEL_ISA_INTERNAL : NEO::AllocationType::KERNEL_ISA;
+    auto getPooledIsaSize = [&kernelInfos](size_t kernelId) {
+        return alignUp(static_cast<size_t>(kernelInfos[kernelId]->heapInfo.KernelHeapSize), MemoryConstants::cacheLineSize);
+    };
+
+    size_t kernelId = 0;
+    while (kernelId < kernelInfos.size()) {
+        auto firstKernelId = kernelId;
+        size_t poolSize = 0;
+        for (; kernelId < kernelInfos.size(); kernelId++) {
+            auto isaSize = getPooledIsaSize(kernelId);
+            if (poolSize != 0 && poolSize + isaSize > isaPoolMaxSize) {
+                break;
+            }
+            poolSize += isaSize;
+        }
+
+        if (kernelId - firstKernelId < 2) {
+            continue;
+        }
+
+        auto pool = neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+            {neoDevice->getRootDeviceIndex(), poolSize, allocType, neoDevice->getDeviceBitfield()});
+        if (pool == nullptr) {
+            continue;
+        }
+        isaPoolAllocations.push_back(pool);
+
+        size_t offset = 0;
+        for (auto pooledKernelId = firstKernelId; pooledKernelId < kernelId; pooledKernelId++) {
+            auto isaSize = getPooledIsaSize(pooledKernelId);
+            kernelImmDatas[pooledKernelId]->setIsaParentAllocation(pool, offset, isaSize);
+            offset += isaSize;
+        }
+    }
+}
+
+void ModuleImp::freeKernelIsaPools() {
+    for (auto pool : isaPoolAllocations) {
+        device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(pool);
+    }
+    isaPoolAllocations.clear();
+}
+
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName) {
     auto optInSrcPos = srcOptionSet.find(srcOptionName.begin());
     if (std::string::npos == optInSrcPos) {
@@ -9,6 +9,8 @@
 
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/helpers/binary_storage.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/program/program_info.h"
 
 #include "level_zero/core/source/module/module.h"
@@ -18,6 +20,8 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 namespace NEO {
 namespace Debug {
@@ -66,7 +70,7 @@ struct ModuleTranslationUnit {
     std::unique_ptr<char[]> irBinary;
     size_t irBinarySize = 0U;
 
-    std::unique_ptr<char[]> unpackedDeviceBinary;
+    NEO::UniqueBinaryPtr unpackedDeviceBinary;
     size_t unpackedDeviceBinarySize = 0U;
 
     std::unique_ptr<char[]> packedDeviceBinary;
@@ -81,6 +85,8 @@ struct ModuleTranslationUnit {
 };
 
 struct ModuleImp : public Module {
+    static constexpr size_t isaPoolMaxSize = 2 * MemoryConstants::megaByte;
+
     ModuleImp() = delete;
 
     ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType type);
@@ -151,6 +157,9 @@ struct ModuleImp : public Module {
     void notifyModuleDestroy();
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     StackVec<NEO::GraphicsAllocation *, 32> getModuleAllocations();
+    bool isKernelIsaPoolingEnabled() const;
+    void allocateKernelIsaPools();
+    void freeKernelIsaPools();
 
     Device *device = nullptr;
     PRODUCT_FAMILY productFamily{};
@@ -159,6 +168,8 @@ struct ModuleImp : public Module {
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
     uint32_t maxGroupSize = 0U;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
+    std::unordered_map<std::string_view, const KernelImmutableData *> kernelImmDatasByName;
+    std::vector<NEO::GraphicsAllocation *> isaPoolAllocations;
     NEO::Linker::RelocatedSymbolsMap symbols;
 
     struct HostGlobalSymbol {
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Measures free latency of USM allocations picked at random positions of the registered allocations.
+// Per free latency is expected to stay flat as the number of live allocations grows.
+double measureFreeLatency(ze_context_handle_t &context, ze_device_handle_t &device, ze_memory_type_t memoryType,
+                          uint32_t numAllocations, size_t allocationSize, double &maxFreeTime) {
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    std::vector<void *> allocations(numAllocations, nullptr);
+
+    for (auto &allocation : allocations) {
+        if (memoryType == ZE_MEMORY_TYPE_DEVICE) {
+            SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, allocationSize, 1, device, &allocation));
+        } else {
+            SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, allocationSize, 1, &allocation));
+        }
+    }
+
+    std::mt19937 generator(numAllocations);
+    std::shuffle(allocations.begin(), allocations.end(), generator);
+
+    maxFreeTime = 0.0;
+    auto freeStart = std::chrono::steady_clock::now();
+    for (auto &allocation : allocations) {
+        auto start = std::chrono::steady_clock::now();
+        SUCCESS_OR_TERMINATE(zeMemFree(context, allocation));
+        maxFreeTime = std::max(maxFreeTime, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    auto freeEnd = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(freeEnd - freeStart).count() / numAllocations;
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Alloc Churn";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    auto maxAllocations = static_cast<uint32_t>(getParamValue(argc, argv, "-n", "--numAllocations", 100000));
+    auto allocationSize = getBufferLength(argc, argv, 4096);
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = true;
+    for (auto memoryType : {ZE_MEMORY_TYPE_HOST, ZE_MEMORY_TYPE_DEVICE}) {
+        const char *memoryTypeName = (memoryType == ZE_MEMORY_TYPE_DEVICE) ? "device" : "host";
+        double smallestCountFreeTime = 0.0;
+        for (uint32_t numAllocations = 1000; numAllocations <= maxAllocations; numAllocations *= 10) {
+            double maxFreeTime = 0.0;
+            auto freeTime = measureFreeLatency(context, device, memoryType, numAllocations, allocationSize, maxFreeTime);
+            if (smallestCountFreeTime == 0.0) {
+                smallestCountFreeTime = freeTime;
+            }
+            std::cout << "Memory type " << memoryTypeName
+                      << ", " << numAllocations << " allocations of " << allocationSize << " bytes freed in random order\n"
+                      << "  free: " << freeTime << " us per allocation, max " << maxFreeTime << " us"
+                      << ", " << freeTime / smallestCountFreeTime << "x of 1000 allocations\n";
+            outputValidationSuccessful &= (freeTime > 0.0);
+        }
+    }
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <vector>
+
+// Measures throughput of small USM allocations and the number of graphics allocations backing them.
+// Compare runs with ExperimentalEnableUSMAllocationPool=0 and ExperimentalEnableUSMAllocationPool=1.
+bool testSmallAllocations(ze_context_handle_t &context, ze_device_handle_t &device, ze_memory_type_t memoryType,
+                          uint32_t numAllocations, size_t allocationSize) {
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    std::vector<void *> allocations(numAllocations, nullptr);
+
+    auto allocStart = std::chrono::steady_clock::now();
+    for (auto &allocation : allocations) {
+        if (memoryType == ZE_MEMORY_TYPE_DEVICE) {
+            SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, allocationSize, 1, device, &allocation));
+        } else if (memoryType == ZE_MEMORY_TYPE_HOST) {
+            SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, allocationSize, 1, &allocation));
+        } else {
+            SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, allocationSize, 1, device, &allocation));
+        }
+    }
+    auto allocEnd = std::chrono::steady_clock::now();
+
+    bool outputValidationSuccessful = true;
+    std::set<uint64_t> backingAllocationIds;
+    for (auto &allocation : allocations) {
+        ze_memory_allocation_properties_t memoryProperties = {ZE_STRUCTURE_TYPE_MEMORY_ALLOCATION_PROPERTIES};
+        SUCCESS_OR_TERMINATE(zeMemGetAllocProperties(context, allocation, &memoryProperties, nullptr));
+        outputValidationSuccessful &= (memoryProperties.type == memoryType);
+
+        void *base = nullptr;
+        size_t size = 0u;
+        SUCCESS_OR_TERMINATE(zeMemGetAddressRange(context, allocation, &base, &size));
+        outputValidationSuccessful &= (base == allocation && size >= allocationSize);
+
+        backingAllocationIds.insert(memoryProperties.id);
+    }
+
+    auto freeStart = std::chrono::steady_clock::now();
+    for (auto &allocation : allocations) {
+        SUCCESS_OR_TERMINATE(zeMemFree(context, allocation));
+    }
+    auto freeEnd = std::chrono::steady_clock::now();
+
+    auto allocTime = std::chrono::duration<double, std::micro>(allocEnd - allocStart).count();
+    auto freeTime = std::chrono::duration<double, std::micro>(freeEnd - freeStart).count();
+    const char *memoryTypeName = (memoryType == ZE_MEMORY_TYPE_DEVICE) ? "device" : ((memoryType == ZE_MEMORY_TYPE_HOST) ? "host" : "shared");
+    std::cout << "Memory type " << memoryTypeName
+              << ", " << numAllocations << " allocations of " << allocationSize << " bytes\n"
+              << "  alloc: " << allocTime / numAllocations << " us per allocation\n"
+              << "  free:  " << freeTime / numAllocations << " us per allocation\n"
+              << "  graphics allocations to make resident: " << backingAllocationIds.size() << "\n";
+
+    return outputValidationSuccessful;
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello USM Pool";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    auto numAllocations = static_cast<uint32_t>(getParamValue(argc, argv, "-n", "--numAllocations", 10000));
+    auto allocationSize = getBufferLength(argc, argv, 64);
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = true;
+    for (auto memoryType : {ZE_MEMORY_TYPE_DEVICE, ZE_MEMORY_TYPE_HOST, ZE_MEMORY_TYPE_SHARED}) {
+        outputValidationSuccessful &= testSmallAllocations(context, device, memoryType, numAllocations, allocationSize);
+    }
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+constexpr size_t smallAllocationSize = 4096;
+constexpr size_t bigAllocationSize = 17 * 4096;
+constexpr size_t customAlignment = 16 * 4096;
+
+// Fragments GPU virtual address space with holes of small and big sizes, then performs interleaved
+// device allocations and frees of mixed sizes, some of them with custom alignment.
+// Every allocation is a lookup in freed chunks, so per pair latency is expected to stay flat
+// regardless of number of holes.
+double measureAllocFreeLatency(ze_context_handle_t &context, ze_device_handle_t &device,
+                               uint32_t fragmentsCount, uint32_t allocFreePairsCount, bool &validAllocations) {
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+
+    std::vector<void *> fragments(4 * fragmentsCount, nullptr);
+    for (size_t i = 0; i < fragments.size(); i++) {
+        auto size = (i % 2) ? bigAllocationSize : smallAllocationSize;
+        SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, size, 1, device, &fragments[i]));
+    }
+    for (size_t i = 0; i < fragments.size(); i += 4) {
+        SUCCESS_OR_TERMINATE(zeMemFree(context, fragments[i]));
+        SUCCESS_OR_TERMINATE(zeMemFree(context, fragments[i + 1]));
+        fragments[i] = nullptr;
+        fragments[i + 1] = nullptr;
+    }
+
+    std::ranlux24 generator(1);
+    std::vector<void *> liveAllocations(1024, nullptr);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < allocFreePairsCount; i++) {
+        auto &allocation = liveAllocations[i % liveAllocations.size()];
+        if (allocation) {
+            SUCCESS_OR_TERMINATE(zeMemFree(context, allocation));
+        }
+
+        const auto random = generator();
+        auto size = ((random >> 1) % 3 + 1) * ((random % 2) ? smallAllocationSize : bigAllocationSize);
+        auto alignment = ((random >> 3) % 4 == 0) ? customAlignment : 1u;
+        SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, size, alignment, device, &allocation));
+        validAllocations &= (allocation != nullptr) && (reinterpret_cast<uintptr_t>(allocation) % alignment == 0);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    for (auto allocation : liveAllocations) {
+        if (allocation) {
+            SUCCESS_OR_TERMINATE(zeMemFree(context, allocation));
+        }
+    }
+    for (auto fragment : fragments) {
+        if (fragment) {
+            SUCCESS_OR_TERMINATE(zeMemFree(context, fragment));
+        }
+    }
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / allocFreePairsCount;
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello VA Fragmentation";
+    verbose = isVerbose(argc, argv);
+    bool aubMode = isAubMode(argc, argv);
+    auto maxFragments = static_cast<uint32_t>(getParamValue(argc, argv, "-f", "--fragments", 8 * 1024));
+    auto allocFreePairsCount = static_cast<uint32_t>(getParamValue(argc, argv, "-n", "--numPairs", 256 * 1024));
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    bool outputValidationSuccessful = true;
+    double fewestFragmentsTime = 0.0;
+    for (uint32_t fragmentsCount = 8; fragmentsCount <= maxFragments; fragmentsCount *= 4) {
+        auto pairTime = measureAllocFreeLatency(context, device, fragmentsCount, allocFreePairsCount, outputValidationSuccessful);
+        if (fewestFragmentsTime == 0.0) {
+            fewestFragmentsTime = pairTime;
+        }
+        std::cout << fragmentsCount << " small and " << fragmentsCount << " big holes, "
+                  << allocFreePairsCount << " interleaved allocations and frees\n"
+                  << "  alloc + free: " << pairTime << " us per pair"
+                  << ", " << pairTime / fewestFragmentsTime << "x of 8 holes\n";
+    }
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(aubMode, outputValidationSuccessful, blackBoxName);
+    outputValidationSuccessful = aubMode ? true : outputValidationSuccessful;
+    return outputValidationSuccessful ? 0 : 1;
+}
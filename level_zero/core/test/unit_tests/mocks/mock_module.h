@@ -25,7 +25,9 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass::copyPatchedSegments;
     using BaseClass::device;
     using BaseClass::exportedFunctionsSurface;
+    using BaseClass::getModuleAllocations;
     using BaseClass::importedSymbolAllocations;
+    using BaseClass::isaPoolAllocations;
     using BaseClass::isFullyLinked;
     using BaseClass::kernelImmDatas;
     using BaseClass::maxGroupSize;
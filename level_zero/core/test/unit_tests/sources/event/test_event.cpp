@@ -865,6 +865,57 @@ TEST_F(EventSynchronizeTest, GivenLongPeriodOfGpuCheckAndOneNanosecondTimeoutWhe
     EXPECT_EQ(ZE_RESULT_NOT_READY, result);
 }
 
+TEST_F(EventSynchronizeTest, givenCompletionTaskCountSetWhenHostSynchronizeExceedsSpinTimeThenWaitOnCsrIsCalledOnce) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EventHostSynchronizeSpinTime.set(0);
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    event->csr = csr.get();
+    event->setCompletionTaskCount(1u, 0u);
+
+    auto result = event->hostSynchronize(std::chrono::duration_cast<std::chrono::nanoseconds>(1ms).count());
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+    EXPECT_EQ(1u, csr->waitForCompletionWithTimeoutCalled);
+}
+
+TEST_F(EventSynchronizeTest, givenGpuHangReportedByCsrWaitWhenHostSynchronizeIsCalledThenDeviceLostIsReturned) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EventHostSynchronizeSpinTime.set(0);
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->waitForCompletionWithTimeoutReturnValue = WaitStatus::GpuHang;
+    event->csr = csr.get();
+    event->gpuHangCheckPeriod = 50000000ms;
+    event->setCompletionTaskCount(1u, 0u);
+
+    auto result = event->hostSynchronize(std::chrono::duration_cast<std::chrono::nanoseconds>(1ms).count());
+
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, result);
+}
+
+TEST_F(EventSynchronizeTest, givenCsrWaitDisabledWhenHostSynchronizeIsCalledThenWaitOnCsrIsNotCalled) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EventHostSynchronizeSpinTime.set(0);
+    DebugManager.flags.EnableEventHostSynchronizeCsrWait.set(0);
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    event->csr = csr.get();
+    event->setCompletionTaskCount(1u, 0u);
+
+    auto result = event->hostSynchronize(std::chrono::duration_cast<std::chrono::nanoseconds>(1ms).count());
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+    EXPECT_EQ(0u, csr->waitForCompletionWithTimeoutCalled);
+}
+
+TEST_F(EventSynchronizeTest, givenCompletionTaskCountSetWhenEventIsResetThenCompletionTaskCountIsCleared) {
+    event->setCompletionTaskCount(5u, 0u);
+    EXPECT_TRUE(event->canWaitForCompletionOnCsr());
+
+    event->reset();
+
+    EXPECT_EQ(Event::uninitializedTaskCount, event->getCompletionTaskCount());
+    EXPECT_FALSE(event->canWaitForCompletionOnCsr());
+}
+
 TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutZeroAndStateInitialHostSynchronizeReturnsNotReady) {
     ze_result_t result = event->hostSynchronize(0);
     EXPECT_EQ(ZE_RESULT_NOT_READY, result);
@@ -1011,6 +1062,79 @@ TEST_F(EventSynchronizeTest, givenInfiniteTimeoutWhenWaitingForTimestampEventCom
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+class DriverHostSynchronizeEventsTest : public Test<DeviceFixture> {
+  public:
+    void SetUp() override {
+        DeviceFixture::setUp();
+        ze_event_pool_desc_t eventPoolDesc = {};
+        eventPoolDesc.count = numEvents;
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+        ASSERT_NE(nullptr, eventPool);
+        for (uint32_t i = 0; i < numEvents; i++) {
+            ze_event_desc_t eventDesc = {};
+            eventDesc.index = i;
+            events[i] = std::unique_ptr<L0::Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+            eventHandles[i] = events[i]->toHandle();
+        }
+    }
+
+    void TearDown() override {
+        for (auto &event : events) {
+            event.reset(nullptr);
+        }
+        eventPool.reset(nullptr);
+        DeviceFixture::tearDown();
+    }
+
+    static constexpr uint32_t numEvents = 2;
+    std::unique_ptr<L0::EventPool> eventPool;
+    std::unique_ptr<L0::Event> events[numEvents];
+    ze_event_handle_t eventHandles[numEvents] = {};
+};
+
+TEST_F(DriverHostSynchronizeEventsTest, givenNoEventsWhenHostSynchronizeEventsIsCalledThenInvalidArgumentIsReturned) {
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, driverHandle->hostSynchronizeEvents(0u, eventHandles, true, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, driverHandle->hostSynchronizeEvents(numEvents, nullptr, true, 0u, nullptr));
+}
+
+TEST_F(DriverHostSynchronizeEventsTest, givenOneSignaledEventWhenWaitingForAnyEventThenIndexOfSignaledEventIsReturned) {
+    events[1]->hostSignal();
+
+    uint32_t signaledEventIndex = std::numeric_limits<uint32_t>::max();
+    auto result = driverHandle->hostSynchronizeEvents(numEvents, eventHandles, false, std::numeric_limits<uint64_t>::max(), &signaledEventIndex);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, signaledEventIndex);
+}
+
+TEST_F(DriverHostSynchronizeEventsTest, givenOneSignaledEventWhenWaitingForAllEventsThenNotReadyIsReturnedUntilAllAreSignaled) {
+    events[0]->hostSignal();
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, driverHandle->hostSynchronizeEvents(numEvents, eventHandles, true, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, driverHandle->hostSynchronizeEvents(numEvents, eventHandles, true, 1000u, nullptr));
+
+    events[1]->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->hostSynchronizeEvents(numEvents, eventHandles, true, std::numeric_limits<uint64_t>::max(), nullptr));
+}
+
+TEST_F(DriverHostSynchronizeEventsTest, givenEventsSignaledFromSameCsrWhenWaitingForAllEventsThenCsrIsWaitedOnceForLatestTaskCount) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EventHostSynchronizeSpinTime.set(0);
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    for (uint32_t i = 0; i < numEvents; i++) {
+        events[i]->csr = csr.get();
+        events[i]->setCompletionTaskCount(i + 1, 0u);
+    }
+
+    auto result = driverHandle->hostSynchronizeEvents(numEvents, eventHandles, true, std::chrono::duration_cast<std::chrono::nanoseconds>(1ms).count(), nullptr);
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+    EXPECT_EQ(1u, csr->waitForCompletionWithTimeoutCalled);
+}
+
 using EventPoolIPCEventResetTests = Test<DeviceFixture>;
 
 TEST_F(EventPoolIPCEventResetTests, whenOpeningIpcHandleForEventPoolCreateWithIpcFlagThenEventsInNewPoolAreNotReset) {
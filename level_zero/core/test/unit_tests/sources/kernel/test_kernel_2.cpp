@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/kernel/kernel_tuning_database.h"
 #include "shared/test/common/mocks/mock_l0_debugger.h"
 #include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/common/test_macros/test.h"
@@ -106,6 +108,127 @@ TEST_F(KernelImp, WhenSuggestingGroupSizeThenClampToMaxGroupSize) {
     EXPECT_EQ(1U, groupSize[2]);
 }
 
+TEST_F(KernelImp, givenSameGlobalSizeWhenSuggestingGroupSizeAgainThenCachedGroupSizeIsReturned) {
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    Mock<Module> module(device, nullptr);
+    module.getMaxGroupSizeResult = 256;
+
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t groupSize[3];
+    uint32_t cachedGroupSize[3];
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(1024, 4, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(1024, 4, 1, cachedGroupSize, cachedGroupSize + 1, cachedGroupSize + 2));
+    EXPECT_EQ(groupSize[0], cachedGroupSize[0]);
+    EXPECT_EQ(groupSize[1], cachedGroupSize[1]);
+    EXPECT_EQ(groupSize[2], cachedGroupSize[2]);
+    EXPECT_EQ(1u, kernel.localWorkSizeCache.getStatistics().misses);
+    EXPECT_EQ(1u, kernel.localWorkSizeCache.getStatistics().hits);
+
+    descriptor.kernelAttributes.slmInlineSize = 1024u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(1024, 4, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(2u, kernel.localWorkSizeCache.getStatistics().misses);
+
+    module.getMaxGroupSizeResult = 8;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(1024, 4, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(3u, kernel.localWorkSizeCache.getStatistics().misses);
+    EXPECT_GE(8u, groupSize[0] * groupSize[1] * groupSize[2]);
+}
+
+TEST_F(KernelImp, givenLocalWorkSizeCacheDisabledWhenSuggestingGroupSizeThenCacheIsNotUsed) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableLocalWorkSizeCache.set(0);
+
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    Mock<Module> module(device, nullptr);
+    module.getMaxGroupSizeResult = 256;
+
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t groupSize[3];
+    kernel.KernelImp::suggestGroupSize(1024, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+    kernel.KernelImp::suggestGroupSize(1024, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+    EXPECT_EQ(0u, kernel.localWorkSizeCache.getEntriesCount());
+    EXPECT_EQ(0u, kernel.localWorkSizeCache.getStatistics().hits);
+}
+
+TEST_F(KernelImp, givenWorkgroupSizeTuningEnabledAndGroupSizeStoredInTuningDatabaseWhenSuggestingGroupSizeThenStoredGroupSizeIsReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableKernelWorkgroupSizeTuning.set(1);
+    NEO::DebugManager.flags.KernelTuningDatabasePath.set("");
+
+    WhiteBox<KernelImmutableData> kernelImmData = {};
+    NEO::KernelDescriptor descriptor;
+    NEO::KernelInfo kernelInfo;
+    kernelImmData.kernelDescriptor = &descriptor;
+    kernelImmData.kernelInfo = &kernelInfo;
+
+    Mock<Module> module(device, nullptr);
+    module.getMaxGroupSizeResult = 256;
+
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelImmData;
+    kernel.module = &module;
+
+    auto kernelHash = NEO::KernelTuningDatabase::computeKernelHash(kernelInfo, device->getHwInfo());
+    auto kernelTuningDatabase = device->getNEODevice()->getExecutionEnvironment()->getKernelTuningDatabase();
+    kernelTuningDatabase->storeWorkgroupSize(kernelHash, {1024, 1, 1}, {32, 1, 1});
+    kernelTuningDatabase->storeWorkgroupSize(kernelHash, {512, 1, 1}, {512, 1, 1});
+
+    uint32_t groupSize[3];
+    kernel.KernelImp::suggestGroupSize(1024, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+    EXPECT_EQ(32U, groupSize[0]);
+    EXPECT_EQ(1U, groupSize[1]);
+    EXPECT_EQ(1U, groupSize[2]);
+
+    kernel.KernelImp::suggestGroupSize(512, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+    EXPECT_GE(256U, groupSize[0]);
+}
+
+TEST_F(KernelImp, givenLargeGrfKernelAndGroupSizeStoredInTuningDatabaseExceedingKernelMaxGroupSizeWhenSuggestingGroupSizeThenStoredGroupSizeIsNotReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableKernelWorkgroupSizeTuning.set(1);
+    NEO::DebugManager.flags.KernelTuningDatabasePath.set("");
+
+    WhiteBox<KernelImmutableData> kernelImmData = {};
+    NEO::KernelDescriptor descriptor;
+    descriptor.kernelAttributes.numGrfRequired = GrfConfig::LargeGrfNumber;
+    descriptor.kernelAttributes.simdSize = 16;
+    NEO::KernelInfo kernelInfo;
+    kernelImmData.kernelDescriptor = &descriptor;
+    kernelImmData.kernelInfo = &kernelInfo;
+
+    Mock<Module> module(device, nullptr);
+    module.getMaxGroupSizeResult = 256;
+
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelImmData;
+    kernel.module = &module;
+    EXPECT_EQ(128u, kernel.getMaxTunedGroupSize());
+
+    auto kernelHash = NEO::KernelTuningDatabase::computeKernelHash(kernelInfo, device->getHwInfo());
+    auto kernelTuningDatabase = device->getNEODevice()->getExecutionEnvironment()->getKernelTuningDatabase();
+    kernelTuningDatabase->storeWorkgroupSize(kernelHash, {1024, 1, 1}, {256, 1, 1});
+
+    size_t globalSize[3] = {1024, 1, 1};
+    size_t tunedGroupSize[3] = {0, 0, 0};
+    EXPECT_FALSE(kernel.getTunedGroupSize(globalSize, tunedGroupSize));
+
+    kernelTuningDatabase->storeWorkgroupSize(kernelHash, {1024, 1, 1}, {128, 1, 1});
+    EXPECT_TRUE(kernel.getTunedGroupSize(globalSize, tunedGroupSize));
+    EXPECT_EQ(128u, tunedGroupSize[0]);
+}
+
 class KernelImpSuggestGroupSize : public DeviceFixture, public ::testing::TestWithParam<uint32_t> {
   public:
     void SetUp() override {
@@ -805,6 +805,204 @@ TEST_F(MemoryTest, whenAllocatingDeviceMemoryAsRayTracingAllocationAddressIsIn48
     ASSERT_EQ(result, ZE_RESULT_SUCCESS);
 }
 
+TEST_F(MemoryTest, givenUsmAllocationPoolDefaultWhenAllocatingSmallDeviceMemoryThenPoolIsNotUsed) {
+    void *ptr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_result_t result = context->allocDeviceMem(device->toHandle(), &deviceDesc, 64u, 1u, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(nullptr, ptr);
+    EXPECT_FALSE(context->getUsmPoolAllocator().isEnabled());
+    EXPECT_EQ(0u, context->getUsmPoolAllocator().getPoolsCount());
+
+    result = context->freeMem(ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+}
+
+struct UsmPoolAllocatorTest : public MemoryTest {
+    void SetUp() override {
+        DebugManager.flags.ExperimentalEnableUSMAllocationPool.set(1);
+        MemoryTest::SetUp();
+    }
+
+    void *allocDevice(size_t size, size_t alignment = 1u) {
+        void *ptr = nullptr;
+        ze_device_mem_alloc_desc_t deviceDesc = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, size, alignment, &ptr));
+        return ptr;
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(UsmPoolAllocatorTest, givenSmallDeviceAllocationsWhenAllocatingThenTheyAreSuballocatedFromSinglePoolAllocation) {
+    auto svmAllocsManager = driverHandle->getSvmAllocsManager();
+    auto numAllocsBefore = svmAllocsManager->getNumAllocs();
+
+    auto ptr0 = allocDevice(64u);
+    auto ptr1 = allocDevice(100u);
+    ASSERT_NE(nullptr, ptr0);
+    ASSERT_NE(nullptr, ptr1);
+    EXPECT_NE(ptr0, ptr1);
+
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getPoolsCount());
+    EXPECT_EQ(numAllocsBefore + 1, svmAllocsManager->getNumAllocs());
+    EXPECT_EQ(svmAllocsManager->getSVMAlloc(ptr0), svmAllocsManager->getSVMAlloc(ptr1));
+    EXPECT_EQ(ContextImp::UsmPoolAllocator::defaultPoolSize, svmAllocsManager->getSVMAlloc(ptr0)->size);
+
+    auto statistics = context->getUsmPoolAllocator().getStatistics();
+    EXPECT_EQ(2u, statistics.allocationsFromPool);
+    EXPECT_EQ(1u, statistics.poolsCreated);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr0));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr1));
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getPoolsCount());
+    EXPECT_EQ(numAllocsBefore + 1, svmAllocsManager->getNumAllocs());
+}
+
+TEST_F(UsmPoolAllocatorTest, givenPooledDeviceAllocationWhenQueryingPropertiesAndAddressRangeOfInteriorPointerThenChunkIsReported) {
+    auto ptr = allocDevice(100u);
+    ASSERT_NE(nullptr, ptr);
+    auto interiorPtr = ptrOffset(ptr, 10u);
+
+    ze_memory_allocation_properties_t memoryProperties = {};
+    ze_device_handle_t deviceHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->getMemAllocProperties(interiorPtr, &memoryProperties, &deviceHandle));
+    EXPECT_EQ(ZE_MEMORY_TYPE_DEVICE, memoryProperties.type);
+    EXPECT_EQ(device->toHandle(), deviceHandle);
+
+    void *base = nullptr;
+    size_t size = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->getMemAddressRange(interiorPtr, &base, &size));
+    EXPECT_EQ(ptr, base);
+    EXPECT_EQ(100u, size);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, context->freeMem(interiorPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, context->freeMem(ptr));
+}
+
+TEST_F(UsmPoolAllocatorTest, givenAllocationAboveThresholdOrWithLargeAlignmentWhenAllocatingThenPoolIsNotUsed) {
+    auto svmAllocsManager = driverHandle->getSvmAllocsManager();
+
+    auto largePtr = allocDevice(ContextImp::UsmPoolAllocator::defaultThreshold + 1);
+    auto alignedPtr = allocDevice(64u, MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, largePtr);
+    ASSERT_NE(nullptr, alignedPtr);
+
+    EXPECT_EQ(0u, context->getUsmPoolAllocator().getPoolsCount());
+    EXPECT_FALSE(context->getUsmPoolAllocator().isInPool(largePtr));
+    EXPECT_FALSE(context->getUsmPoolAllocator().isInPool(alignedPtr));
+    EXPECT_NE(svmAllocsManager->getSVMAlloc(largePtr), svmAllocsManager->getSVMAlloc(alignedPtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(largePtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(alignedPtr));
+}
+
+TEST_F(UsmPoolAllocatorTest, givenSmallHostSharedAndDeviceAllocationsWhenAllocatingThenSeparatePoolIsUsedForEachMemoryType) {
+    auto devicePtr = allocDevice(64u);
+
+    void *hostPtr = nullptr;
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocHostMem(&hostDesc, 64u, 1u, &hostPtr));
+
+    void *sharedPtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, 64u, 1u, &sharedPtr));
+
+    EXPECT_EQ(3u, context->getUsmPoolAllocator().getPoolsCount());
+
+    ze_memory_allocation_properties_t memoryProperties = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->getMemAllocProperties(hostPtr, &memoryProperties, nullptr));
+    EXPECT_EQ(ZE_MEMORY_TYPE_HOST, memoryProperties.type);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->getMemAllocProperties(sharedPtr, &memoryProperties, nullptr));
+    EXPECT_EQ(ZE_MEMORY_TYPE_SHARED, memoryProperties.type);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(devicePtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(hostPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(sharedPtr));
+}
+
+TEST_F(UsmPoolAllocatorTest, givenFullPoolWhenAllocatingThenNewPoolIsCreatedAndReleasedAfterItBecomesEmpty) {
+    DebugManager.flags.USMAllocationPoolSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    DebugManager.flags.USMAllocationPoolThreshold.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    auto ptr0 = allocDevice(MemoryConstants::pageSize);
+    auto ptr1 = allocDevice(MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, ptr0);
+    ASSERT_NE(nullptr, ptr1);
+    EXPECT_EQ(2u, context->getUsmPoolAllocator().getPoolsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr1));
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getPoolsCount());
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getStatistics().poolsReleased);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr0));
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getPoolsCount());
+}
+
+TEST_F(UsmPoolAllocatorTest, givenCoalescedChunkLargerThanSizeClassWhenFreeingThenWholeChunkIsReturnedToPool) {
+    DebugManager.flags.USMAllocationPoolSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    DebugManager.flags.USMAllocationPoolThreshold.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    constexpr size_t chunkSize = MemoryConstants::pageSize / 8;
+    std::vector<void *> ptrs;
+    for (auto i = 0u; i < 8u; i++) {
+        ptrs.push_back(allocDevice(chunkSize));
+        ASSERT_NE(nullptr, ptrs.back());
+    }
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getPoolsCount());
+
+    for (auto i = 1u; i < 4u; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptrs[i]));
+    }
+    auto largerPtr = allocDevice(2 * chunkSize);
+    ASSERT_NE(nullptr, largerPtr);
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getPoolsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(largerPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptrs[0]));
+    for (auto i = 4u; i < 8u; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptrs[i]));
+    }
+
+    auto fullPoolPtr = allocDevice(MemoryConstants::pageSize);
+    ASSERT_NE(nullptr, fullPoolPtr);
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getPoolsCount());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(fullPoolPtr));
+}
+
+TEST_F(UsmPoolAllocatorTest, givenPooledAllocationWhenFreeingWithBlockingFreePolicyThenEnginesUsingPoolAreWaitedForBeforeChunkIsReturnedToPool) {
+    auto memoryManager = static_cast<MockMemoryManager *>(driverHandle->getMemoryManager());
+    auto ptr0 = allocDevice(64u);
+    auto ptr1 = allocDevice(64u);
+    ASSERT_NE(nullptr, ptr0);
+    ASSERT_NE(nullptr, ptr1);
+    auto poolAllocation = driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr0)->gpuAllocations.getDefaultGraphicsAllocation();
+    memoryManager->waitAllocations.reset(new MultiGraphicsAllocation(1));
+
+    memoryManager->waitForEnginesCompletionCalled = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr1));
+    EXPECT_EQ(0u, memoryManager->waitForEnginesCompletionCalled);
+
+    ze_memory_free_ext_desc_t memFreeDesc = {};
+    memFreeDesc.freePolicy = ZE_DRIVER_MEMORY_FREE_POLICY_EXT_FLAG_BLOCKING_FREE;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMemExt(&memFreeDesc, ptr0));
+    EXPECT_EQ(1u, memoryManager->waitForEnginesCompletionCalled);
+    EXPECT_EQ(poolAllocation, memoryManager->waitAllocations->getDefaultGraphicsAllocation());
+    EXPECT_EQ(1u, context->getUsmPoolAllocator().getPoolsCount());
+    memoryManager->waitAllocations.reset();
+}
+
+TEST_F(UsmPoolAllocatorTest, givenPooledAllocationWhenGettingIpcHandleThenUnsupportedFeatureIsReturned) {
+    auto ptr = allocDevice(64u);
+    ASSERT_NE(nullptr, ptr);
+
+    ze_ipc_mem_handle_t ipcHandle = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, context->getIpcMemHandle(ptr, &ipcHandle));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->freeMem(ptr));
+}
+
 struct SVMAllocsManagerSharedAllocZexPointerMock : public NEO::SVMAllocsManager {
     SVMAllocsManagerSharedAllocZexPointerMock(MemoryManager *memoryManager) : NEO::SVMAllocsManager(memoryManager, false) {}
     void *createHostUnifiedMemoryAllocation(size_t size,
@@ -1132,6 +1132,111 @@ HWTEST_F(ModuleLinkingTest, givenNotFullyLinkedModuleWhenCreatingKernelThenError
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_MODULE_UNLINKED, retVal);
 }
 
+struct ModuleKernelIsaPoolingTest : public Test<DeviceFixture> {
+    void createModule(Module &module) {
+        auto mockCompiler = new MockCompilerInterface();
+        auto rootDeviceEnvironment = neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
+        rootDeviceEnvironment->compilerInterface.reset(mockCompiler);
+
+        auto mockTranslationUnit = new MockModuleTranslationUnit(device);
+        const uint32_t kernelHeapSizes[] = {100u, 64u, 1u};
+        for (auto i = 0u; i < 3u; i++) {
+            auto kernelInfo = new KernelInfo();
+            kernelInfo->kernelDescriptor.kernelMetadata.kernelName = "kernel" + std::to_string(i);
+            kernelInfo->heapInfo.KernelHeapSize = kernelHeapSizes[i];
+            kernelInfo->heapInfo.pKernelHeap = kernelHeap;
+            mockTranslationUnit->programInfo.kernelInfos.push_back(kernelInfo);
+        }
+        module.translationUnit.reset(mockTranslationUnit);
+
+        uint8_t spirvData{};
+        ze_module_desc_t moduleDesc = {};
+        moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+        moduleDesc.pInputModule = &spirvData;
+        moduleDesc.inputSize = sizeof(spirvData);
+
+        EXPECT_EQ(ZE_RESULT_SUCCESS, module.initialize(&moduleDesc, neoDevice));
+    }
+
+    uint8_t kernelHeap[128] = {};
+};
+
+HWTEST_F(ModuleKernelIsaPoolingTest, givenIsaPoolingEnabledWhenCreatingModuleWithMultipleKernelsThenKernelIsasAreSubAllocatedFromSingleAllocation) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableKernelIsaPooling.set(1);
+
+    Module module(device, nullptr, ModuleType::User);
+    createModule(module);
+
+    ASSERT_EQ(3u, module.kernelImmDatas.size());
+    ASSERT_EQ(1u, module.isaPoolAllocations.size());
+    auto pool = module.isaPoolAllocations[0];
+    EXPECT_EQ(NEO::AllocationType::KERNEL_ISA, pool->getAllocationType());
+
+    const uint64_t expectedOffsets[] = {0u, 128u, 192u};
+    const uint32_t expectedSizes[] = {128u, 64u, 64u};
+    for (auto i = 0u; i < 3u; i++) {
+        EXPECT_EQ(pool, module.kernelImmDatas[i]->getIsaGraphicsAllocation());
+        EXPECT_EQ(expectedOffsets[i], module.kernelImmDatas[i]->getIsaOffsetInParentAllocation());
+        EXPECT_EQ(expectedSizes[i], module.kernelImmDatas[i]->getIsaSize());
+        EXPECT_TRUE(module.kernelImmDatas[i]->isIsaCopiedToAllocation());
+    }
+
+    auto allocs = module.getModuleAllocations();
+    EXPECT_EQ(1u, allocs.size());
+    EXPECT_EQ(pool, allocs[0]);
+}
+
+HWTEST_F(ModuleKernelIsaPoolingTest, givenIsaPoolingDisabledWhenCreatingModuleWithMultipleKernelsThenEachKernelHasOwnIsaAllocation) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableKernelIsaPooling.set(0);
+
+    Module module(device, nullptr, ModuleType::User);
+    createModule(module);
+
+    ASSERT_EQ(3u, module.kernelImmDatas.size());
+    EXPECT_TRUE(module.isaPoolAllocations.empty());
+    EXPECT_NE(module.kernelImmDatas[0]->getIsaGraphicsAllocation(), module.kernelImmDatas[1]->getIsaGraphicsAllocation());
+    EXPECT_NE(module.kernelImmDatas[1]->getIsaGraphicsAllocation(), module.kernelImmDatas[2]->getIsaGraphicsAllocation());
+    for (auto &kernelImmData : module.kernelImmDatas) {
+        EXPECT_EQ(0u, kernelImmData->getIsaOffsetInParentAllocation());
+    }
+    EXPECT_EQ(3u, module.getModuleAllocations().size());
+}
+
+HWTEST_F(ModuleKernelIsaPoolingTest, givenDefaultSettingsWhenCreatingModuleWithMultipleKernelsThenIsaPoolingIsNotUsed) {
+    Module module(device, nullptr, ModuleType::User);
+    createModule(module);
+
+    ASSERT_EQ(3u, module.kernelImmDatas.size());
+    EXPECT_TRUE(module.isaPoolAllocations.empty());
+    for (auto &kernelImmData : module.kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isIsaSubAllocated());
+    }
+}
+
+HWTEST_F(ModuleKernelIsaPoolingTest, givenCreatedModuleWhenGettingKernelImmutableDataByNameThenMatchingDataIsReturned) {
+    Module module(device, nullptr, ModuleType::User);
+    createModule(module);
+
+    EXPECT_EQ(module.kernelImmDatas[0].get(), module.getKernelImmutableData("kernel0"));
+    EXPECT_EQ(module.kernelImmDatas[2].get(), module.getKernelImmutableData("kernel2"));
+    EXPECT_EQ(nullptr, module.getKernelImmutableData("kernel3"));
+}
+
+HWTEST_F(ModuleKernelIsaPoolingTest, givenPrintModuleCreationStatisticsWhenCreatingModuleThenNumberOfKernelsAndIsaAllocationsIsPrinted) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableKernelIsaPooling.set(1);
+    NEO::DebugManager.flags.PrintModuleCreationStatistics.set(true);
+
+    Module module(device, nullptr, ModuleType::User);
+    testing::internal::CaptureStderr();
+    createModule(module);
+    auto output = testing::internal::GetCapturedStderr();
+
+    EXPECT_NE(std::string::npos, output.find("Module creation statistics: kernels: 3, ISA allocations: 1, creation time: "));
+}
+
 using ModulePropertyTest = Test<ModuleFixture>;
 
 TEST_F(ModulePropertyTest, whenZeModuleGetPropertiesIsCalledThenGetPropertiesIsCalled) {
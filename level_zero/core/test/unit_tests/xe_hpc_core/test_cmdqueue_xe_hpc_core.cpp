@@ -8,6 +8,7 @@
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -481,6 +482,160 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
     context->freeMem(dstPtr);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndSplitBcsMinChunkSizeWhenAppendingMemoryCopyThenOnlyEnginesForFullChunksAreUsed, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsMinChunkSize.set(4 * MemoryConstants::megaByte);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    context->allocDeviceMem(device->toHandle(),
+                            &deviceDesc,
+                            size, alignment, &srcPtr);
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    auto result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[1])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[2])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getTaskCount(), 0u);
+
+    EXPECT_EQ(1u, bcsSplit.statistics.splitCallsCount.load());
+    EXPECT_EQ(4 * MemoryConstants::megaByte, bcsSplit.statistics.bytesPerEngine[0].load());
+    EXPECT_EQ(4 * MemoryConstants::megaByte, bcsSplit.statistics.bytesPerEngine[1].load());
+    EXPECT_EQ(0u, bcsSplit.statistics.bytesPerEngine[2].load());
+    EXPECT_EQ(0u, bcsSplit.statistics.bytesPerEngine[3].load());
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndBusyEngineWhenAppendingMemoryCopyThenLeastLoadedEnginesAreUsed, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsMinChunkSize.set(4 * MemoryConstants::megaByte);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(bcsSplit.csrs.size(), 4u);
+
+    auto busyCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(bcsSplit.csrs[0]);
+    busyCsr->taskCount = *busyCsr->getTagAddress() + 10u;
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 8 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    context->allocDeviceMem(device->toHandle(),
+                            &deviceDesc,
+                            size, alignment, &srcPtr);
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    auto result = commandList0->appendMemoryCopy(dstPtr, srcPtr, size, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[0])->getTaskCount(), 0u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[1])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[2])->getTaskCount(), 1u);
+    EXPECT_EQ(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getTaskCount(), 0u);
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
+TEST(BcsSplitTest, givenEqualEngineLoadsWhenDistributingSplitThenChunksAreEqualAndAligned) {
+    BcsSplit::EngineLoads engineLoads;
+    engineLoads.resize(4, 0u);
+    BcsSplit::SplitSizes splitSizes;
+
+    BcsSplit::distributeSplit(8 * MemoryConstants::megaByte, 0x10000000, BcsSplit::defaultMinChunkSize, engineLoads, splitSizes);
+    ASSERT_EQ(4u, splitSizes.size());
+    for (auto splitSize : splitSizes) {
+        EXPECT_EQ(MemoryConstants::pageSize2Mb, splitSize);
+    }
+
+    const uint64_t baseAddress = 0x10000000 + MemoryConstants::pageSize;
+    const size_t size = 4 * MemoryConstants::megaByte;
+    BcsSplit::distributeSplit(size, baseAddress, BcsSplit::defaultMinChunkSize, engineLoads, splitSizes);
+    size_t offset = 0u;
+    for (size_t i = 0; i < splitSizes.size() - 1; i++) {
+        offset += splitSizes[i];
+        EXPECT_TRUE(isAligned(baseAddress + offset, MemoryConstants::pageSize64k));
+    }
+    EXPECT_EQ(size, offset + splitSizes[splitSizes.size() - 1]);
+}
+
+TEST(BcsSplitTest, givenCopySmallerThanMinChunkSizeWhenDistributingSplitThenWholeCopyGoesToLeastLoadedEngine) {
+    BcsSplit::EngineLoads engineLoads;
+    engineLoads.push_back(2u);
+    engineLoads.push_back(1u);
+    engineLoads.push_back(0u);
+    engineLoads.push_back(3u);
+    BcsSplit::SplitSizes splitSizes;
+
+    BcsSplit::distributeSplit(MemoryConstants::pageSize, 0u, BcsSplit::defaultMinChunkSize, engineLoads, splitSizes);
+    ASSERT_EQ(4u, splitSizes.size());
+    EXPECT_EQ(0u, splitSizes[0]);
+    EXPECT_EQ(0u, splitSizes[1]);
+    EXPECT_EQ(MemoryConstants::pageSize, splitSizes[2]);
+    EXPECT_EQ(0u, splitSizes[3]);
+}
+
+TEST(BcsSplitTest, givenDifferentEngineLoadsWhenDistributingSplitThenLessLoadedEnginesGetBiggerChunks) {
+    BcsSplit::EngineLoads engineLoads;
+    engineLoads.push_back(3u);
+    engineLoads.push_back(0u);
+    BcsSplit::SplitSizes splitSizes;
+
+    const size_t size = 16 * MemoryConstants::megaByte;
+    BcsSplit::distributeSplit(size, 0u, BcsSplit::defaultMinChunkSize, engineLoads, splitSizes);
+    ASSERT_EQ(2u, splitSizes.size());
+    EXPECT_EQ(MemoryConstants::pageSize2Mb, splitSizes[0]);
+    EXPECT_EQ(size - MemoryConstants::pageSize2Mb, splitSizes[1]);
+}
+
 HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhenAppendingMemoryCopyRegionThenSuccessIsReturned, IsXeHpcCore) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.SplitBcsCopy.set(1);
@@ -531,6 +686,63 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
     context->freeMem(dstPtr);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndMisalignedRegionOriginWhenAppendingMemoryCopyRegionThenChunksAreAlignedOnDestinationAddress, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsLoadBalancing.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::Copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(bcsSplit.cmdQs.size(), 4u);
+
+    constexpr size_t alignment = 4096u;
+    constexpr size_t size = 32 * MemoryConstants::megaByte;
+    void *srcPtr;
+    void *dstPtr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    context->allocDeviceMem(device->toHandle(),
+                            &deviceDesc,
+                            size, alignment, &srcPtr);
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    context->allocHostMem(&hostDesc, size, alignment, &dstPtr);
+
+    constexpr uint32_t width = 8 * MemoryConstants::megaByte;
+    ze_copy_region_t region = {MemoryConstants::pageSize, 1, 0, width, 1, 1};
+    const uint32_t pitch = width + 2 * MemoryConstants::pageSize;
+    auto dstSurface = ptrOffset(dstPtr, MemoryConstants::pageSize);
+
+    auto result = commandList0->appendMemoryCopyRegion(dstSurface, &region, pitch, 0, srcPtr, &region, pitch, 0, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, bcsSplit.statistics.splitCallsCount.load());
+
+    const uint64_t dstAddress = reinterpret_cast<uintptr_t>(dstSurface) + pitch + region.originX;
+    size_t offset = 0u;
+    for (size_t i = 0; i + 1 < bcsSplit.cmdQs.size(); i++) {
+        offset += static_cast<size_t>(bcsSplit.statistics.bytesPerEngine[i].load());
+        EXPECT_TRUE(isAligned(dstAddress + offset, MemoryConstants::pageSize64k));
+    }
+    EXPECT_EQ(width, offset + bcsSplit.statistics.bytesPerEngine[bcsSplit.cmdQs.size() - 1].load());
+
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
+
 HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhenAppendingMemoryCopyWithEventThenSuccessIsReturnedAndMiFlushProgrammed, IsXeHpcCore) {
     using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
 
@@ -123,23 +123,15 @@ ze_result_t LinuxFrequencyImp::osFrequencyGetState(zes_freq_state_t *pState) {
     pState->currentVoltage = -1.0;
     pState->throttleReasons = 0u;
     if (getThrottleReasonStatus()) {
-        uint32_t val = 0;
-        ze_result_t result;
-        result = pSysfsAccess->read(throttleReasonPL1File, val);
-        if (val && (result == ZE_RESULT_SUCCESS)) {
-            pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_AVE_PWR_CAP;
-        }
-        result = pSysfsAccess->read(throttleReasonPL2File, val);
-        if (val && (result == ZE_RESULT_SUCCESS)) {
-            pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_BURST_PWR_CAP;
-        }
-        result = pSysfsAccess->read(throttleReasonPL4File, val);
-        if (val && (result == ZE_RESULT_SUCCESS)) {
-            pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_CURRENT_LIMIT;
-        }
-        result = pSysfsAccess->read(throttleReasonThermalFile, val);
-        if (val && (result == ZE_RESULT_SUCCESS)) {
-            pState->throttleReasons |= ZES_FREQ_THROTTLE_REASON_FLAG_THERMAL_LIMIT;
+        // All reasons are read in one pass, so they describe the same throttling event
+        const zes_freq_throttle_reason_flags_t throttleReasons[] = {ZES_FREQ_THROTTLE_REASON_FLAG_AVE_PWR_CAP, ZES_FREQ_THROTTLE_REASON_FLAG_BURST_PWR_CAP,
+                                                                    ZES_FREQ_THROTTLE_REASON_FLAG_CURRENT_LIMIT, ZES_FREQ_THROTTLE_REASON_FLAG_THERMAL_LIMIT};
+        SysfsSnapshot snapshot;
+        pSysfsAccess->readSnapshot({throttleReasonPL1File, throttleReasonPL2File, throttleReasonPL4File, throttleReasonThermalFile}, snapshot);
+        for (size_t i = 0; i < snapshot.values.size(); i++) {
+            if (snapshot.values[i] && (snapshot.results[i] == ZE_RESULT_SUCCESS)) {
+                pState->throttleReasons |= throttleReasons[i];
+            }
         }
     }
     return ZE_RESULT_SUCCESS;
@@ -7,14 +7,18 @@
 
 #include "level_zero/tools/source/sysman/linux/fs_access.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
 #include <climits>
 
 #include <array>
 #include <cerrno>
+#include <chrono>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
 #include <unistd.h>
 
 namespace L0 {
@@ -33,13 +37,63 @@ static ze_result_t getResult(int err) {
 
 // Generic Filesystem Access
 FsAccess::FsAccess() {
+    fileHandleCacheEnabled = (NEO::DebugManager.flags.EnableSysmanFileHandleCache.get() == 1);
+}
+
+FsAccess::~FsAccess() {
+    closeCachedHandles();
 }
 
 FsAccess *FsAccess::create() {
     return new FsAccess();
 }
 
+template <typename T>
+ze_result_t FsAccess::readWithCachedHandle(const std::string &file, T &val) {
+    // sysfs regenerates file contents on every read from offset 0,
+    // so an open handle can be reread with pread without seeking
+    std::array<char, 4096> buffer;
+    ssize_t bytesRead = 0;
+    {
+        std::lock_guard<std::mutex> lock(cachedHandlesMtx);
+        auto handle = cachedHandles.find(file);
+        if (handle == cachedHandles.end()) {
+            int fd = openFunction(file.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return getResult(errno);
+            }
+            handle = cachedHandles.emplace(file, fd).first;
+        }
+        bytesRead = preadFunction(handle->second, buffer.data(), buffer.size(), 0);
+        if (bytesRead < 0) {
+            int err = errno;
+            closeFunction(handle->second);
+            cachedHandles.erase(handle);
+            return getResult(err);
+        }
+    }
+
+    std::istringstream stream(std::string(buffer.data(), bytesRead));
+    stream >> val;
+    if (stream.fail()) {
+        return getResult(errno);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void FsAccess::closeCachedHandles() {
+    std::lock_guard<std::mutex> lock(cachedHandlesMtx);
+    for (const auto &handle : cachedHandles) {
+        closeFunction(handle.second);
+    }
+    cachedHandles.clear();
+}
+
 ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
+    if (fileHandleCacheEnabled) {
+        return readWithCachedHandle(file, val);
+    }
+
     // Read a single line from text file without trailing newline
     std::ifstream fs;
 
@@ -57,6 +111,10 @@ ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
 }
 
 ze_result_t FsAccess::read(const std::string file, double &val) {
+    if (fileHandleCacheEnabled) {
+        return readWithCachedHandle(file, val);
+    }
+
     // Read a single line from text file without trailing newline
     std::ifstream fs;
 
@@ -74,6 +132,10 @@ ze_result_t FsAccess::read(const std::string file, double &val) {
 }
 
 ze_result_t FsAccess::read(const std::string file, int32_t &val) {
+    if (fileHandleCacheEnabled) {
+        return readWithCachedHandle(file, val);
+    }
+
     // Read a single line from text file without trailing newline
     std::ifstream fs;
 
@@ -91,6 +153,10 @@ ze_result_t FsAccess::read(const std::string file, int32_t &val) {
 }
 
 ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
+    if (fileHandleCacheEnabled) {
+        return readWithCachedHandle(file, val);
+    }
+
     // Read a single line from text file without trailing newline
     std::ifstream fs;
 
@@ -107,9 +173,13 @@ ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
     return ZE_RESULT_SUCCESS;
 }
 ze_result_t FsAccess::read(const std::string file, std::string &val) {
+    val.clear();
+    if (fileHandleCacheEnabled) {
+        return readWithCachedHandle(file, val);
+    }
+
     // Read a single line from text file without trailing newline
     std::ifstream fs;
-    val.clear();
 
     fs.open(file.c_str());
     if (fs.fail()) {
@@ -210,7 +280,7 @@ ze_result_t FsAccess::getFileMode(const std::string file, ::mode_t &mode) {
 ze_result_t FsAccess::readSymLink(const std::string path, std::string &val) {
     // returns the value of symlink at path
     char buf[PATH_MAX];
-    ssize_t len = ::readlink(path.c_str(), buf, PATH_MAX - 1);
+    ssize_t len = readLinkSyscall(path.c_str(), buf, PATH_MAX - 1);
     if (len < 0) {
         return getResult(errno);
     }
@@ -232,7 +302,7 @@ ze_result_t FsAccess::getRealPath(const std::string path, std::string &val) {
 
 ze_result_t FsAccess::listDirectory(const std::string path, std::vector<std::string> &list) {
     list.clear();
-    ::DIR *procDir = ::opendir(path.c_str());
+    ::DIR *procDir = openDirFunction(path.c_str());
     if (!procDir) {
         return getResult(errno);
     }
@@ -240,7 +310,7 @@ ze_result_t FsAccess::listDirectory(const std::string path, std::vector<std::str
     int err = 0;
     // readdir doesn't clear errno, so make sure it is clear
     errno = 0;
-    while (NULL != (ent = ::readdir(procDir))) {
+    while (NULL != (ent = readDirFunction(procDir))) {
         // Ignore . and ..
         std::string name = std::string(ent->d_name);
         if (!name.compare(".") || !name.compare("..")) {
@@ -251,7 +321,7 @@ ze_result_t FsAccess::listDirectory(const std::string path, std::vector<std::str
         errno = 0;
     }
     err = errno;
-    ::closedir(procDir);
+    closeDirFunction(procDir);
     // Check if in above while loop, readdir encountered any error.
     if ((err != 0) && (err != ENOENT)) {
         list.clear();
@@ -292,9 +362,13 @@ bool FsAccess::directoryExists(const std::string path) {
 const std::string ProcfsAccess::procDir = "/proc/";
 const std::string ProcfsAccess::fdDir = "/fd/";
 
+ProcfsAccess::ProcfsAccess() : procDirPath(procDir) {
+    fileNameCacheEnabled = (NEO::DebugManager.flags.EnableIncrementalProcessScan.get() == 1);
+}
+
 std::string ProcfsAccess::fullPath(const ::pid_t pid) {
     // Returns the full path for proc entry for process pid
-    return std::string(procDir + std::to_string(pid));
+    return std::string(procDirPath + std::to_string(pid));
 }
 
 std::string ProcfsAccess::fdDirPath(const ::pid_t pid) {
@@ -317,7 +391,7 @@ ze_result_t ProcfsAccess::listProcesses(std::vector<::pid_t> &list) {
     // Returns a vector with all the active process ids in the system
     list.clear();
     std::vector<std::string> dir;
-    ze_result_t result = FsAccess::listDirectory(procDir, dir);
+    ze_result_t result = FsAccess::listDirectory(procDirPath, dir);
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
@@ -331,6 +405,19 @@ ze_result_t ProcfsAccess::listProcesses(std::vector<::pid_t> &list) {
         }
         list.push_back(pid);
     }
+
+    if (fileNameCacheEnabled) {
+        // Forget processes which exited since previous scan
+        std::set<::pid_t> alive(list.begin(), list.end());
+        std::lock_guard<std::mutex> lock(fileNameCacheMtx);
+        for (auto process = fileNameCache.begin(); process != fileNameCache.end();) {
+            if (alive.find(process->first) == alive.end()) {
+                process = fileNameCache.erase(process);
+            } else {
+                ++process;
+            }
+        }
+    }
     return ZE_RESULT_SUCCESS;
 }
 
@@ -352,14 +439,72 @@ ze_result_t ProcfsAccess::getFileDescriptors(const ::pid_t pid, std::vector<int>
         }
         list.push_back(fd);
     }
+    if (fileNameCacheEnabled) {
+        updateFileNameCache(pid, list);
+    }
     return ZE_RESULT_SUCCESS;
 }
 
+void ProcfsAccess::updateFileNameCache(const ::pid_t pid, const std::vector<int> &fds) {
+    struct stat sb;
+    std::lock_guard<std::mutex> lock(fileNameCacheMtx);
+    if (statSyscall(fullPath(pid).c_str(), &sb) != 0) {
+        fileNameCache.erase(pid);
+        return;
+    }
+
+    auto &process = fileNameCache[pid];
+    int64_t changeTime = static_cast<int64_t>(sb.st_ctim.tv_sec) * 1000000000 + sb.st_ctim.tv_nsec;
+    if ((process.inode != sb.st_ino) || (process.changeTime != changeTime)) {
+        // New process or pid reused by another process
+        process.inode = sb.st_ino;
+        process.changeTime = changeTime;
+        process.fileNames.clear();
+        return;
+    }
+
+    // Keep names of descriptors which are still open
+    std::map<int, CachedFileName> fileNames;
+    for (auto fd : fds) {
+        auto fileName = process.fileNames.find(fd);
+        if (fileName != process.fileNames.end()) {
+            fileNames.emplace(fd, std::move(fileName->second));
+        }
+    }
+    process.fileNames.swap(fileNames);
+}
+
 ze_result_t ProcfsAccess::getFileName(const ::pid_t pid, const int fd, std::string &val) {
     // Given a process id and a file descriptor number
     // return full name of the open file.
     // NOTE: For sockets, the name will be of the format "socket:[nnnnnnn]"
-    return FsAccess::readSymLink(fullFdPath(pid, fd), val);
+    auto fdPath = fullFdPath(pid, fd);
+    struct stat sb;
+    // stat follows the descriptor link to the open file, so a descriptor
+    // closed and reopened under the same number is not served from cache
+    bool fileIdentified = fileNameCacheEnabled && (statSyscall(fdPath.c_str(), &sb) == 0);
+    if (fileIdentified) {
+        std::lock_guard<std::mutex> lock(fileNameCacheMtx);
+        auto process = fileNameCache.find(pid);
+        if (process != fileNameCache.end()) {
+            auto fileName = process->second.fileNames.find(fd);
+            if ((fileName != process->second.fileNames.end()) &&
+                (fileName->second.device == sb.st_dev) && (fileName->second.inode == sb.st_ino)) {
+                val = fileName->second.name;
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+    }
+
+    ze_result_t result = FsAccess::readSymLink(fdPath, val);
+    if (fileIdentified && (ZE_RESULT_SUCCESS == result)) {
+        std::lock_guard<std::mutex> lock(fileNameCacheMtx);
+        auto process = fileNameCache.find(pid);
+        if (process != fileNameCache.end()) {
+            process->second.fileNames[fd] = {val, sb.st_dev, sb.st_ino};
+        }
+    }
+    return result;
 }
 
 bool ProcfsAccess::isAlive(const ::pid_t pid) {
@@ -537,6 +682,22 @@ ze_result_t SysfsAccess::write(const std::string file, const uint64_t val) {
     return FsAccess::write(fullPath(file), stream.str());
 }
 
+ze_result_t SysfsAccess::readSnapshot(const std::vector<std::string> &files, SysfsSnapshot &snapshot) {
+    // All values share the timestamp taken before the pass, failed entries are reported per file
+    snapshot.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    snapshot.values.assign(files.size(), 0u);
+    snapshot.results.assign(files.size(), ZE_RESULT_SUCCESS);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    for (size_t i = 0; i < files.size(); i++) {
+        snapshot.results[i] = read(files[i], snapshot.values[i]);
+        if ((ZE_RESULT_SUCCESS != snapshot.results[i]) && (ZE_RESULT_SUCCESS == result)) {
+            result = snapshot.results[i];
+        }
+    }
+    return result;
+}
+
 ze_result_t SysfsAccess::scanDirEntries(const std::string path, std::vector<std::string> &list) {
     list.clear();
     return FsAccess::listDirectory(fullPath(path).c_str(), list);
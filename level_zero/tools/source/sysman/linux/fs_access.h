@@ -12,9 +12,13 @@
 #include "level_zero/ze_api.h"
 #include "level_zero/zet_api.h"
 
+#include <dirent.h>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -28,7 +32,7 @@ namespace L0 {
 class FsAccess {
   public:
     static FsAccess *create();
-    virtual ~FsAccess() = default;
+    virtual ~FsAccess();
 
     virtual ze_result_t canRead(const std::string file);
     virtual ze_result_t canWrite(const std::string file);
@@ -54,8 +58,31 @@ class FsAccess {
 
   protected:
     FsAccess();
+    template <typename T>
+    ze_result_t readWithCachedHandle(const std::string &file, T &val);
+    void closeCachedHandles();
+
     decltype(&NEO::SysCalls::access) accessSyscall = NEO::SysCalls::access;
     decltype(&stat) statSyscall = stat;
+    decltype(&::readlink) readLinkSyscall = ::readlink;
+    decltype(&NEO::SysCalls::open) openFunction = NEO::SysCalls::open;
+    decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
+    decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
+    decltype(&::opendir) openDirFunction = ::opendir;
+    decltype(&::readdir) readDirFunction = ::readdir;
+    decltype(&::closedir) closeDirFunction = ::closedir;
+
+    // Single value files are kept open and reread with pread when enabled
+    bool fileHandleCacheEnabled = false;
+    std::map<std::string, int> cachedHandles;
+    std::mutex cachedHandlesMtx;
+};
+
+// Values of several sysfs files read in one pass under a single timestamp
+struct SysfsSnapshot {
+    uint64_t timestamp = 0;
+    std::vector<uint64_t> values;
+    std::vector<ze_result_t> results;
 };
 
 class ProcfsAccess : private FsAccess {
@@ -71,7 +98,32 @@ class ProcfsAccess : private FsAccess {
     MOCKABLE_VIRTUAL void kill(const ::pid_t pid);
 
   protected:
-    ProcfsAccess() = default;
+    ProcfsAccess();
+    void updateFileNameCache(const ::pid_t pid, const std::vector<int> &fds);
+
+    // File names of descriptors resolved by previous scans. Entries are dropped when
+    // the /proc/<pid> inode or ctime changes (pid reuse) or the descriptor is closed,
+    // a name is reused only while the descriptor still refers to the same device and inode.
+    // fd directory size and mtime are not used, procfs does not update them on close and open.
+    struct CachedFileName {
+        std::string name;
+        ::dev_t device = 0;
+        ::ino_t inode = 0;
+    };
+    struct ProcessFileNames {
+        ::ino_t inode = 0;
+        int64_t changeTime = 0;
+        std::map<int, CachedFileName> fileNames;
+    };
+    using FsAccess::closeDirFunction;
+    using FsAccess::openDirFunction;
+    using FsAccess::readDirFunction;
+    using FsAccess::readLinkSyscall;
+    using FsAccess::statSyscall;
+    bool fileNameCacheEnabled = false;
+    std::map<::pid_t, ProcessFileNames> fileNameCache;
+    std::mutex fileNameCacheMtx;
+    std::string procDirPath;
 
   private:
     std::string fullPath(const ::pid_t pid);
@@ -104,6 +156,8 @@ class SysfsAccess : protected FsAccess {
     MOCKABLE_VIRTUAL ze_result_t write(const std::string file, const double val);
     ze_result_t write(const std::string file, std::vector<std::string> val);
 
+    MOCKABLE_VIRTUAL ze_result_t readSnapshot(const std::vector<std::string> &files, SysfsSnapshot &snapshot);
+
     MOCKABLE_VIRTUAL ze_result_t scanDirEntries(const std::string path, std::vector<std::string> &list);
     ze_result_t readSymLink(const std::string path, std::string &buf) override;
     ze_result_t getRealPath(const std::string path, std::string &buf) override;
@@ -12,6 +12,7 @@
 #include "level_zero/tools/source/sysman/sysman_imp.h"
 
 #include <algorithm>
+#include <chrono>
 #include <errno.h>
 #include <fcntl.h>
 #include <string.h>
@@ -21,21 +22,27 @@ const std::string PlatformMonitoringTech::baseTelemSysFS("/sys/class/intel_pmt")
 const std::string PlatformMonitoringTech::telem("telem");
 uint32_t PlatformMonitoringTech::rootDeviceTelemNodeIndex = 0;
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
-    auto offset = keyOffsetMap.find(key);
-    if (offset == keyOffsetMap.end()) {
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
-    }
-    int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
+ze_result_t PlatformMonitoringTech::readTelemetry(void *data, size_t size, uint64_t offset) {
+    std::lock_guard<std::mutex> lock(telemetryHandleMtx);
+    int fd = cachedTelemetryHandle;
     if (fd == -1) {
-        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+        fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
+        if (fd == -1) {
+            return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+        }
     }
 
     ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint32_t), baseOffset + offset->second) != sizeof(uint32_t)) {
+    if (this->preadFunction(fd, data, size, baseOffset + offset) != static_cast<ssize_t>(size)) {
         res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
 
+    if (fileHandleCacheEnabled && (ZE_RESULT_SUCCESS == res)) {
+        cachedTelemetryHandle = fd;
+        return res;
+    }
+
+    cachedTelemetryHandle = -1;
     if (this->closeFunction(fd) < 0) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
@@ -43,26 +50,63 @@ ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &v
     return res;
 }
 
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
+    auto offset = keyOffsetMap.find(key);
+    if (offset == keyOffsetMap.end()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    return readTelemetry(&value, sizeof(uint32_t), offset->second);
+}
+
 ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
     auto offset = keyOffsetMap.find(key);
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
-    int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
-    if (fd == -1) {
-        return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+    return readTelemetry(&value, sizeof(uint64_t), offset->second);
+}
+
+template <typename T>
+ze_result_t PlatformMonitoringTech::readTelemetryValues(const std::vector<std::string> &keys, std::vector<T> &values, uint64_t &timestamp) {
+    // Read the region spanning all requested keys with a single pread
+    std::vector<uint64_t> offsets;
+    offsets.reserve(keys.size());
+    for (const auto &key : keys) {
+        auto offset = keyOffsetMap.find(key);
+        if (offset == keyOffsetMap.end()) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        offsets.push_back(offset->second);
     }
 
-    ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint64_t), baseOffset + offset->second) != sizeof(uint64_t)) {
-        res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+    std::chrono::time_point<std::chrono::steady_clock> ts = std::chrono::steady_clock::now();
+    timestamp = std::chrono::duration_cast<std::chrono::microseconds>(ts.time_since_epoch()).count();
+    values.clear();
+    if (offsets.empty()) {
+        return ZE_RESULT_SUCCESS;
     }
 
-    if (this->closeFunction(fd) < 0) {
-        return ZE_RESULT_ERROR_UNKNOWN;
+    auto minMaxOffsets = std::minmax_element(offsets.begin(), offsets.end());
+    auto minOffset = *minMaxOffsets.first;
+    std::vector<uint8_t> data(static_cast<size_t>(*minMaxOffsets.second - minOffset) + sizeof(T));
+    auto result = readTelemetry(data.data(), data.size(), minOffset);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
 
-    return res;
+    values.resize(offsets.size());
+    for (size_t i = 0; i < offsets.size(); i++) {
+        memcpy(&values[i], data.data() + (offsets[i] - minOffset), sizeof(T));
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t PlatformMonitoringTech::readValues(const std::vector<std::string> &keys, std::vector<uint32_t> &values, uint64_t &timestamp) {
+    return readTelemetryValues(keys, values, timestamp);
+}
+
+ze_result_t PlatformMonitoringTech::readValues(const std::vector<std::string> &keys, std::vector<uint64_t> &values, uint64_t &timestamp) {
+    return readTelemetryValues(keys, values, timestamp);
 }
 
 bool compareTelemNodes(std::string &telemNode1, std::string &telemNode2) {
@@ -172,6 +216,7 @@ ze_result_t PlatformMonitoringTech::init(FsAccess *pFsAccess, const std::string
 
 PlatformMonitoringTech::PlatformMonitoringTech(FsAccess *pFsAccess, ze_bool_t onSubdevice,
                                                uint32_t subdeviceId) : subdeviceId(subdeviceId), isSubdevice(onSubdevice) {
+    fileHandleCacheEnabled = (NEO::DebugManager.flags.EnableSysmanFileHandleCache.get() == 1);
 }
 
 void PlatformMonitoringTech::doInitPmtObject(FsAccess *pFsAccess, uint32_t subdeviceId, PlatformMonitoringTech *pPmt,
@@ -202,6 +247,9 @@ void PlatformMonitoringTech::create(const std::vector<ze_device_handle_t> &devic
 }
 
 PlatformMonitoringTech::~PlatformMonitoringTech() {
+    if (cachedTelemetryHandle != -1) {
+        this->closeFunction(cachedTelemetryHandle);
+    }
 }
 
 } // namespace L0
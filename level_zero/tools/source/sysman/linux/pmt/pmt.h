@@ -14,6 +14,7 @@
 
 #include <fcntl.h>
 #include <map>
+#include <mutex>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -27,6 +28,8 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
 
     virtual ze_result_t readValue(const std::string key, uint32_t &value);
     virtual ze_result_t readValue(const std::string key, uint64_t &value);
+    virtual ze_result_t readValues(const std::vector<std::string> &keys, std::vector<uint32_t> &values, uint64_t &timestamp);
+    virtual ze_result_t readValues(const std::vector<std::string> &keys, std::vector<uint64_t> &values, uint64_t &timestamp);
     static ze_result_t enumerateRootTelemIndex(FsAccess *pFsAccess, std::string &gpuUpstreamPortPath);
     static void create(const std::vector<ze_device_handle_t> &deviceHandles,
                        FsAccess *pFsAccess, std::string &gpuUpstreamPortPath,
@@ -44,6 +47,14 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
     decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
 
+    ze_result_t readTelemetry(void *data, size_t size, uint64_t offset);
+    template <typename T>
+    ze_result_t readTelemetryValues(const std::vector<std::string> &keys, std::vector<T> &values, uint64_t &timestamp);
+
+    bool fileHandleCacheEnabled = false;
+    int cachedTelemetryHandle = -1;
+    std::mutex telemetryHandleMtx;
+
   private:
     static const std::string baseTelemSysFS;
     static const std::string telem;
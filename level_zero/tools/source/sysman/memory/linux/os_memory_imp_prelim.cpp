@@ -123,20 +123,24 @@ ze_result_t LinuxMemoryImp::getVFIDString(std::string &vfID) {
 ze_result_t LinuxMemoryImp::readMcChannelCounters(uint64_t &readCounters, uint64_t &writeCounters) {
     // For DG2 there are 8 memory instances each memory instance has 2 channels there are total 16 MC Channels
     uint32_t numMcChannels = 16u;
-    ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
     std::vector<std::string> nameOfCounters{"IDI_READS", "IDI_WRITES", "DISPLAY_VC1_READS"};
-    std::vector<uint64_t> counterValues(3, 0); // Will store the values of counters metioned in nameOfCounters
-    for (uint64_t counterIndex = 0; counterIndex < nameOfCounters.size(); counterIndex++) {
+    std::vector<std::string> keys;
+    for (const auto &nameOfCounter : nameOfCounters) {
         for (uint32_t mcChannelIndex = 0; mcChannelIndex < numMcChannels; mcChannelIndex++) {
-            uint64_t val = 0;
-            std::string readCounterKey = nameOfCounters[counterIndex] + "[" + std::to_string(mcChannelIndex) + "]";
-            result = pPmt->readValue(readCounterKey, val);
-            if (result != ZE_RESULT_SUCCESS) {
-                return result;
-            }
-            counterValues[counterIndex] += val;
+            keys.push_back(nameOfCounter + "[" + std::to_string(mcChannelIndex) + "]");
         }
     }
+    // All channel counters are read with a single telemetry read
+    std::vector<uint64_t> values;
+    uint64_t timestamp = 0;
+    ze_result_t result = pPmt->readValues(keys, values, timestamp);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+    std::vector<uint64_t> counterValues(3, 0); // Will store the values of counters metioned in nameOfCounters
+    for (size_t keyIndex = 0; keyIndex < values.size(); keyIndex++) {
+        counterValues[keyIndex / numMcChannels] += values[keyIndex];
+    }
     // PMT counters returns number of transactions that have occured and each tranaction is of 64 bytes
     // Multiplying 32(tranaction size) with number of transactions gives the total reads or writes in bytes
     constexpr uint64_t transactionSize = 32;
@@ -202,39 +206,29 @@ ze_result_t LinuxMemoryImp::getHbmBandwidth(uint32_t numHbmModules, zes_mem_band
     auto &hwInfo = pDevice->getNEODevice()->getHardwareInfo();
     auto productFamily = hwInfo.platform.eProductFamily;
     auto stepping = NEO::HwInfoConfig::get(productFamily)->getSteppingFromHwRevId(hwInfo);
+    // Counters of all HBM modules and the timestamp are read with a single telemetry read,
+    // to read counters from VFID 0 and HBM module 0, keys would be: VF0_HBM0_READ and VF0_HBM0_WRITE
+    std::vector<std::string> keys;
     for (auto hbmModuleIndex = 0u; hbmModuleIndex < numHbmModules; hbmModuleIndex++) {
-        uint32_t counterValue = 0;
-        // To read counters from VFID 0 and HBM module 0, key would be: VF0_HBM0_READ
-        std::string readCounterKey = vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_READ";
-        result = pPmt->readValue(readCounterKey, counterValue);
-        if (result != ZE_RESULT_SUCCESS) {
-            return result;
-        }
-        pBandwidth->readCounter += counterValue;
-
-        counterValue = 0;
-        // To write counters to VFID 0 and HBM module 0, key would be: VF0_HBM0_Write
-        std::string writeCounterKey = vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_WRITE";
-        result = pPmt->readValue(writeCounterKey, counterValue);
-        if (result != ZE_RESULT_SUCCESS) {
-            return result;
-        }
-        pBandwidth->writeCounter += counterValue;
+        keys.push_back(vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_READ");
+        keys.push_back(vfId + "_HBM" + std::to_string(hbmModuleIndex) + "_WRITE");
     }
+    keys.push_back(vfId + "_TIMESTAMP_L");
+    keys.push_back(vfId + "_TIMESTAMP_H");
 
-    uint32_t timeStampL = 0;
-    std::string timeStamp = vfId + "_TIMESTAMP_L";
-    result = pPmt->readValue(timeStamp, timeStampL);
+    std::vector<uint32_t> values;
+    uint64_t readTimestamp = 0;
+    result = pPmt->readValues(keys, values, readTimestamp);
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
-
-    uint32_t timeStampH = 0;
-    timeStamp = vfId + "_TIMESTAMP_H";
-    result = pPmt->readValue(timeStamp, timeStampH);
-    if (result != ZE_RESULT_SUCCESS) {
-        return result;
+    for (auto hbmModuleIndex = 0u; hbmModuleIndex < numHbmModules; hbmModuleIndex++) {
+        pBandwidth->readCounter += values[2 * hbmModuleIndex];
+        pBandwidth->writeCounter += values[2 * hbmModuleIndex + 1];
     }
+
+    uint32_t timeStampL = values[2 * numHbmModules];
+    uint32_t timeStampH = values[2 * numHbmModules + 1];
     pBandwidth->timestamp = timeStampH;
     pBandwidth->timestamp = (pBandwidth->timestamp << 32) | static_cast<uint64_t>(timeStampL);
 
@@ -316,6 +316,14 @@ struct Mock<FrequencySysfsAccess> : public FrequencySysfsAccess {
         return getValU32(file, val);
     }
 
+    ze_result_t read(const std::string file, uint64_t &val) override {
+        // throttle reasons are read as part of a snapshot
+        uint32_t val32 = 0;
+        auto result = read(file, val32);
+        val = val32;
+        return result;
+    }
+
     ze_result_t write(const std::string file, double val) override {
         if (isLegacy) {
             return setValLegacy(file, val);
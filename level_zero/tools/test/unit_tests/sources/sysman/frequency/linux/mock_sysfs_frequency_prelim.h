@@ -178,6 +178,14 @@ struct Mock<FrequencySysfsAccess> : public FrequencySysfsAccess {
         return ZE_RESULT_SUCCESS;
     }
 
+    ze_result_t read(const std::string file, uint64_t &val) override {
+        // throttle reasons are read as part of a snapshot
+        uint32_t val32 = 0;
+        auto result = read(file, val32);
+        val = val32;
+        return result;
+    }
+
     ze_result_t getValLegacy(const std::string file, double &val) {
         if (file.compare(minFreqFileLegacy) == 0) {
             val = mockMin;
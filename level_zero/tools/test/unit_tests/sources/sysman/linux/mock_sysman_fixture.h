@@ -158,12 +158,30 @@ class SysmanMultiDeviceFixture : public MultiDeviceFixture, public ::testing::Te
 class PublicFsAccess : public L0::FsAccess {
   public:
     using FsAccess::accessSyscall;
+    using FsAccess::cachedHandles;
+    using FsAccess::closeFunction;
+    using FsAccess::openFunction;
+    using FsAccess::preadFunction;
     using FsAccess::statSyscall;
 };
 
+class PublicProcfsAccess : public L0::ProcfsAccess {
+  public:
+    using ProcfsAccess::closeDirFunction;
+    using ProcfsAccess::fileNameCache;
+    using ProcfsAccess::openDirFunction;
+    using ProcfsAccess::procDirPath;
+    using ProcfsAccess::readDirFunction;
+    using ProcfsAccess::readLinkSyscall;
+    using ProcfsAccess::statSyscall;
+};
+
 class PublicSysfsAccess : public L0::SysfsAccess {
   public:
     using SysfsAccess::accessSyscall;
+    using SysfsAccess::closeFunction;
+    using SysfsAccess::openFunction;
+    using SysfsAccess::preadFunction;
 };
 
 } // namespace ult
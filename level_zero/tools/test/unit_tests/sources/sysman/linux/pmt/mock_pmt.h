@@ -148,6 +148,7 @@ struct Mock<PmtFsAccess> : public PmtFsAccess {
 class PublicPlatformMonitoringTech : public L0::PlatformMonitoringTech {
   public:
     PublicPlatformMonitoringTech(FsAccess *pFsAccess, ze_bool_t onSubdevice, uint32_t subdeviceId) : PlatformMonitoringTech(pFsAccess, onSubdevice, subdeviceId) {}
+    using PlatformMonitoringTech::cachedTelemetryHandle;
     using PlatformMonitoringTech::closeFunction;
     using PlatformMonitoringTech::doInitPmtObject;
     using PlatformMonitoringTech::init;
@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
 #include "mock_pmt.h"
@@ -156,6 +158,24 @@ ssize_t preadMockPmtFailure(int fd, void *buf, size_t count, off_t offset) {
     return -1;
 }
 
+static uint32_t openMockCalls = 0u;
+static uint32_t preadMockCalls = 0u;
+
+inline static int openMockCounting(const char *pathname, int flags) {
+    openMockCalls++;
+    return openMock(pathname, flags);
+}
+
+ssize_t preadMockPmtOffsetPattern(int fd, void *buf, size_t count, off_t offset) {
+    // every byte holds the low bits of its own offset
+    preadMockCalls++;
+    auto bytes = static_cast<uint8_t *>(buf);
+    for (size_t i = 0; i < count; i++) {
+        bytes[i] = static_cast<uint8_t>(offset + i);
+    }
+    return count;
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint32TypeAndOpenSysCallFailsThenreadValueFails) {
     auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
     pPmt->openFunction = openMockReturnFailure;
@@ -222,6 +242,60 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
+TEST_F(ZesPmtFixtureMultiDevice, GivenFileHandleCacheEnabledWhenCallingreadValueRepeatedlyThenTelemetryFileIsOpenedOnceAndClosedOnDestruction) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSysmanFileHandleCache.set(1);
+    openMockCalls = 0u;
+
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMockCounting;
+    pPmt->preadFunction = preadMockPmt;
+    pPmt->closeFunction = closeMockReturnFailure;
+    pPmt->keyOffsetMap = dummyKeyOffsetMap;
+
+    uint32_t val32 = 0;
+    uint64_t val64 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val32));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY", val64));
+    EXPECT_EQ(1u, openMockCalls);
+    EXPECT_EQ(fakeFileDescriptor, pPmt->cachedTelemetryHandle);
+
+    pPmt->preadFunction = preadMockPmtFailure;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, pPmt->readValue("DUMMY_KEY", val64));
+    EXPECT_EQ(-1, pPmt->cachedTelemetryHandle);
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenMultipleKeysWhenCallingreadValuesThenAllValuesAreReadWithSinglePread) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMock;
+    pPmt->preadFunction = preadMockPmtOffsetPattern;
+    pPmt->closeFunction = closeMock;
+    pPmt->keyOffsetMap = {{"KEY_A", 0x10}, {"KEY_B", 0x4}, {"KEY_C", 0x20}};
+
+    preadMockCalls = 0u;
+    uint64_t timestamp = 0;
+    std::vector<uint32_t> values32;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValues({"KEY_A", "KEY_B", "KEY_C"}, values32, timestamp));
+    EXPECT_EQ(1u, preadMockCalls);
+    EXPECT_NE(0u, timestamp);
+    ASSERT_EQ(3u, values32.size());
+    EXPECT_EQ(0x13121110u, values32[0]);
+    EXPECT_EQ(0x07060504u, values32[1]);
+    EXPECT_EQ(0x23222120u, values32[2]);
+
+    std::vector<uint64_t> values64;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValues({"KEY_C"}, values64, timestamp));
+    EXPECT_EQ(2u, preadMockCalls);
+    ASSERT_EQ(1u, values64.size());
+    EXPECT_EQ(0x2726252423222120u, values64[0]);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->readValues({"KEY_A", "SOMETHING"}, values64, timestamp));
+    pPmt->preadFunction = preadMockPmtFailure;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValues({"KEY_A"}, values64, timestamp));
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenDoingPMTInitThenPMTmapOfSubDeviceIdToPmtObjectWouldContainValidEntries) {
     std::map<uint32_t, L0::PlatformMonitoringTech *> mapOfSubDeviceIdToPmtObject;
     for (const auto &deviceHandle : deviceHandles) {
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_driver_info.h"
 #include "shared/test/common/test_macros/test.h"
 
@@ -13,6 +14,9 @@
 #include "level_zero/tools/source/sysman/ras/ras_imp.h"
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
+#include <algorithm>
+#include <fcntl.h>
+
 namespace L0 {
 namespace ult {
 
@@ -38,6 +42,164 @@ inline static int mockStatNoPermissions(const char *pathname, struct stat *sb) n
     return 0;
 }
 
+static int mockFileDescriptor = 0x40;
+static uint32_t mockOpenCalls = 0u;
+static uint32_t mockCloseCalls = 0u;
+static std::string mockFileContents;
+
+inline static int mockOpenCounting(const char *pathname, int flags) {
+    if (strcmp(pathname, "missingFile") == 0) {
+        errno = ENOENT;
+        return -1;
+    }
+    mockOpenCalls++;
+    return mockFileDescriptor;
+}
+
+inline static int mockCloseCounting(int fd) {
+    mockCloseCalls++;
+    return 0;
+}
+
+inline static ssize_t mockPreadFileContents(int fd, void *buf, size_t count, off_t offset) {
+    auto size = std::min(count, mockFileContents.size());
+    memcpy(buf, mockFileContents.data(), size);
+    return size;
+}
+
+inline static ssize_t mockPreadFailure(int fd, void *buf, size_t count, off_t offset) {
+    errno = EBUSY;
+    return -1;
+}
+
+static uint32_t readLinkCalls = 0u;
+static uint32_t statCalls = 0u;
+static uint32_t openDirCalls = 0u;
+static uint32_t readDirCalls = 0u;
+static uint32_t closeDirCalls = 0u;
+
+inline static ssize_t mockReadLinkCounting(const char *path, char *buf, size_t bufsize) noexcept {
+    readLinkCalls++;
+    return ::readlink(path, buf, bufsize);
+}
+
+inline static int mockStatCounting(const char *pathname, struct stat *sb) noexcept {
+    statCalls++;
+    return ::stat(pathname, sb);
+}
+
+inline static DIR *mockOpenDirCounting(const char *name) {
+    openDirCalls++;
+    return ::opendir(name);
+}
+
+inline static struct dirent *mockReadDirCounting(DIR *dirp) {
+    readDirCalls++;
+    return ::readdir(dirp);
+}
+
+inline static int mockCloseDirCounting(DIR *dirp) {
+    closeDirCalls++;
+    return ::closedir(dirp);
+}
+
+inline static void resetProcfsSyscallCounters() {
+    readLinkCalls = 0u;
+    statCalls = 0u;
+    openDirCalls = 0u;
+    readDirCalls = 0u;
+    closeDirCalls = 0u;
+}
+
+inline static uint32_t getProcfsSyscallCount() {
+    return readLinkCalls + statCalls + openDirCalls + readDirCalls + closeDirCalls;
+}
+
+inline static void setProcfsSyscallCounting(PublicProcfsAccess &procfsAccess) {
+    procfsAccess.readLinkSyscall = mockReadLinkCounting;
+    procfsAccess.statSyscall = mockStatCounting;
+    procfsAccess.openDirFunction = mockOpenDirCounting;
+    procfsAccess.readDirFunction = mockReadDirCounting;
+    procfsAccess.closeDirFunction = mockCloseDirCounting;
+}
+
+// Synthetic /proc tree with every process holding one render node descriptor
+class SyntheticProcfsTree {
+  public:
+    SyntheticProcfsTree(uint32_t numProcesses, uint32_t numFds) {
+        std::string rootTemplate = ::testing::TempDir() + "procfs_scan_XXXXXX";
+        root = std::string(mkdtemp(&rootTemplate[0])) + "/";
+        renderNode = addTarget("renderD128");
+        for (int fd = 0; fd < static_cast<int>(numFds); fd++) {
+            addTarget("file" + std::to_string(fd));
+        }
+        for (::pid_t pid = 1; pid <= static_cast<::pid_t>(numProcesses); pid++) {
+            mkdir((root + std::to_string(pid)).c_str(), 0700);
+            mkdir((root + std::to_string(pid) + "/fd").c_str(), 0700);
+            for (int fd = 0; fd < static_cast<int>(numFds); fd++) {
+                addFd(pid, fd, (fd == 3) ? renderNode : root + "file" + std::to_string(fd));
+            }
+        }
+    }
+
+    ~SyntheticProcfsTree() {
+        for (const auto &link : links) {
+            unlink(link.c_str());
+        }
+        for (auto pid : pids) {
+            rmdir((root + std::to_string(pid) + "/fd").c_str());
+            rmdir((root + std::to_string(pid)).c_str());
+        }
+        for (const auto &target : targets) {
+            unlink(target.c_str());
+        }
+        rmdir(root.c_str());
+    }
+
+    std::string addTarget(const std::string &name) {
+        auto target = root + name;
+        std::ofstream(target.c_str()).close();
+        targets.insert(target);
+        return target;
+    }
+
+    void addFd(::pid_t pid, int fd, const std::string &target) {
+        auto link = root + std::to_string(pid) + "/fd/" + std::to_string(fd);
+        EXPECT_EQ(0, symlink(target.c_str(), link.c_str()));
+        links.insert(link);
+        pids.insert(pid);
+    }
+
+    void removeFd(::pid_t pid, int fd) {
+        auto link = root + std::to_string(pid) + "/fd/" + std::to_string(fd);
+        unlink(link.c_str());
+        links.erase(link);
+    }
+
+    uint32_t scan(ProcfsAccess &procfsAccess) {
+        // Same walk as done by device reset, returns number of descriptors pointing to render node
+        uint32_t renderNodeFds = 0u;
+        std::vector<::pid_t> processes;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, procfsAccess.listProcesses(processes));
+        for (auto pid : processes) {
+            std::vector<int> fds;
+            EXPECT_EQ(ZE_RESULT_SUCCESS, procfsAccess.getFileDescriptors(pid, fds));
+            for (auto fd : fds) {
+                std::string file;
+                EXPECT_EQ(ZE_RESULT_SUCCESS, procfsAccess.getFileName(pid, fd, file));
+                renderNodeFds += (file == renderNode) ? 1u : 0u;
+            }
+        }
+        return renderNodeFds;
+    }
+
+    std::string root;
+    std::string renderNode;
+    std::set<std::string> links;
+    std::set<std::string> targets;
+    std::set<::pid_t> pids;
+};
+
 TEST_F(SysmanDeviceFixture, GivenValidDeviceHandleInSysmanImpCreationWhenAllSysmanInterfacesAreAssignedToNullThenExpectSysmanDeviceModuleContextsAreNull) {
     ze_device_handle_t hSysman = device->toHandle();
     SysmanDeviceImp *sysmanImp = new SysmanDeviceImp(hSysman);
@@ -243,6 +405,79 @@ TEST_F(SysmanDeviceFixture, GivenPublicFsAccessClassWhenCallingCanWriteWithInval
     delete tempFsAccess;
 }
 
+TEST_F(SysmanDeviceFixture, GivenFileHandleCacheEnabledWhenReadingFileRepeatedlyThenFileIsOpenedOnceAndCurrentValueIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSysmanFileHandleCache.set(1);
+    mockOpenCalls = 0u;
+    mockCloseCalls = 0u;
+
+    auto tempFsAccess = std::make_unique<PublicFsAccess>();
+    tempFsAccess->openFunction = mockOpenCounting;
+    tempFsAccess->closeFunction = mockCloseCounting;
+    tempFsAccess->preadFunction = mockPreadFileContents;
+
+    uint64_t val = 0;
+    mockFileContents = "1000\n";
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("someFile", val));
+    EXPECT_EQ(1000u, val);
+    mockFileContents = "2000\n";
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("someFile", val));
+    EXPECT_EQ(2000u, val);
+
+    std::string str;
+    mockFileContents = "performance\n";
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("otherFile", str));
+    EXPECT_EQ("performance", str);
+    errno = EACCES;
+    EXPECT_EQ(ZE_RESULT_ERROR_INSUFFICIENT_PERMISSIONS, tempFsAccess->read("otherFile", val));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, tempFsAccess->read("missingFile", val));
+    EXPECT_EQ(2u, mockOpenCalls);
+    EXPECT_EQ(2u, tempFsAccess->cachedHandles.size());
+    EXPECT_EQ(0u, mockCloseCalls);
+
+    tempFsAccess.reset();
+    EXPECT_EQ(2u, mockCloseCalls);
+}
+
+TEST_F(SysmanDeviceFixture, GivenFileHandleCacheEnabledWhenPreadFailsThenErrorIsReturnedAndHandleIsClosed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSysmanFileHandleCache.set(1);
+    mockCloseCalls = 0u;
+
+    auto tempFsAccess = std::make_unique<PublicFsAccess>();
+    tempFsAccess->openFunction = mockOpenCounting;
+    tempFsAccess->closeFunction = mockCloseCounting;
+    tempFsAccess->preadFunction = mockPreadFailure;
+
+    uint32_t val = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE, tempFsAccess->read("someFile", val));
+    EXPECT_TRUE(tempFsAccess->cachedHandles.empty());
+    EXPECT_EQ(1u, mockCloseCalls);
+}
+
+TEST_F(SysmanDeviceFixture, GivenSysfsAccessWhenReadingSnapshotThenAllFilesAreReadWithSingleTimestampAndFailuresAreReportedPerFile) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSysmanFileHandleCache.set(1);
+
+    auto tempSysfsAccess = std::make_unique<PublicSysfsAccess>();
+    tempSysfsAccess->openFunction = mockOpenCounting;
+    tempSysfsAccess->closeFunction = mockCloseCounting;
+    tempSysfsAccess->preadFunction = mockPreadFileContents;
+    mockFileContents = "300\n";
+
+    SysfsSnapshot snapshot;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, tempSysfsAccess->readSnapshot({"someFile", "missingFile", "otherFile"}, snapshot));
+    EXPECT_NE(0u, snapshot.timestamp);
+    ASSERT_EQ(3u, snapshot.values.size());
+    ASSERT_EQ(3u, snapshot.results.size());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, snapshot.results[0]);
+    EXPECT_EQ(300u, snapshot.values[0]);
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, snapshot.results[1]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, snapshot.results[2]);
+    EXPECT_EQ(300u, snapshot.values[2]);
+}
+
 TEST_F(SysmanDeviceFixture, GivenValidPathnameWhenCallingFsAccessExistsThenSuccessIsReturned) {
     auto fsAccess = pLinuxSysmanImp->getFsAccess();
 
@@ -278,6 +513,146 @@ TEST_F(SysmanDeviceFixture, GivenCreateProcfsAccessHandleWhenCallinggetProcfsAcc
     EXPECT_EQ(&pLinuxSysmanImp->getProcfsAccess(), pLinuxSysmanImp->pProcfsAccess);
 }
 
+TEST_F(SysmanDeviceFixture, GivenIncrementalProcessScanEnabledWhenScanningSyntheticProcfsRepeatedlyThenOnlyNewDescriptorsAreResolved) {
+    DebugManagerStateRestore restorer;
+    constexpr uint32_t numProcesses = 64u;
+    constexpr uint32_t numFds = 16u;
+    SyntheticProcfsTree tree(numProcesses, numFds);
+
+    DebugManager.flags.EnableIncrementalProcessScan.set(0);
+    auto fullScanProcfsAccess = std::make_unique<PublicProcfsAccess>();
+    fullScanProcfsAccess->procDirPath = tree.root;
+    setProcfsSyscallCounting(*fullScanProcfsAccess);
+    EXPECT_EQ(numProcesses, tree.scan(*fullScanProcfsAccess));
+    resetProcfsSyscallCounters();
+    EXPECT_EQ(numProcesses, tree.scan(*fullScanProcfsAccess));
+    auto fullScanSyscalls = getProcfsSyscallCount();
+    EXPECT_EQ(numProcesses + 1, openDirCalls);
+    EXPECT_EQ(numProcesses * numFds, readLinkCalls);
+
+    DebugManager.flags.EnableIncrementalProcessScan.set(1);
+    auto procfsAccess = std::make_unique<PublicProcfsAccess>();
+    procfsAccess->procDirPath = tree.root;
+    setProcfsSyscallCounting(*procfsAccess);
+
+    resetProcfsSyscallCounters();
+    EXPECT_EQ(numProcesses, tree.scan(*procfsAccess));
+    EXPECT_EQ(numProcesses + 1, openDirCalls);
+    EXPECT_EQ(numProcesses * numFds, readLinkCalls);
+    EXPECT_EQ(numProcesses * (numFds + 1), statCalls);
+
+    // Every descriptor is validated with stat instead of being resolved with readlink
+    resetProcfsSyscallCounters();
+    EXPECT_EQ(numProcesses, tree.scan(*procfsAccess));
+    EXPECT_EQ(numProcesses + 1, openDirCalls);
+    EXPECT_EQ(0u, readLinkCalls);
+    EXPECT_EQ(numProcesses * (numFds + 1), statCalls);
+    EXPECT_EQ(fullScanSyscalls + numProcesses, getProcfsSyscallCount());
+
+    tree.removeFd(1, 3);
+    tree.addFd(2, numFds, tree.renderNode);
+    resetProcfsSyscallCounters();
+    EXPECT_EQ(numProcesses, tree.scan(*procfsAccess));
+    EXPECT_EQ(1u, readLinkCalls);
+}
+
+TEST_F(SysmanDeviceFixture, GivenIncrementalProcessScanEnabledWhenDescriptorIsReopenedUnderSameNumberThenNewFileNameIsResolved) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIncrementalProcessScan.set(1);
+    SyntheticProcfsTree tree(2u, 4u);
+
+    auto procfsAccess = std::make_unique<PublicProcfsAccess>();
+    procfsAccess->procDirPath = tree.root;
+    setProcfsSyscallCounting(*procfsAccess);
+    EXPECT_EQ(2u, tree.scan(*procfsAccess));
+
+    // Same number of descriptors, the fd directory looks unchanged
+    tree.removeFd(1, 0);
+    tree.addFd(1, 0, tree.renderNode);
+    resetProcfsSyscallCounters();
+    EXPECT_EQ(3u, tree.scan(*procfsAccess));
+    EXPECT_EQ(1u, readLinkCalls);
+
+    std::string file;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, procfsAccess->getFileName(1, 0, file));
+    EXPECT_EQ(tree.renderNode, file);
+    EXPECT_EQ(1u, readLinkCalls);
+}
+
+TEST_F(SysmanDeviceFixture, GivenIncrementalProcessScanEnabledWhenDescriptorIsClosedAndAnotherIsOpenedThenDescriptorListIsUpdated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIncrementalProcessScan.set(1);
+    SyntheticProcfsTree tree(1u, 4u);
+
+    auto procfsAccess = std::make_unique<PublicProcfsAccess>();
+    procfsAccess->procDirPath = tree.root;
+    EXPECT_EQ(1u, tree.scan(*procfsAccess));
+
+    tree.removeFd(1, 3);
+    tree.addFd(1, 4, tree.renderNode);
+    std::vector<int> fds;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, procfsAccess->getFileDescriptors(1, fds));
+    std::sort(fds.begin(), fds.end());
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 4}), fds);
+    EXPECT_EQ(1u, tree.scan(*procfsAccess));
+}
+
+TEST_F(SysmanDeviceFixture, GivenIncrementalProcessScanEnabledWhenProcessIsReplacedUnderSamePidThenItsDescriptorsAreResolvedAgain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIncrementalProcessScan.set(1);
+    SyntheticProcfsTree tree(2u, 4u);
+
+    auto procfsAccess = std::make_unique<PublicProcfsAccess>();
+    procfsAccess->procDirPath = tree.root;
+    setProcfsSyscallCounting(*procfsAccess);
+    EXPECT_EQ(2u, tree.scan(*procfsAccess));
+
+    // Another process gets a /proc/<pid> entry with different ctime
+    procfsAccess->fileNameCache[2].changeTime--;
+
+    resetProcfsSyscallCounters();
+    EXPECT_EQ(2u, tree.scan(*procfsAccess));
+    EXPECT_EQ(4u, readLinkCalls);
+}
+
+TEST_F(SysmanDeviceFixture, GivenIncrementalProcessScanDisabledWhenScanningSyntheticProcfsRepeatedlyThenAllDescriptorsAreResolvedEachTime) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIncrementalProcessScan.set(0);
+    SyntheticProcfsTree tree(4u, 8u);
+
+    auto procfsAccess = std::make_unique<PublicProcfsAccess>();
+    procfsAccess->procDirPath = tree.root;
+    procfsAccess->readLinkSyscall = mockReadLinkCounting;
+
+    readLinkCalls = 0u;
+    EXPECT_EQ(4u, tree.scan(*procfsAccess));
+    EXPECT_EQ(4u, tree.scan(*procfsAccess));
+    EXPECT_EQ(2u * 4u * 8u, readLinkCalls);
+    EXPECT_TRUE(procfsAccess->fileNameCache.empty());
+}
+
+TEST_F(SysmanDeviceFixture, GivenIncrementalProcessScanEnabledWhenProcessExitsThenItsCachedFileNamesAreDropped) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableIncrementalProcessScan.set(1);
+    SyntheticProcfsTree tree(2u, 4u);
+
+    auto procfsAccess = std::make_unique<PublicProcfsAccess>();
+    procfsAccess->procDirPath = tree.root;
+    EXPECT_EQ(2u, tree.scan(*procfsAccess));
+    EXPECT_EQ(2u, procfsAccess->fileNameCache.size());
+
+    for (int fd = 0; fd < 4; fd++) {
+        tree.removeFd(2, fd);
+    }
+    rmdir((tree.root + "2/fd").c_str());
+    rmdir((tree.root + "2").c_str());
+    tree.pids.erase(2);
+
+    EXPECT_EQ(1u, tree.scan(*procfsAccess));
+    EXPECT_EQ(1u, procfsAccess->fileNameCache.size());
+    EXPECT_EQ(1u, procfsAccess->fileNameCache.count(1));
+}
+
 TEST_F(SysmanDeviceFixture, GivenValidPidWhenCallingProcfsAccessIsAliveThenSuccessIsReturned) {
     auto procfsAccess = pLinuxSysmanImp->getProcfsAccess();
 
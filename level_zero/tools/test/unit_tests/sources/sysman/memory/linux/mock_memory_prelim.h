@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "level_zero/tools/source/sysman/linux/pmt/pmt.h"
+#include "level_zero/tools/source/sysman/memory/linux/os_memory_imp_prelim.h"
+#include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace L0 {
+namespace ult {
+
+class MemoryPmt : public PlatformMonitoringTech {
+  public:
+    MemoryPmt(FsAccess *pFsAccess, ze_bool_t onSubdevice, uint32_t subdeviceId) : PlatformMonitoringTech(pFsAccess, onSubdevice, subdeviceId) {}
+    using PlatformMonitoringTech::keyOffsetMap;
+};
+
+template <>
+struct Mock<MemoryPmt> : public MemoryPmt {
+    Mock<MemoryPmt>(FsAccess *pFsAccess, ze_bool_t onSubdevice, uint32_t subdeviceId) : MemoryPmt(pFsAccess, onSubdevice, subdeviceId) {}
+
+    // Telemetry region is modelled by offset, keys are resolved through keyOffsetMap like in PlatformMonitoringTech
+    void setTelemetryValue(const std::string &key, uint64_t value) {
+        telemetry[keyOffsetMap.at(key)] = value;
+    }
+
+    template <typename T>
+    ze_result_t readMockValue(const std::string &key, T &value) {
+        auto offset = keyOffsetMap.find(key);
+        if (offset == keyOffsetMap.end()) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        value = static_cast<T>(telemetry[offset->second]);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    template <typename T>
+    ze_result_t readMockValues(const std::vector<std::string> &keys, std::vector<T> &values, uint64_t &timestamp) {
+        readValuesCalled++;
+        if (mockReadValuesResult != ZE_RESULT_SUCCESS) {
+            return mockReadValuesResult;
+        }
+        values.clear();
+        for (const auto &key : keys) {
+            auto offset = keyOffsetMap.find(key);
+            if (offset == keyOffsetMap.end()) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            readValuesOffsets.push_back(offset->second);
+            values.push_back(static_cast<T>(telemetry[offset->second]));
+        }
+        timestamp = mockTimestamp;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t readValue(const std::string key, uint32_t &value) override {
+        readValueCalled++;
+        return readMockValue(key, value);
+    }
+
+    ze_result_t readValue(const std::string key, uint64_t &value) override {
+        readValueCalled++;
+        return readMockValue(key, value);
+    }
+
+    ze_result_t readValues(const std::vector<std::string> &keys, std::vector<uint32_t> &values, uint64_t &timestamp) override {
+        return readMockValues(keys, values, timestamp);
+    }
+
+    ze_result_t readValues(const std::vector<std::string> &keys, std::vector<uint64_t> &values, uint64_t &timestamp) override {
+        return readMockValues(keys, values, timestamp);
+    }
+
+    std::map<uint64_t, uint64_t> telemetry;
+    std::vector<uint64_t> readValuesOffsets;
+    uint32_t readValueCalled = 0u;
+    uint32_t readValuesCalled = 0u;
+    uint64_t mockTimestamp = 0u;
+    ze_result_t mockReadValuesResult = ZE_RESULT_SUCCESS;
+};
+
+class PublicLinuxMemoryImp : public L0::LinuxMemoryImp {
+  public:
+    using LinuxMemoryImp::getBandwidthForDg2;
+    using LinuxMemoryImp::getHbmBandwidth;
+    using LinuxMemoryImp::pDevice;
+    using LinuxMemoryImp::pPmt;
+    using LinuxMemoryImp::pSysfsAccess;
+    using LinuxMemoryImp::readMcChannelCounters;
+};
+
+} // namespace ult
+} // namespace L0
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/hw_info_config.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/tools/source/sysman/sysman_const.h"
+#include "level_zero/tools/test/unit_tests/sources/sysman/memory/linux/mock_memory_prelim.h"
+
+#include "gtest/gtest.h"
+
+extern bool sysmanUltsEnable;
+
+namespace L0 {
+namespace ult {
+
+constexpr uint32_t numMcChannels = 16u;
+constexpr uint32_t numPvcHbmModules = 4u;
+
+class SysmanMemoryPmtFixture : public SysmanDeviceFixture {
+  protected:
+    std::unique_ptr<Mock<MemoryPmt>> pPmt;
+    PublicLinuxMemoryImp memoryImp;
+
+    void SetUp() override {
+        if (!sysmanUltsEnable) {
+            GTEST_SKIP();
+        }
+        SysmanDeviceFixture::SetUp();
+        pPmt = std::make_unique<Mock<MemoryPmt>>(&pLinuxSysmanImp->getFsAccess(), false, 0u);
+        memoryImp.pDevice = device;
+        memoryImp.pSysfsAccess = pSysfsAccess;
+        memoryImp.pPmt = pPmt.get();
+    }
+
+    void TearDown() override {
+        if (!sysmanUltsEnable) {
+            GTEST_SKIP();
+        }
+        SysmanDeviceFixture::TearDown();
+    }
+
+    void setDg2Telemetry() {
+        ASSERT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::getKeyOffsetMap("0x4f9502", pPmt->keyOffsetMap));
+        for (auto mcChannelIndex = 0u; mcChannelIndex < numMcChannels; mcChannelIndex++) {
+            auto index = "[" + std::to_string(mcChannelIndex) + "]";
+            pPmt->setTelemetryValue("IDI_READS" + index, mcChannelIndex + 1);
+            pPmt->setTelemetryValue("IDI_WRITES" + index, 2 * (mcChannelIndex + 1));
+            pPmt->setTelemetryValue("DISPLAY_VC1_READS" + index, 3);
+        }
+    }
+
+    void setPvcTelemetry(const std::string &vfId) {
+        ASSERT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::getKeyOffsetMap("0xb15a0edc", pPmt->keyOffsetMap));
+        pPmt->setTelemetryValue("VF0_VFID", vfId == "VF0" ? 1u : 0u);
+        pPmt->setTelemetryValue("VF1_VFID", vfId == "VF1" ? 1u : 0u);
+        for (auto hbmModuleIndex = 0u; hbmModuleIndex < numPvcHbmModules; hbmModuleIndex++) {
+            auto hbmModule = vfId + "_HBM" + std::to_string(hbmModuleIndex);
+            pPmt->setTelemetryValue(hbmModule + "_READ", 100u * (hbmModuleIndex + 1));
+            pPmt->setTelemetryValue(hbmModule + "_WRITE", 10u * (hbmModuleIndex + 1));
+        }
+        pPmt->setTelemetryValue(vfId + "_TIMESTAMP_L", 0x89abcdefu);
+        pPmt->setTelemetryValue(vfId + "_TIMESTAMP_H", 0x1u);
+    }
+
+    void setPvcStepping(uint32_t stepping) {
+        auto hwInfo = neoDevice->getRootDeviceEnvironment().getMutableHardwareInfo();
+        hwInfo->platform.usRevId = NEO::HwInfoConfig::get(hwInfo->platform.eProductFamily)->getHwRevIdFromStepping(stepping, *hwInfo);
+    }
+};
+
+TEST_F(SysmanMemoryPmtFixture, GivenDg2TelemetryWhenReadingMcChannelCountersThenAllCountersAreReadWithSingleReadAtXmlOffsets) {
+    setDg2Telemetry();
+
+    uint64_t readCounters = 0u;
+    uint64_t writeCounters = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, memoryImp.readMcChannelCounters(readCounters, writeCounters));
+    EXPECT_EQ(1u, pPmt->readValuesCalled);
+    EXPECT_EQ(0u, pPmt->readValueCalled);
+
+    ASSERT_EQ(3 * numMcChannels, pPmt->readValuesOffsets.size());
+    for (auto mcChannelIndex = 0u; mcChannelIndex < numMcChannels; mcChannelIndex++) {
+        EXPECT_EQ(1096u + 8u * mcChannelIndex, pPmt->readValuesOffsets[mcChannelIndex]);
+        EXPECT_EQ(1224u + 8u * mcChannelIndex, pPmt->readValuesOffsets[numMcChannels + mcChannelIndex]);
+        EXPECT_EQ(1352u + 8u * mcChannelIndex, pPmt->readValuesOffsets[2 * numMcChannels + mcChannelIndex]);
+    }
+
+    // each transaction is 32 bytes, reads are IDI_READS and DISPLAY_VC1_READS of all channels
+    constexpr uint64_t idiReads = 136u;
+    constexpr uint64_t displayVc1Reads = 48u;
+    constexpr uint64_t idiWrites = 272u;
+    EXPECT_EQ((idiReads + displayVc1Reads) * 32u, readCounters);
+    EXPECT_EQ(idiWrites * 32u, writeCounters);
+}
+
+TEST_F(SysmanMemoryPmtFixture, GivenDg2TelemetryWhenGettingDg2BandwidthThenCountersAndCaptureTimestampAreReturned) {
+    setDg2Telemetry();
+    pPmt->setTelemetryValue("MC_CAPTURE_TIMESTAMP", 500000000u);
+
+    zes_mem_bandwidth_t bandwidth = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, memoryImp.getBandwidthForDg2(&bandwidth));
+    EXPECT_EQ(1u, pPmt->readValuesCalled);
+    EXPECT_EQ(1u, pPmt->readValueCalled);
+    EXPECT_EQ(184u * 32u, bandwidth.readCounter);
+    EXPECT_EQ(272u * 32u, bandwidth.writeCounter);
+    EXPECT_EQ(5u, bandwidth.timestamp);
+    EXPECT_EQ(0u, bandwidth.maxBandwidth);
+}
+
+TEST_F(SysmanMemoryPmtFixture, GivenReadValuesFailsWhenGettingDg2BandwidthThenErrorIsReturnedAndCountersAreZero) {
+    setDg2Telemetry();
+    pPmt->mockReadValuesResult = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+
+    zes_mem_bandwidth_t bandwidth = {};
+    bandwidth.readCounter = 1u;
+    bandwidth.writeCounter = 1u;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, memoryImp.getBandwidthForDg2(&bandwidth));
+    EXPECT_EQ(0u, bandwidth.readCounter);
+    EXPECT_EQ(0u, bandwidth.writeCounter);
+    EXPECT_EQ(0u, pPmt->readValueCalled);
+}
+
+TEST_F(SysmanMemoryPmtFixture, GivenKeyMissingInTelemetryMapWhenReadingMcChannelCountersThenErrorIsReturned) {
+    ASSERT_EQ(ZE_RESULT_SUCCESS, PlatformMonitoringTech::getKeyOffsetMap("0xb15a0edc", pPmt->keyOffsetMap));
+
+    uint64_t readCounters = 0u;
+    uint64_t writeCounters = 0u;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, memoryImp.readMcChannelCounters(readCounters, writeCounters));
+}
+
+HWTEST2_F(SysmanMemoryPmtFixture, GivenPvcTelemetryWhenGettingHbmBandwidthThenAllModulesAndTimestampAreReadWithSingleReadAtXmlOffsets, IsPVC) {
+    setPvcStepping(REVISION_A0);
+    setPvcTelemetry("VF0");
+
+    zes_mem_bandwidth_t bandwidth = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, memoryImp.getHbmBandwidth(numPvcHbmModules, &bandwidth));
+    EXPECT_EQ(1u, pPmt->readValuesCalled);
+
+    std::vector<uint64_t> expectedOffsets = {92u, 96u, 104u, 108u, 312u, 316u, 328u, 332u, 168u, 172u};
+    EXPECT_EQ(expectedOffsets, pPmt->readValuesOffsets);
+
+    EXPECT_EQ(1000u, bandwidth.readCounter);
+    EXPECT_EQ(100u, bandwidth.writeCounter);
+    EXPECT_EQ(0x189abcdefu, bandwidth.timestamp);
+    // 3.2 GT/s on A0, 128 bit bus per module
+    EXPECT_EQ(static_cast<uint64_t>(memoryBusWidth) * 3200000000u * numPvcHbmModules / 8, bandwidth.maxBandwidth);
+}
+
+HWTEST2_F(SysmanMemoryPmtFixture, GivenVf1ActiveWhenGettingHbmBandwidthThenVf1CountersAreRead, IsPVC) {
+    setPvcStepping(REVISION_A0);
+    setPvcTelemetry("VF1");
+
+    zes_mem_bandwidth_t bandwidth = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, memoryImp.getHbmBandwidth(numPvcHbmModules, &bandwidth));
+
+    ASSERT_EQ(2 * numPvcHbmModules + 2, pPmt->readValuesOffsets.size());
+    EXPECT_EQ(180u, pPmt->readValuesOffsets[0]);
+    EXPECT_EQ(184u, pPmt->readValuesOffsets[1]);
+    EXPECT_EQ(256u, pPmt->readValuesOffsets[2 * numPvcHbmModules]);
+    EXPECT_EQ(260u, pPmt->readValuesOffsets[2 * numPvcHbmModules + 1]);
+    EXPECT_EQ(1000u, bandwidth.readCounter);
+    EXPECT_EQ(100u, bandwidth.writeCounter);
+    EXPECT_EQ(0x189abcdefu, bandwidth.timestamp);
+}
+
+HWTEST2_F(SysmanMemoryPmtFixture, GivenReadValuesFailsWhenGettingHbmBandwidthThenErrorIsReturned, IsPVC) {
+    setPvcStepping(REVISION_A0);
+    setPvcTelemetry("VF0");
+    pPmt->mockReadValuesResult = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+
+    zes_mem_bandwidth_t bandwidth = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, memoryImp.getHbmBandwidth(numPvcHbmModules, &bandwidth));
+    EXPECT_EQ(0u, bandwidth.readCounter);
+    EXPECT_EQ(0u, bandwidth.writeCounter);
+    EXPECT_EQ(0u, bandwidth.timestamp);
+}
+
+} // namespace ult
+} // namespace L0
@@ -59,7 +59,28 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
 }
 
 Vec3<size_t> generateWorkgroupSize(const DispatchInfo &dispatchInfo) {
-    return (dispatchInfo.getEnqueuedWorkgroupSize().x == 0) ? computeWorkgroupSize(dispatchInfo) : dispatchInfo.getEnqueuedWorkgroupSize();
+    if (dispatchInfo.getEnqueuedWorkgroupSize().x != 0) {
+        return dispatchInfo.getEnqueuedWorkgroupSize();
+    }
+    auto kernel = dispatchInfo.getKernel();
+    if (kernel == nullptr) {
+        return computeWorkgroupSize(dispatchInfo);
+    }
+
+    Vec3<size_t> lws = {0, 0, 0};
+    if (DebugManager.flags.EnableLocalWorkSizeCache.get() != 0) {
+        auto &localWorkSizeCache = kernel->getLocalWorkSizeCache();
+        LocalWorkSizeCache::Key key{dispatchInfo.getGWS(), dispatchInfo.getDim(), kernel->getSlmTotalSize(), kernel->getMaxKernelWorkGroupSize()};
+        LocalWorkSizeCache::Entry entry;
+        if (localWorkSizeCache.find(key, entry)) {
+            lws = entry.lws;
+        } else {
+            lws = localWorkSizeCache.store(key, computeWorkgroupSize(dispatchInfo)).lws;
+        }
+    } else {
+        lws = computeWorkgroupSize(dispatchInfo);
+    }
+    return kernel->getTunedWorkgroupSize(dispatchInfo.getActualWorkgroupSize(), lws);
 }
 
 Vec3<size_t> generateWorkgroupsNumber(const DispatchInfo &dispatchInfo) {
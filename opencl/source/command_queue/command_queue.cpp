@@ -21,6 +21,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/api_intercept.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_exporter.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/cl_device/cl_device.h"
@@ -1221,6 +1222,19 @@ WaitStatus CommandQueue::waitForAllEngines(bool blockedQueue, PrintfHandler *pri
 
     waitStatus = waitUntilComplete(taskCount, activeBcsStates, flushStamp->peekStamp(), false, cleanTemporaryAllocationsList, waitedOnTimestamps);
 
+    auto traceExporter = traceExporterInstance();
+    if (traceExporter && waitStatus == WaitStatus::Ready) {
+        auto &device = getDevice();
+        auto &hwHelper = HwHelper::get(device.getHardwareInfo().platform.eRenderCoreFamily);
+        traceExporter->addTimestampPackets(nodesToRelease, *device.getOSTime(), device.getDeviceInfo().profilingTimerResolution,
+                                           hwHelper.getGlobalTimeStampBits(), device.getRootDeviceIndex());
+        if (timestampPacketContainer) {
+            // nodes of the last enqueue stay in the queue until the next one, they are completed as well
+            traceExporter->addTimestampPackets(*timestampPacketContainer, *device.getOSTime(), device.getDeviceInfo().profilingTimerResolution,
+                                               hwHelper.getGlobalTimeStampBits(), device.getRootDeviceIndex());
+        }
+    }
+
     if (printfHandler) {
         if (!printfHandler->printEnqueueOutput()) {
             return WaitStatus::GpuHang;
@@ -19,6 +19,7 @@
 #include "shared/source/program/sync_buffer_handler.inl"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_exporter.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/command_queue/command_queue_hw.h"
@@ -28,6 +29,7 @@
 #include "opencl/source/event/user_event.h"
 #include "opencl/source/gtpin/gtpin_notify.h"
 #include "opencl/source/helpers/cl_blit_properties.h"
+#include "opencl/source/helpers/cl_helper.h"
 #include "opencl/source/helpers/cl_hw_helper.h"
 #include "opencl/source/helpers/cl_preemption_helper.h"
 #include "opencl/source/helpers/dispatch_info_builder.h"
@@ -203,6 +205,13 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         if (nodesCount > 0) {
             obtainNewTimestampPacketNodes(nodesCount, timestampPacketDependencies.previousEnqueueNodes, clearAllDependencies, computeCommandStreamReceiver);
             csrDeps.timestampPacketContainer.push_back(&timestampPacketDependencies.previousEnqueueNodes);
+
+            auto traceExporter = traceExporterInstance();
+            if (traceExporter) {
+                auto mainKernel = multiDispatchInfo.peekMainKernel();
+                traceExporter->setTimestampPacketsName(*timestampPacketContainer, mainKernel ? mainKernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName
+                                                                                             : cmdTypetoString(commandType));
+            }
         }
     }
 
@@ -1266,6 +1275,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueBlit(const MultiDispatchInfo &multiDisp
     obtainNewTimestampPacketNodes(1, timestampPacketDependencies.previousEnqueueNodes, clearAllDependencies, bcsCsr);
     csrDeps.timestampPacketContainer.push_back(&timestampPacketDependencies.previousEnqueueNodes);
 
+    auto traceExporter = traceExporterInstance();
+    if (traceExporter) {
+        traceExporter->setTimestampPacketsName(*timestampPacketContainer, cmdTypetoString(cmdType));
+    }
+
     if (eventBuilder.getEvent()) {
         eventBuilder.getEvent()->addTimestampPacketNodes(*timestampPacketContainer);
     }
@@ -27,6 +27,12 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
 
     ret.cacheFileExtension = ".cl_cache";
 
+    std::string maxSizeKeyName = oclRegPath;
+    maxSizeKeyName += "cl_cache_max_size";
+    std::unique_ptr<SettingsReader> maxSizeSettingsReader(SettingsReader::createOsReader(false, maxSizeKeyName));
+    auto cacheSize = maxSizeSettingsReader->getSetting(maxSizeSettingsReader->appSpecificLocation(maxSizeKeyName), static_cast<int64_t>(0));
+    ret.cacheSize = cacheSize > 0 ? static_cast<size_t>(cacheSize) : 0u;
+
     return ret;
 }
 
@@ -8,9 +8,11 @@
 #include "opencl/source/context/context.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
@@ -472,20 +474,57 @@ bool Context::isSingleDeviceContext() {
     return devices[0]->getNumGenericSubDevices() == 0 && getNumDevices() == 1;
 }
 
+size_t Context::BufferPoolAllocator::getSizeClass(size_t size) {
+    return std::max(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(size))), static_cast<size_t>(BufferPoolAllocator::chunkAlignment));
+}
+
 void Context::BufferPoolAllocator::initAggregatedSmallBuffers(Context *context) {
+    for (const auto &device : context->getDevices()) {
+        if (ImplicitScalingHelper::isImplicitScalingEnabled(device->getDeviceBitfield(), true)) {
+            return;
+        }
+    }
+    this->context = context;
+    if (DebugManager.flags.SmallBufferPoolAllocatorThreshold.get() != -1) {
+        this->threshold = static_cast<size_t>(DebugManager.flags.SmallBufferPoolAllocatorThreshold.get());
+    }
+    if (DebugManager.flags.SmallBufferPoolAllocatorPoolSize.get() != -1) {
+        this->poolSize = alignUp(static_cast<size_t>(DebugManager.flags.SmallBufferPoolAllocatorPoolSize.get()), BufferPoolAllocator::chunkAlignment);
+    }
+    this->poolSize = std::max(this->poolSize, 16 * getSizeClass(this->threshold));
+    if (DebugManager.flags.SmallBufferPoolAllocatorMaxPools.get() != -1) {
+        this->maxPoolsCount = static_cast<size_t>(DebugManager.flags.SmallBufferPoolAllocatorMaxPools.get());
+    }
+
+    auto lock = std::unique_lock<std::recursive_mutex>(this->mutex);
+    this->addBufferPool();
+}
+
+bool Context::BufferPoolAllocator::addBufferPool() {
+    if (this->context == nullptr || this->bufferPools.size() >= this->maxPoolsCount) {
+        return false;
+    }
     static constexpr cl_mem_flags flags{};
     [[maybe_unused]] cl_int errcodeRet{};
-    this->mainStorage = Buffer::create(context,
-                                       flags,
-                                       BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                       nullptr,
-                                       errcodeRet);
-    if (this->mainStorage) {
-        this->chunkAllocator.reset(new HeapAllocator(BufferPoolAllocator::startingOffset,
-                                                     BufferPoolAllocator::aggregatedSmallBuffersPoolSize,
-                                                     BufferPoolAllocator::chunkAlignment));
-        context->decRefInternal();
+    BufferPool bufferPool{};
+    bufferPool.mainStorage = Buffer::create(this->context,
+                                            flags,
+                                            this->poolSize,
+                                            nullptr,
+                                            errcodeRet);
+    if (!bufferPool.mainStorage) {
+        return false;
     }
+    // pool is owned by allocator only, buffers and sub-buffers created from it hold internal references
+    bufferPool.mainStorage->incRefInternal();
+    bufferPool.mainStorage->decRefApi();
+    bufferPool.chunkAllocator.reset(new HeapAllocator(BufferPoolAllocator::startingOffset,
+                                                      this->poolSize,
+                                                      BufferPoolAllocator::chunkAlignment));
+    this->context->decRefInternal();
+    this->bufferPools.push_back(std::move(bufferPool));
+    this->statistics.poolsCreated++;
+    return true;
 }
 
 Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryProperties &memoryProperties,
@@ -495,41 +534,92 @@ Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryPropert
                                                              void *hostPtr,
                                                              cl_int &errcodeRet) {
     errcodeRet = CL_MEM_OBJECT_ALLOCATION_FAILURE;
-    if (this->isAggregatedSmallBuffersEnabled() &&
-        this->isSizeWithinThreshold(size) &&
-        this->mainStorage) {
-        auto lock = std::unique_lock<std::mutex>(this->mutex);
+    if (!this->isAggregatedSmallBuffersEnabled() ||
+        !this->isSizeWithinThreshold(size)) {
+        return nullptr;
+    }
+    auto lock = std::unique_lock<std::recursive_mutex>(this->mutex);
+    if (this->context == nullptr) {
+        return nullptr;
+    }
+    for (auto poolIndex = 0u;; poolIndex++) {
+        if (poolIndex == this->bufferPools.size() && !this->addBufferPool()) {
+            break;
+        }
+        auto &bufferPool = this->bufferPools[poolIndex];
+        auto chunkSize = getSizeClass(size);
         cl_buffer_region bufferRegion{};
-        bufferRegion.origin = static_cast<size_t>(this->chunkAllocator->allocate(size));
+        bufferRegion.origin = static_cast<size_t>(bufferPool.chunkAllocator->allocate(chunkSize));
         if (bufferRegion.origin == 0) {
-            return nullptr;
+            continue;
         }
+        bufferPool.chunkSizes[bufferRegion.origin] = chunkSize;
         bufferRegion.origin -= BufferPoolAllocator::startingOffset;
         bufferRegion.size = size;
-        auto bufferFromPool = this->mainStorage->createSubBuffer(flags, flagsIntel, &bufferRegion, errcodeRet);
-        bufferFromPool->createFunction = this->mainStorage->createFunction;
+        auto bufferFromPool = bufferPool.mainStorage->createSubBuffer(flags, flagsIntel, &bufferRegion, errcodeRet);
+        bufferFromPool->createFunction = bufferPool.mainStorage->createFunction;
+        this->statistics.allocationsFromPool++;
         return bufferFromPool;
     }
+    this->statistics.allocationsNotFromPool++;
     return nullptr;
 }
 
-bool Context::BufferPoolAllocator::isPoolBuffer(const MemObj *buffer) const {
-    return buffer != nullptr && this->mainStorage == buffer;
+bool Context::BufferPoolAllocator::isPoolBuffer(const MemObj *buffer) {
+    if (buffer == nullptr) {
+        return false;
+    }
+    auto lock = std::unique_lock<std::recursive_mutex>(this->mutex);
+    return std::any_of(this->bufferPools.begin(), this->bufferPools.end(), [buffer](const BufferPool &bufferPool) {
+        return bufferPool.mainStorage == buffer;
+    });
 }
 
 void Context::BufferPoolAllocator::tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset, size_t size) {
-    if (this->isPoolBuffer(possiblePoolBuffer)) {
-        auto lock = std::unique_lock<std::mutex>(this->mutex);
-        DEBUG_BREAK_IF(!this->mainStorage);
-        auto internalBufferAddress = offset + BufferPoolAllocator::startingOffset;
-        this->chunkAllocator->free(internalBufferAddress, size);
+    auto lock = std::unique_lock<std::recursive_mutex>(this->mutex);
+    auto bufferPool = std::find_if(this->bufferPools.begin(), this->bufferPools.end(), [possiblePoolBuffer](const BufferPool &bufferPool) {
+        return bufferPool.mainStorage == possiblePoolBuffer;
+    });
+    if (bufferPool == this->bufferPools.end()) {
+        return;
+    }
+    auto internalBufferAddress = offset + BufferPoolAllocator::startingOffset;
+    auto chunkSize = bufferPool->chunkSizes.find(internalBufferAddress);
+    if (chunkSize == bufferPool->chunkSizes.end()) {
+        return;
+    }
+    bufferPool->chunkAllocator->free(internalBufferAddress, chunkSize->second);
+    bufferPool->chunkSizes.erase(chunkSize);
+
+    // keep the first pool alive, so a single small buffer churn does not recreate pools
+    if (bufferPool != this->bufferPools.begin() &&
+        bufferPool->chunkAllocator->getUsedSize() == 0u &&
+        bufferPool->mainStorage->getRefInternalCount() == 1) {
+        bufferPool->mainStorage->decRefInternal();
+        this->bufferPools.erase(bufferPool);
+        this->statistics.poolsReleased++;
     }
 }
 
 void Context::BufferPoolAllocator::releaseSmallBufferPool() {
-    DEBUG_BREAK_IF(!this->mainStorage);
-    delete this->mainStorage;
-    this->mainStorage = nullptr;
+    auto lock = std::unique_lock<std::recursive_mutex>(this->mutex);
+    this->statistics.print(DebugManager.flags.PrintSmallBufferPoolStatistics.get(), "Small buffer pool", "buffers");
+    for (auto &bufferPool : this->bufferPools) {
+        bufferPool.mainStorage->decRefInternal();
+        bufferPool.mainStorage = nullptr;
+    }
+    this->bufferPools.clear();
+    this->context = nullptr;
+}
+
+size_t Context::BufferPoolAllocator::getPoolsCount() {
+    auto lock = std::unique_lock<std::recursive_mutex>(this->mutex);
+    return this->bufferPools.size();
+}
+
+Context::BufferPoolAllocator::Statistics Context::BufferPoolAllocator::getStatistics() {
+    auto lock = std::unique_lock<std::recursive_mutex>(this->mutex);
+    return this->statistics;
 }
 
 } // namespace NEO
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/pool_allocation_statistics.h"
 
 #include "opencl/source/cl_device/cl_device_vector.h"
 #include "opencl/source/context/context_type.h"
@@ -22,6 +23,8 @@
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
 #include <map>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 
@@ -48,8 +51,12 @@ class Context : public BaseObject<_cl_context> {
         static constexpr auto smallBufferThreshold = 4 * KB;
         static constexpr auto chunkAlignment = 256u;
         static constexpr auto startingOffset = chunkAlignment;
+        static constexpr auto defaultMaxPoolsCount = 32u;
 
         static_assert(aggregatedSmallBuffersPoolSize > smallBufferThreshold, "Largest allowed buffer needs to fit in pool");
+
+        using Statistics = PoolAllocationStatistics;
+
         Buffer *allocateBufferFromPool(const MemoryProperties &memoryProperties,
                                        cl_mem_flags flags,
                                        cl_mem_flags_intel flagsIntel,
@@ -68,15 +75,34 @@ class Context : public BaseObject<_cl_context> {
         }
         void initAggregatedSmallBuffers(Context *context);
 
-        bool isPoolBuffer(const MemObj *buffer) const;
+        bool isPoolBuffer(const MemObj *buffer);
+        size_t getPoolsCount();
+        Statistics getStatistics();
+
+        size_t getPoolSize() const { return poolSize; }
+        size_t getThreshold() const { return threshold; }
+        static size_t getSizeClass(size_t size);
 
       protected:
+        struct BufferPool {
+            Buffer *mainStorage = nullptr;
+            std::unique_ptr<HeapAllocator> chunkAllocator;
+            // chunk allocator may return more than requested, so exact chunk sizes are kept for free
+            std::map<uint64_t, size_t> chunkSizes;
+        };
+
         inline bool isSizeWithinThreshold(size_t size) const {
-            return BufferPoolAllocator::smallBufferThreshold >= size;
+            return this->threshold >= size;
         }
-        Buffer *mainStorage{nullptr};
-        std::unique_ptr<HeapAllocator> chunkAllocator;
-        std::mutex mutex;
+        bool addBufferPool();
+
+        std::vector<BufferPool> bufferPools;
+        Context *context = nullptr;
+        size_t poolSize = aggregatedSmallBuffersPoolSize;
+        size_t threshold = smallBufferThreshold;
+        size_t maxPoolsCount = defaultMaxPoolsCount;
+        Statistics statistics;
+        std::recursive_mutex mutex;
     };
     static const cl_ulong objectMagic = 0xA4234321DC002130LL;
 
@@ -11,6 +11,7 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
@@ -22,6 +23,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/kernel/kernel_arg_descriptor_extended_vme.h"
+#include "shared/source/kernel/kernel_tuning_database.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/hw_info_config.h"
@@ -52,6 +54,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <vector>
 
 using namespace iOpenCL;
@@ -80,6 +83,8 @@ Kernel::Kernel(Program *programArg, const KernelInfo &kernelInfoArg, ClDevice &c
 }
 
 Kernel::~Kernel() {
+    localWorkSizeCache.printStatistics(DebugManager.flags.PrintLocalWorkSizeCacheStatistics.get(), kernelInfo.kernelDescriptor.kernelMetadata.kernelName);
+
     delete[] crossThreadData;
     crossThreadData = nullptr;
     crossThreadDataSize = 0;
@@ -1133,6 +1138,10 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
         performTunning = static_cast<TunningType>(DebugManager.flags.EnableKernelTunning.get());
     }
 
+    if (isWorkgroupSizeTuningEnabled()) {
+        performWorkgroupSizeTuning(lws, gws, timestampContainer);
+    }
+
     if (performTunning == TunningType::SIMPLE) {
         this->singleSubdevicePreferredInCurrentEnqueue = !this->kernelInfo.kernelDescriptor.kernelAttributes.flags.useGlobalAtomics;
 
@@ -1142,6 +1151,12 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
         auto submissionDataIt = this->kernelSubmissionMap.find(config);
         if (submissionDataIt == this->kernelSubmissionMap.end()) {
             KernelSubmissionData submissionData;
+            if (getKernelTuningDatabase()->getSingleSubdevicePreferred(getKernelTuningHash(), gws, lws, submissionData.singleSubdevicePreferred)) {
+                submissionData.status = TunningStatus::TUNNING_DONE;
+                this->singleSubdevicePreferredInCurrentEnqueue = submissionData.singleSubdevicePreferred;
+                this->kernelSubmissionMap[config] = std::move(submissionData);
+                return;
+            }
             submissionData.kernelStandardTimestamps = std::make_unique<TimestampPacketContainer>();
             submissionData.kernelSubdeviceTimestamps = std::make_unique<TimestampPacketContainer>();
             submissionData.status = TunningStatus::STANDARD_TUNNING_IN_PROGRESS;
@@ -1163,6 +1178,7 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
                 submissionData.kernelStandardTimestamps.reset();
                 submissionData.kernelSubdeviceTimestamps.reset();
                 this->singleSubdevicePreferredInCurrentEnqueue = submissionData.singleSubdevicePreferred;
+                getKernelTuningDatabase()->storeSingleSubdevicePreferred(getKernelTuningHash(), gws, lws, submissionData.singleSubdevicePreferred);
             } else {
                 this->singleSubdevicePreferredInCurrentEnqueue = false;
             }
@@ -1207,6 +1223,115 @@ bool Kernel::hasRunFinished(TimestampPacketContainer *timestampContainer) {
     return true;
 }
 
+bool Kernel::isWorkgroupSizeTuningEnabled() const {
+    return DebugManager.flags.EnableKernelWorkgroupSizeTuning.get() == 1 &&
+           !this->isBuiltIn &&
+           this->kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[0] == 0;
+}
+
+std::vector<Vec3<size_t>> Kernel::getWorkgroupSizeTuningCandidates(const Vec3<size_t> &gws, const Vec3<size_t> &defaultLws) const {
+    std::vector<Vec3<size_t>> candidates = {defaultLws};
+    const size_t maxWorkGroupSize = this->getMaxKernelWorkGroupSize();
+    const size_t remainingDimsSize = defaultLws.y * defaultLws.z;
+
+    for (size_t lwsX = std::max(this->kernelInfo.getMaxSimdSize(), 1u); lwsX * remainingDimsSize <= maxWorkGroupSize; lwsX *= 2) {
+        if (candidates.size() == maxWorkgroupSizeTuningCandidates) {
+            break;
+        }
+        Vec3<size_t> candidate = {lwsX, defaultLws.y, defaultLws.z};
+        if (gws.x % lwsX == 0 && candidate != defaultLws) {
+            candidates.push_back(candidate);
+        }
+    }
+    return candidates;
+}
+
+Vec3<size_t> Kernel::getTunedWorkgroupSize(const Vec3<size_t> &gws, const Vec3<size_t> &defaultLws) {
+    if (!isWorkgroupSizeTuningEnabled()) {
+        return defaultLws;
+    }
+
+    KernelConfig config{gws, {0, 0, 0}, {0, 0, 0}};
+    auto tuningDataIt = this->workgroupSizeTuningMap.find(config);
+    if (tuningDataIt == this->workgroupSizeTuningMap.end()) {
+        WorkgroupSizeTuningData tuningData;
+        Vec3<size_t> persistedLws = {0, 0, 0};
+        if (getKernelTuningDatabase()->getWorkgroupSize(getKernelTuningHash(), gws, persistedLws) &&
+            persistedLws.x * persistedLws.y * persistedLws.z <= this->getMaxKernelWorkGroupSize() &&
+            gws.x % persistedLws.x == 0 && gws.y % persistedLws.y == 0 && gws.z % persistedLws.z == 0) {
+            tuningData.tunedLws = persistedLws;
+            tuningData.tunningFinished = true;
+        } else {
+            tuningData.candidates = getWorkgroupSizeTuningCandidates(gws, defaultLws);
+            tuningData.tunedLws = defaultLws;
+            tuningData.tunningFinished = tuningData.candidates.size() < 2;
+        }
+        tuningDataIt = this->workgroupSizeTuningMap.emplace(config, std::move(tuningData)).first;
+    }
+
+    auto &tuningData = tuningDataIt->second;
+    if (!tuningData.tunningFinished && tuningData.candidateTimestamps.size() < tuningData.candidates.size()) {
+        return tuningData.candidates[tuningData.candidateTimestamps.size()];
+    }
+    return tuningData.tunedLws;
+}
+
+void Kernel::performWorkgroupSizeTuning(const Vec3<size_t> &lws, const Vec3<size_t> &gws, TimestampPacketContainer *timestampContainer) {
+    KernelConfig config{gws, {0, 0, 0}, {0, 0, 0}};
+    auto tuningDataIt = this->workgroupSizeTuningMap.find(config);
+    if (tuningDataIt == this->workgroupSizeTuningMap.end() || tuningDataIt->second.tunningFinished) {
+        return;
+    }
+
+    auto &tuningData = tuningDataIt->second;
+    if (timestampContainer == nullptr) {
+        tuningData.tunningFinished = true;
+        return;
+    }
+
+    auto submittedCandidates = tuningData.candidateTimestamps.size();
+    if (submittedCandidates < tuningData.candidates.size()) {
+        if (lws == tuningData.candidates[submittedCandidates]) {
+            auto timestamps = std::make_unique<TimestampPacketContainer>();
+            timestamps->assignAndIncrementNodesRefCounts(*timestampContainer);
+            tuningData.candidateTimestamps.push_back(std::move(timestamps));
+        }
+        return;
+    }
+
+    for (auto &timestamps : tuningData.candidateTimestamps) {
+        if (!this->hasRunFinished(timestamps.get())) {
+            return;
+        }
+    }
+
+    uint64_t bestDuration = std::numeric_limits<uint64_t>::max();
+    for (size_t i = 0; i < tuningData.candidates.size(); i++) {
+        uint64_t globalStartTS = 0u;
+        uint64_t globalEndTS = 0u;
+        Event::getBoundaryTimestampValues(tuningData.candidateTimestamps[i].get(), globalStartTS, globalEndTS);
+        if (globalEndTS - globalStartTS < bestDuration) {
+            bestDuration = globalEndTS - globalStartTS;
+            tuningData.tunedLws = tuningData.candidates[i];
+        }
+    }
+    tuningData.tunningFinished = true;
+    tuningData.candidateTimestamps.clear();
+
+    getKernelTuningDatabase()->storeWorkgroupSize(getKernelTuningHash(), gws, tuningData.tunedLws);
+}
+
+KernelTuningDatabase *Kernel::getKernelTuningDatabase() const {
+    return this->clDevice.getExecutionEnvironment()->getKernelTuningDatabase();
+}
+
+uint64_t Kernel::getKernelTuningHash() {
+    if (this->kernelTuningHash == 0u) {
+        this->kernelTuningHash = KernelTuningDatabase::computeKernelHash(this->kernelInfo, this->getHardwareInfo());
+    }
+    return this->kernelTuningHash;
+}
+
 bool Kernel::isSingleSubdevicePreferred() const {
     return this->singleSubdevicePreferredInCurrentEnqueue || this->usesSyncBuffer();
 }
@@ -2206,6 +2331,7 @@ void Kernel::reconfigureKernel() {
         kernelDescriptor.kernelAttributes.simdSize != 32) {
         maxKernelWorkGroupSize >>= 1;
     }
+    this->localWorkSizeCache.invalidate();
     this->containsStatelessWrites = kernelDescriptor.kernelAttributes.flags.usesStatelessWrites;
     this->systolicPipelineSelectMode = kernelDescriptor.kernelAttributes.flags.usesSystolicPipelineSelectMode;
 }
@@ -12,6 +12,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/address_patch.h"
+#include "shared/source/helpers/local_work_size_cache.h"
 #include "shared/source/helpers/preamble.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/kernel/implicit_args.h"
@@ -40,6 +41,7 @@ class CommandQueue;
 class CommandStreamReceiver;
 class GraphicsAllocation;
 class ImageTransformer;
+class KernelTuningDatabase;
 class Surface;
 class PrintfHandler;
 class MultiDeviceKernel;
@@ -297,6 +299,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     bool requiresSystolicPipelineSelectMode() const { return systolicPipelineSelectMode; }
 
     void performKernelTuning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer);
+    Vec3<size_t> getTunedWorkgroupSize(const Vec3<size_t> &gws, const Vec3<size_t> &defaultLws);
+    LocalWorkSizeCache &getLocalWorkSizeCache() { return localWorkSizeCache; }
     MOCKABLE_VIRTUAL bool isSingleSubdevicePreferred() const;
     void setInlineSamplers();
 
@@ -455,6 +459,13 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         TunningStatus status;
         bool singleSubdevicePreferred = false;
     };
+    struct WorkgroupSizeTuningData {
+        std::vector<Vec3<size_t>> candidates;
+        std::vector<std::unique_ptr<TimestampPacketContainer>> candidateTimestamps;
+        Vec3<size_t> tunedLws = {0, 0, 0};
+        bool tunningFinished = false;
+    };
+    static constexpr size_t maxWorkgroupSizeTuningCandidates = 8u;
 
     Kernel(Program *programArg, const KernelInfo &kernelInfo, ClDevice &clDevice);
 
@@ -484,12 +495,20 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     bool hasTunningFinished(KernelSubmissionData &submissionData);
     bool hasRunFinished(TimestampPacketContainer *timestampContainer);
+    bool isWorkgroupSizeTuningEnabled() const;
+    void performWorkgroupSizeTuning(const Vec3<size_t> &lws, const Vec3<size_t> &gws, TimestampPacketContainer *timestampContainer);
+    std::vector<Vec3<size_t>> getWorkgroupSizeTuningCandidates(const Vec3<size_t> &gws, const Vec3<size_t> &defaultLws) const;
+    KernelTuningDatabase *getKernelTuningDatabase() const;
+    uint64_t getKernelTuningHash();
 
     UnifiedMemoryControls unifiedMemoryControls{};
 
     std::map<uint32_t, MemObj *> migratableArgsMap{};
 
     std::unordered_map<KernelConfig, KernelSubmissionData, KernelConfigHash> kernelSubmissionMap;
+    std::unordered_map<KernelConfig, WorkgroupSizeTuningData, KernelConfigHash> workgroupSizeTuningMap;
+    uint64_t kernelTuningHash = 0u;
+    LocalWorkSizeCache localWorkSizeCache;
 
     std::vector<SimpleKernelArgInfo> kernelArguments;
     std::vector<KernelArgHandler> kernelArgHandlers;
@@ -618,6 +618,9 @@ Buffer *Buffer::createSubBuffer(cl_mem_flags flags,
         regionWithAdditionalOffset.origin += this->offset;
         auto buffer = poolBuffer->createSubBuffer(flags, flagsIntel, &regionWithAdditionalOffset, errcodeRet);
         buffer->isSubBufferFromPool = true;
+        // region of this buffer in the pool must not be reused while the sub-buffer exists
+        buffer->subBufferFromPoolParent = this;
+        this->incRefInternal();
         return buffer;
     }
     MemoryProperties memoryProperties =
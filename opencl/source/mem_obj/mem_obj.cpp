@@ -104,7 +104,9 @@ MemObj::~MemObj() {
         }
         if (associatedMemObject) {
             associatedMemObject->decRefInternal();
-            context->getBufferPoolAllocator().tryFreeFromPoolBuffer(associatedMemObject, this->offset, this->size);
+            if (!this->isSubBufferFromPool) {
+                context->getBufferPoolAllocator().tryFreeFromPoolBuffer(associatedMemObject, this->offset, this->size);
+            }
         }
         if (!associatedMemObject) {
             releaseAllocatedMapPtr();
@@ -113,6 +115,10 @@ MemObj::~MemObj() {
 
     destructorCallbacks.invoke(this);
 
+    if (subBufferFromPoolParent) {
+        subBufferFromPoolParent->decRefInternal();
+    }
+
     const bool needDecrementContextRefCount = !context->getBufferPoolAllocator().isPoolBuffer(this);
     if (needDecrementContextRefCount) {
         context->decRefInternal();
@@ -56,6 +56,9 @@ class MemObj : public BaseObject<_cl_mem> {
   public:
     constexpr static cl_ulong maskMagic = 0xFFFFFFFFFFFFFF00LL;
     constexpr static cl_ulong objectMagic = 0xAB2212340CACDD00LL;
+    bool isSubBufferFromPool = false;
+    // buffer from pool that a sub-buffer from pool was created for, kept alive as long as the sub-buffer
+    MemObj *subBufferFromPoolParent = nullptr;
 
     MemObj(Context *context,
            cl_mem_object_type memObjectType,
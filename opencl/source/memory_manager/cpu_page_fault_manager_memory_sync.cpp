@@ -1,31 +1,41 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 
 namespace NEO {
+bool PageFaultManager::chunkedMigrationApiSupport = true;
+
 void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
     auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, ptr, size, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
 }
-void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
+void PageFaultManager::transferToGpu(void *ptr, size_t size, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
-    memoryData[ptr].unifiedMemoryManager->insertSvmMapOperation(ptr, memoryData[ptr].size, ptr, 0, false);
+    auto alloc = findAllocation(ptr);
+    UNRECOVERABLE_IF(alloc == memoryData.end());
+    auto allocPtr = alloc->first;
+    auto unifiedMemoryManager = alloc->second.unifiedMemoryManager;
+
+    // chunks migrated to CPU separately have their own map operations, replace them with one covering whole range
+    unifiedMemoryManager->removeSvmMapOperations(ptr, size);
+    unifiedMemoryManager->insertSvmMapOperation(ptr, size, allocPtr, ptrDiff(ptr, allocPtr), false);
     auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
     retVal = commandQueue->finish();
     UNRECOVERABLE_IF(retVal);
 
-    auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
+    auto allocData = unifiedMemoryManager->getSVMAlloc(allocPtr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
 } // namespace NEO
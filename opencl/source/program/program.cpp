@@ -198,10 +198,16 @@ cl_int Program::createProgramFromBinary(
                 return CL_INVALID_BINARY;
             }
             if ((false == singleDeviceBinary.deviceBinary.empty()) && (false == rebuild)) {
-                this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
-                this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
-                this->buildInfos[rootDeviceIndex].packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
-                this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = archive.size();
+                auto &buildInfo = this->buildInfos[rootDeviceIndex];
+                buildInfo.packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
+                buildInfo.packedDeviceBinarySize = archive.size();
+                // application may release its binary, so only one copy is kept and the device binary refers into it when possible
+                if ((singleDeviceBinary.deviceBinary.begin() >= archive.begin()) && (singleDeviceBinary.deviceBinary.end() <= archive.end())) {
+                    buildInfo.unpackedDeviceBinary = makeBinaryView(buildInfo.packedDeviceBinary.get() + (singleDeviceBinary.deviceBinary.begin() - archive.begin()));
+                } else {
+                    buildInfo.unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
+                }
+                buildInfo.unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
             } else {
                 this->isCreatedFromBinary = false;
                 this->requiresRebuild = true;
@@ -367,14 +373,15 @@ void Program::updateNonUniformFlag(const Program **inputPrograms, size_t numInpu
     this->allowNonUniform = allowNonUniform;
 }
 
-void Program::replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) {
+void Program::replaceDeviceBinary(UniqueBinaryPtr &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) {
     if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(newBinary.get()), newBinarySize))) {
         this->buildInfos[rootDeviceIndex].packedDeviceBinary = std::move(newBinary);
         this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = newBinarySize;
         this->buildInfos[rootDeviceIndex].unpackedDeviceBinary.reset();
         this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = 0U;
         if (isAnySingleDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(this->buildInfos[rootDeviceIndex].packedDeviceBinary.get()), this->buildInfos[rootDeviceIndex].packedDeviceBinarySize))) {
-            this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy(buildInfos[rootDeviceIndex].packedDeviceBinary.get(), buildInfos[rootDeviceIndex].packedDeviceBinarySize);
+            // packed binary, possibly a mapped cache file, is kept alive by the same build info
+            this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeBinaryView(buildInfos[rootDeviceIndex].packedDeviceBinary.get());
             this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = buildInfos[rootDeviceIndex].packedDeviceBinarySize;
         }
     } else {
@@ -10,6 +10,7 @@
 #include "shared/source/compiler_interface/linker.h"
 #include "shared/source/device_binary_format/debug_zebin.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
+#include "shared/source/helpers/binary_storage.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
@@ -254,7 +255,7 @@ class Program : public BaseObject<_cl_program> {
         buildInfos[rootDeviceIndex].linkerInput = std::move(linkerInput);
     }
 
-    MOCKABLE_VIRTUAL void replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex);
+    MOCKABLE_VIRTUAL void replaceDeviceBinary(UniqueBinaryPtr &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex);
 
     static bool isValidCallback(void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
     void invokeCallback(void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
@@ -347,10 +348,10 @@ class Program : public BaseObject<_cl_program> {
         Linker::RelocatedSymbolsMap symbols{};
         std::string buildLog{};
 
-        std::unique_ptr<char[]> unpackedDeviceBinary;
+        UniqueBinaryPtr unpackedDeviceBinary;
         size_t unpackedDeviceBinarySize = 0U;
 
-        std::unique_ptr<char[]> packedDeviceBinary;
+        UniqueBinaryPtr packedDeviceBinary;
         size_t packedDeviceBinarySize = 0U;
         ProgramInfo::GlobalSurfaceInfo constStringSectionData;
 
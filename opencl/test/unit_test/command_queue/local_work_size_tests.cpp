@@ -939,3 +939,38 @@ TEST(localWorkSizeTest, givenMaxWorkgroupSizeEqualToSimdSizeWhenLwsIsCalculatedT
     EXPECT_EQ(workGroupSize[1], 1u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST(localWorkSizeTest, givenSameDispatchShapeWhenGeneratingWorkgroupSizeAgainThenCachedLocalWorkSizeIsReturned) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo{&device, kernel.mockKernel, 1, {1024, 1, 1}, {0, 0, 0}, {0, 0, 0}};
+    dispatchInfo.setActualGlobalWorkgroupSize({1024, 1, 1});
+    auto &localWorkSizeCache = kernel.mockKernel->getLocalWorkSizeCache();
+
+    auto lws = generateWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(computeWorkgroupSize(dispatchInfo), lws);
+    EXPECT_EQ(1u, localWorkSizeCache.getStatistics().misses);
+    EXPECT_EQ(0u, localWorkSizeCache.getStatistics().hits);
+
+    EXPECT_EQ(lws, generateWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(1u, localWorkSizeCache.getStatistics().hits);
+
+    kernel.mockKernel->slmTotalSize = 1024u;
+    generateWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(2u, localWorkSizeCache.getStatistics().misses);
+    EXPECT_EQ(2u, localWorkSizeCache.getEntriesCount());
+}
+
+TEST(localWorkSizeTest, givenLocalWorkSizeCacheDisabledWhenGeneratingWorkgroupSizeThenCacheIsNotUsed) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(0);
+
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo{&device, kernel.mockKernel, 1, {1024, 1, 1}, {0, 0, 0}, {0, 0, 0}};
+    dispatchInfo.setActualGlobalWorkgroupSize({1024, 1, 1});
+
+    EXPECT_EQ(computeWorkgroupSize(dispatchInfo), generateWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(0u, kernel.mockKernel->getLocalWorkSizeCache().getEntriesCount());
+    EXPECT_EQ(0u, kernel.mockKernel->getLocalWorkSizeCache().getStatistics().misses);
+}
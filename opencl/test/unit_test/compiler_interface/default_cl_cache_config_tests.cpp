@@ -13,6 +13,7 @@ TEST(CompilerCache, GivenDefaultClCacheConfigThenValuesAreProperlyPopulated) {
     EXPECT_STREQ("cl_cache", cacheConfig.cacheDir.c_str());
     EXPECT_STREQ(".cl_cache", cacheConfig.cacheFileExtension.c_str());
     EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_EQ(0u, cacheConfig.cacheSize);
 }
 
 TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingFromCacheThenBinaryIsLoaded) {
@@ -28,5 +29,27 @@ TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingFromCacheThenBinaryIsLoad
     size_t size;
     auto loadedBin = cache.loadCachedBinary(hash, size);
     EXPECT_NE(nullptr, loadedBin);
-    EXPECT_NE(0U, size);
-}
\ No newline at end of file
+    EXPECT_EQ(32U, size);
+    EXPECT_EQ(0, memcmp(data.get(), loadedBin.get(), 32));
+
+    EXPECT_EQ(1u, cache.getStatistics().stores.load());
+    EXPECT_EQ(1u, cache.getStatistics().hits.load());
+    EXPECT_EQ(0u, cache.getStatistics().misses.load());
+}
+TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingDeviceBinaryFromCacheThenSameBinaryIsReturned) {
+    NEO::CompilerCache cache(NEO::getDefaultCompilerCacheConfig());
+    static const char *hash = "SOME_MAPPED_HASH";
+    std::unique_ptr<char[]> data(new char[32]);
+    for (size_t i = 0; i < 32; i++)
+        data.get()[i] = static_cast<char>(i);
+
+    bool ret = cache.cacheBinary(hash, static_cast<const char *>(data.get()), 32);
+    EXPECT_TRUE(ret);
+
+    size_t size = 0;
+    auto loadedBin = cache.loadCachedDeviceBinary(hash, size);
+    ASSERT_NE(nullptr, loadedBin);
+    EXPECT_EQ(32U, size);
+    EXPECT_EQ(0, memcmp(data.get(), loadedBin.get(), 32));
+    EXPECT_EQ(1u, cache.getStatistics().hits.load());
+}
@@ -7,7 +7,10 @@
 
 #include "shared/source/helpers/array_count.h"
 #include "shared/test/common/cmd_parse/hw_parse.h"
+#include "shared/source/utilities/trace_exporter.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_ostime.h"
 #include "shared/test/common/mocks/mock_timestamp_container.h"
 #include "shared/test/common/utilities/base_object_utils.h"
 
@@ -17,6 +20,34 @@
 
 using namespace NEO;
 
+HWTEST_F(TimestampPacketTests, givenTraceExporterWhenKernelIsEnqueuedAndQueueIsFinishedThenGpuSpanOfKernelIsExported) {
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    csr.timestampPacketWriteEnabled = true;
+
+    TraceExporter traceExporter("", MockOSTime::create());
+    VariableBackup<TraceExporter *> traceExporterBackup(&traceExporterOverride, &traceExporter);
+
+    kernel->kernelInfo.kernelDescriptor.kernelMetadata.kernelName = "tracedKernel";
+    auto cmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(context, device.get(), nullptr));
+    cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+
+    ASSERT_EQ(1u, cmdQ->timestampPacketContainer->peekNodes().size());
+    auto node = cmdQ->timestampPacketContainer->peekNodes()[0];
+    typename FamilyType::TimestampPacketType timestampData[] = {10, 20, 30, 40};
+    for (uint32_t i = 0; i < node->getPacketsUsed(); i++) {
+        node->assignDataToAllTimestamps(i, timestampData);
+    }
+
+    cmdQ->finish();
+
+    auto trace = traceExporter.serialize();
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"tracedKernel\",\"cat\":\"gpu\""));
+
+    auto spansCount = traceExporter.getSpansCount();
+    cmdQ->finish();
+    EXPECT_EQ(spansCount, traceExporter.getSpansCount());
+}
+
 HWTEST_F(TimestampPacketTests, givenEmptyWaitlistAndNoOutputEventWhenEnqueueingMarkerThenDoNothing) {
     auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
     csr.timestampPacketWriteEnabled = true;
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/surface_format_info.h"
+#include "shared/source/kernel/kernel_tuning_database.h"
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -1915,6 +1916,110 @@ HWTEST_F(KernelResidencyTest, givenSimpleKernelTunningAndNoAtomicsWhenPerformTun
     EXPECT_NE(mockKernel.mockKernel->isSingleSubdevicePreferred(), mockKernel.mockKernel->getKernelInfo().kernelDescriptor.kernelAttributes.flags.useGlobalAtomics);
 }
 
+HWTEST_F(KernelResidencyTest, givenFullKernelTuningAndResultStoredInTuningDatabaseWhenPerformTunningThenStoredResultIsUsedWithoutTunning) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelTunning.set(2u);
+    DebugManager.flags.KernelTuningDatabasePath.set("");
+
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+
+    Vec3<size_t> lws{1, 1, 1};
+    Vec3<size_t> gws{1, 1, 1};
+    Vec3<size_t> offsets{1, 1, 1};
+    MockKernel::KernelConfig config{gws, lws, offsets};
+
+    MockTimestampPacketContainer container(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+
+    mockKernel.mockKernel->getKernelTuningDatabase()->storeSingleSubdevicePreferred(mockKernel.mockKernel->getKernelTuningHash(), gws, lws, true);
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, &container);
+
+    auto result = mockKernel.mockKernel->kernelSubmissionMap.find(config);
+    ASSERT_NE(result, mockKernel.mockKernel->kernelSubmissionMap.end());
+    EXPECT_EQ(result->second.status, MockKernel::TunningStatus::TUNNING_DONE);
+    EXPECT_EQ(result->second.kernelStandardTimestamps.get(), nullptr);
+    EXPECT_TRUE(mockKernel.mockKernel->singleSubdevicePreferredInCurrentEnqueue);
+}
+
+HWTEST_F(KernelResidencyTest, givenWorkgroupSizeTuningEnabledWhenAllCandidatesCompletedThenFastestWorkgroupSizeIsSelectedAndStoredInTuningDatabase) {
+    using TimestampPacketType = typename FamilyType::TimestampPacketType;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelWorkgroupSizeTuning.set(1);
+    DebugManager.flags.KernelTuningDatabasePath.set("");
+
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.simdSize = 32;
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 256;
+
+    Vec3<size_t> gws{1024, 1, 1};
+    Vec3<size_t> offsets{0, 0, 0};
+    Vec3<size_t> defaultLws{64, 1, 1};
+    std::vector<Vec3<size_t>> expectedCandidates = {{64, 1, 1}, {32, 1, 1}, {128, 1, 1}, {256, 1, 1}};
+    TimestampPacketType durations[] = {40, 30, 10, 20};
+
+    std::vector<std::unique_ptr<MockTimestampPacketContainer>> containers;
+    for (auto &expectedCandidate : expectedCandidates) {
+        auto lws = mockKernel.mockKernel->getTunedWorkgroupSize(gws, defaultLws);
+        EXPECT_EQ(expectedCandidate, lws);
+        containers.push_back(std::make_unique<MockTimestampPacketContainer>(*commandStreamReceiver.getTimestampPacketAllocator(), 1));
+        mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, containers.back().get());
+    }
+
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, defaultLws, gws, offsets, containers.back().get());
+    EXPECT_FALSE(mockKernel.mockKernel->workgroupSizeTuningMap.begin()->second.tunningFinished);
+    EXPECT_EQ(defaultLws, mockKernel.mockKernel->getTunedWorkgroupSize(gws, defaultLws));
+
+    for (size_t i = 0; i < containers.size(); i++) {
+        TimestampPacketType data[4] = {0, 0, durations[i], durations[i]};
+        containers[i]->getNode(0u)->assignDataToAllTimestamps(0, data);
+    }
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, defaultLws, gws, offsets, containers.back().get());
+
+    auto &tuningData = mockKernel.mockKernel->workgroupSizeTuningMap.begin()->second;
+    EXPECT_TRUE(tuningData.tunningFinished);
+    EXPECT_TRUE(tuningData.candidateTimestamps.empty());
+    EXPECT_EQ(expectedCandidates[2], mockKernel.mockKernel->getTunedWorkgroupSize(gws, defaultLws));
+
+    Vec3<size_t> storedLws{0, 0, 0};
+    EXPECT_TRUE(mockKernel.mockKernel->getKernelTuningDatabase()->getWorkgroupSize(mockKernel.mockKernel->getKernelTuningHash(), gws, storedLws));
+    EXPECT_EQ(expectedCandidates[2], storedLws);
+}
+
+HWTEST_F(KernelResidencyTest, givenWorkgroupSizeStoredInTuningDatabaseWhenGettingTunedWorkgroupSizeThenStoredWorkgroupSizeIsReturnedWithoutExploration) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelWorkgroupSizeTuning.set(1);
+    DebugManager.flags.KernelTuningDatabasePath.set("");
+
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.simdSize = 32;
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 256;
+
+    Vec3<size_t> gws{1024, 1, 1};
+    Vec3<size_t> defaultLws{64, 1, 1};
+    Vec3<size_t> storedLws{128, 1, 1};
+    mockKernel.mockKernel->getKernelTuningDatabase()->storeWorkgroupSize(mockKernel.mockKernel->getKernelTuningHash(), gws, storedLws);
+
+    EXPECT_EQ(storedLws, mockKernel.mockKernel->getTunedWorkgroupSize(gws, defaultLws));
+    auto &tuningData = mockKernel.mockKernel->workgroupSizeTuningMap.begin()->second;
+    EXPECT_TRUE(tuningData.tunningFinished);
+    EXPECT_TRUE(tuningData.candidates.empty());
+
+    Vec3<size_t> otherGws{96, 1, 1};
+    mockKernel.mockKernel->getKernelTuningDatabase()->storeWorkgroupSize(mockKernel.mockKernel->getKernelTuningHash(), otherGws, storedLws);
+    EXPECT_EQ(defaultLws, mockKernel.mockKernel->getTunedWorkgroupSize(otherGws, defaultLws));
+}
+
+HWTEST_F(KernelResidencyTest, givenWorkgroupSizeTuningDisabledWhenGettingTunedWorkgroupSizeThenDefaultWorkgroupSizeIsReturned) {
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+
+    Vec3<size_t> gws{1024, 1, 1};
+    Vec3<size_t> defaultLws{64, 1, 1};
+
+    EXPECT_EQ(defaultLws, mockKernel.mockKernel->getTunedWorkgroupSize(gws, defaultLws));
+    EXPECT_TRUE(mockKernel.mockKernel->workgroupSizeTuningMap.empty());
+}
+
 HWTEST_F(KernelResidencyTest, givenSimpleKernelWhenExecEnvDoesNotHavePageFaultManagerThenPageFaultDoesNotMoveAllocation) {
     auto mockPageFaultManager = std::make_unique<MockPageFaultManager>();
     MockKernelWithInternals mockKernel(*this->pClDevice);
@@ -74,42 +74,43 @@ using aggregatedSmallBuffersDisabledTest = AggregatedSmallBuffersTestTemplate<0>
 
 TEST_F(aggregatedSmallBuffersDisabledTest, givenAggregatedSmallBuffersDisabledWhenBufferCreateCalledThenDoNotUsePool) {
     ASSERT_FALSE(poolAllocator->isAggregatedSmallBuffersEnabled());
-    ASSERT_EQ(poolAllocator->mainStorage, nullptr);
+    ASSERT_TRUE(poolAllocator->bufferPools.empty());
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_NE(buffer, nullptr);
     EXPECT_EQ(retVal, CL_SUCCESS);
 
-    EXPECT_EQ(poolAllocator->mainStorage, nullptr);
+    EXPECT_TRUE(poolAllocator->bufferPools.empty());
 }
 
 using aggregatedSmallBuffersEnabledTest = AggregatedSmallBuffersTestTemplate<1>;
 
 TEST_F(aggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeLargerThanThresholdWhenBufferCreateCalledThenDoNotUsePool) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled());
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_EQ(1u, poolAllocator->getPoolsCount());
     size = PoolAllocator::smallBufferThreshold + 1;
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_NE(buffer, nullptr);
     EXPECT_EQ(retVal, CL_SUCCESS);
+    EXPECT_FALSE(buffer->isSubBuffer());
 
-    EXPECT_NE(poolAllocator->mainStorage, nullptr);
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
 }
 
 TEST_F(aggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledThenUsePool) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled());
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_EQ(1u, poolAllocator->getPoolsCount());
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
 
     EXPECT_NE(buffer, nullptr);
     EXPECT_EQ(retVal, CL_SUCCESS);
 
-    EXPECT_NE(poolAllocator->mainStorage, nullptr);
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
     auto mockBuffer = static_cast<MockBuffer *>(buffer.get());
     EXPECT_GE(mockBuffer->getSize(), size);
     EXPECT_GE(mockBuffer->getOffset(), 0u);
     EXPECT_LE(mockBuffer->getOffset(), PoolAllocator::aggregatedSmallBuffersPoolSize - size);
     EXPECT_TRUE(mockBuffer->isSubBuffer());
-    EXPECT_EQ(poolAllocator->mainStorage, mockBuffer->associatedMemObject);
+    EXPECT_EQ(poolAllocator->bufferPools[0].mainStorage, mockBuffer->associatedMemObject);
 
     retVal = clReleaseMemObject(buffer.release());
     EXPECT_EQ(retVal, CL_SUCCESS);
@@ -139,7 +140,7 @@ TEST_F(aggregatedSmallBuffersEnabledTest, givenCopyHostPointerWhenCreatingBuffer
     hostPtr = dataToCopy;
 
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled());
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_EQ(1u, poolAllocator->getPoolsCount());
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     if (commandQueue->writeBufferCounter == 0) {
         GTEST_SKIP();
@@ -155,7 +156,7 @@ TEST_F(aggregatedSmallBuffersEnabledTest, givenCopyHostPointerWhenCreatingBuffer
 
 TEST_F(aggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledMultipleTimesThenUsePool) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled());
-    ASSERT_NE(poolAllocator->mainStorage, nullptr);
+    ASSERT_EQ(1u, poolAllocator->getPoolsCount());
 
     constexpr auto buffersToCreate = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::smallBufferThreshold;
     std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate);
@@ -163,11 +164,13 @@ TEST_F(aggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
         buffers[i].reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
         EXPECT_EQ(retVal, CL_SUCCESS);
     }
-    EXPECT_NE(poolAllocator->mainStorage, nullptr);
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
     std::unique_ptr<Buffer> bufferAfterPoolIsFull(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_EQ(retVal, CL_SUCCESS);
-    EXPECT_NE(bufferAfterPoolIsFull, nullptr);
-    EXPECT_FALSE(bufferAfterPoolIsFull->isSubBuffer());
+    ASSERT_NE(bufferAfterPoolIsFull, nullptr);
+    EXPECT_TRUE(bufferAfterPoolIsFull->isSubBuffer());
+    ASSERT_EQ(2u, poolAllocator->getPoolsCount());
+    EXPECT_EQ(poolAllocator->bufferPools[1].mainStorage, static_cast<MockBuffer *>(bufferAfterPoolIsFull.get())->associatedMemObject);
 
     using Bounds = struct {
         size_t left;
@@ -181,7 +184,7 @@ TEST_F(aggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
         EXPECT_NE(buffers[i], nullptr);
         EXPECT_TRUE(buffers[i]->isSubBuffer());
         auto mockBuffer = static_cast<MockBuffer *>(buffers[i].get());
-        EXPECT_EQ(poolAllocator->mainStorage, mockBuffer->associatedMemObject);
+        EXPECT_EQ(poolAllocator->bufferPools[0].mainStorage, mockBuffer->associatedMemObject);
         EXPECT_GE(mockBuffer->getSize(), size);
         EXPECT_GE(mockBuffer->getOffset(), 0u);
         EXPECT_LE(mockBuffer->getOffset(), PoolAllocator::aggregatedSmallBuffersPoolSize - size);
@@ -198,13 +201,14 @@ TEST_F(aggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
     }
 
     // freeing subbuffer frees space in pool
-    ASSERT_LT(poolAllocator->chunkAllocator->getLeftSize(), size);
+    ASSERT_LT(poolAllocator->bufferPools[0].chunkAllocator->getLeftSize(), size);
     clReleaseMemObject(buffers[0].release());
-    EXPECT_GE(poolAllocator->chunkAllocator->getLeftSize(), size);
+    EXPECT_GE(poolAllocator->bufferPools[0].chunkAllocator->getLeftSize(), size);
     std::unique_ptr<Buffer> bufferAfterPoolHasSpaceAgain(Buffer::create(context.get(), flags, size, hostPtr, retVal));
     EXPECT_EQ(retVal, CL_SUCCESS);
     ASSERT_NE(bufferAfterPoolHasSpaceAgain, nullptr);
     EXPECT_TRUE(bufferAfterPoolHasSpaceAgain->isSubBuffer());
+    EXPECT_EQ(poolAllocator->bufferPools[0].mainStorage, static_cast<MockBuffer *>(bufferAfterPoolHasSpaceAgain.get())->associatedMemObject);
 
     // subbuffer after free does not overlap
     subBuffersBounds[0] = Bounds{bufferAfterPoolHasSpaceAgain->getOffset(), bufferAfterPoolHasSpaceAgain->getOffset() + bufferAfterPoolHasSpaceAgain->getSize()};
@@ -216,16 +220,175 @@ TEST_F(aggregatedSmallBuffersEnabledTest, givenAggregatedSmallBuffersEnabledAndS
     }
 }
 
+TEST_F(aggregatedSmallBuffersEnabledTest, givenSecondPoolWhenAllItsBuffersAreReleasedThenReleaseSecondPoolAndKeepFirstOne) {
+    constexpr auto buffersToCreate = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::smallBufferThreshold;
+    std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate + 1);
+    for (auto &buffer : buffers) {
+        buffer.reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+    }
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount());
+
+    clReleaseMemObject(buffers[buffersToCreate].release());
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+    EXPECT_EQ(1u, poolAllocator->getStatistics().poolsReleased);
+
+    buffers.pop_back();
+    for (auto &buffer : buffers) {
+        clReleaseMemObject(buffer.release());
+    }
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+    EXPECT_EQ(poolAllocator->getPoolSize(), poolAllocator->bufferPools[0].chunkAllocator->getLeftSize());
+}
+
+TEST_F(aggregatedSmallBuffersEnabledTest, givenSubBufferOfBufferFromPoolWhenParentBufferIsReleasedThenPoolAndParentRegionAreKeptUntilSubBufferIsReleased) {
+    constexpr auto buffersToCreate = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::smallBufferThreshold;
+    std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate);
+    for (auto &buffer : buffers) {
+        buffer.reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+    }
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+
+    auto parentBuffer = Buffer::create(context.get(), flags, size, hostPtr, retVal);
+    ASSERT_NE(nullptr, parentBuffer);
+    ASSERT_EQ(2u, poolAllocator->getPoolsCount());
+    auto secondPoolStorage = poolAllocator->bufferPools[1].mainStorage;
+    EXPECT_EQ(secondPoolStorage, parentBuffer->getAssociatedMemObject());
+
+    cl_buffer_region region{};
+    region.origin = size / 2;
+    region.size = size / 2;
+    auto subBuffer = parentBuffer->createSubBuffer(flags, 0, &region, retVal);
+    ASSERT_NE(nullptr, subBuffer);
+    EXPECT_TRUE(subBuffer->isSubBufferFromPool);
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseMemObject(parentBuffer));
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount());
+    EXPECT_EQ(0u, poolAllocator->getStatistics().poolsReleased);
+    EXPECT_EQ(secondPoolStorage, poolAllocator->bufferPools[1].mainStorage);
+    EXPECT_EQ(secondPoolStorage, subBuffer->getAssociatedMemObject());
+    EXPECT_EQ(secondPoolStorage->getGraphicsAllocation(device->getRootDeviceIndex()), subBuffer->getGraphicsAllocation(device->getRootDeviceIndex()));
+
+    std::unique_ptr<Buffer> bufferAfterParentRelease(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    ASSERT_NE(nullptr, bufferAfterParentRelease);
+    EXPECT_EQ(secondPoolStorage, bufferAfterParentRelease->getAssociatedMemObject());
+    EXPECT_TRUE(bufferAfterParentRelease->getOffset() >= subBuffer->getOffset() + region.size ||
+                bufferAfterParentRelease->getOffset() + size <= subBuffer->getOffset());
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseMemObject(subBuffer));
+    EXPECT_EQ(2u, poolAllocator->getPoolsCount());
+    clReleaseMemObject(bufferAfterParentRelease.release());
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+    EXPECT_EQ(1u, poolAllocator->getStatistics().poolsReleased);
+
+    for (auto &buffer : buffers) {
+        clReleaseMemObject(buffer.release());
+    }
+}
+
+TEST_F(aggregatedSmallBuffersEnabledTest, givenMaxPoolsCountReachedWhenPoolsAreFullThenDoNotUsePool) {
+    poolAllocator->maxPoolsCount = 1u;
+    constexpr auto buffersToCreate = PoolAllocator::aggregatedSmallBuffersPoolSize / PoolAllocator::smallBufferThreshold;
+    std::vector<std::unique_ptr<Buffer>> buffers(buffersToCreate);
+    for (auto &buffer : buffers) {
+        buffer.reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        EXPECT_EQ(retVal, CL_SUCCESS);
+    }
+    std::unique_ptr<Buffer> bufferAfterPoolIsFull(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    ASSERT_NE(bufferAfterPoolIsFull, nullptr);
+    EXPECT_FALSE(bufferAfterPoolIsFull->isSubBuffer());
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+
+    auto statistics = poolAllocator->getStatistics();
+    EXPECT_EQ(buffersToCreate, statistics.allocationsFromPool);
+    EXPECT_EQ(1u, statistics.allocationsNotFromPool);
+    EXPECT_EQ(1u, statistics.poolsCreated);
+}
+
+TEST_F(aggregatedSmallBuffersEnabledTest, givenSmallBufferWhenAllocatingFromPoolThenChunkIsRoundedUpToSizeClass) {
+    EXPECT_EQ(PoolAllocator::chunkAlignment, PoolAllocator::getSizeClass(1u));
+    EXPECT_EQ(1024u, PoolAllocator::getSizeClass(513u));
+    EXPECT_EQ(PoolAllocator::smallBufferThreshold, PoolAllocator::getSizeClass(PoolAllocator::smallBufferThreshold));
+
+    size = 513u;
+    auto leftSizeBefore = poolAllocator->bufferPools[0].chunkAllocator->getLeftSize();
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    EXPECT_EQ(retVal, CL_SUCCESS);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_TRUE(buffer->isSubBuffer());
+    EXPECT_EQ(size, buffer->getSize());
+    EXPECT_EQ(leftSizeBefore - PoolAllocator::getSizeClass(size), poolAllocator->bufferPools[0].chunkAllocator->getLeftSize());
+
+    clReleaseMemObject(buffer.release());
+    EXPECT_EQ(leftSizeBefore, poolAllocator->bufferPools[0].chunkAllocator->getLeftSize());
+}
+
+TEST_F(aggregatedSmallBuffersEnabledTest, givenCoalescedChunkLargerThanSizeClassWhenBufferIsReleasedThenWholeChunkIsReturnedToPool) {
+    auto &chunkAllocator = poolAllocator->bufferPools[0].chunkAllocator;
+    auto usedSizeBefore = chunkAllocator->getUsedSize();
+
+    size = PoolAllocator::chunkAlignment;
+    std::vector<std::unique_ptr<Buffer>> buffers(5);
+    for (auto &buffer : buffers) {
+        buffer.reset(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+        ASSERT_NE(nullptr, buffer);
+    }
+
+    // three adjacent chunks are coalesced into one chunk, which is not adjacent to pool bounds
+    for (auto i = 1u; i < 4u; i++) {
+        clReleaseMemObject(buffers[i].release());
+    }
+
+    // coalesced chunk is smaller than twice the size class, so it is handed out whole
+    size = 2 * PoolAllocator::chunkAlignment;
+    std::unique_ptr<Buffer> largerBuffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    ASSERT_NE(nullptr, largerBuffer);
+    EXPECT_EQ(usedSizeBefore + 5 * PoolAllocator::chunkAlignment, chunkAllocator->getUsedSize());
+
+    clReleaseMemObject(largerBuffer.release());
+    clReleaseMemObject(buffers[0].release());
+    clReleaseMemObject(buffers[4].release());
+    EXPECT_EQ(usedSizeBefore, chunkAllocator->getUsedSize());
+}
+
+TEST_F(aggregatedSmallBuffersEnabledTest, givenSmallBufferPoolFlagsSetWhenInitializingPoolAllocatorThenUseThresholdAndPoolSizeFromFlags) {
+    DebugManager.flags.SmallBufferPoolAllocatorThreshold.set(static_cast<int32_t>(64 * KB));
+    DebugManager.flags.SmallBufferPoolAllocatorPoolSize.set(static_cast<int32_t>(128 * KB));
+    DebugManager.flags.SmallBufferPoolAllocatorMaxPools.set(0);
+
+    MockBufferPoolAllocator bufferPoolAllocator;
+    bufferPoolAllocator.initAggregatedSmallBuffers(context.get());
+    EXPECT_EQ(64 * KB, bufferPoolAllocator.getThreshold());
+    EXPECT_EQ(16 * 64 * KB, bufferPoolAllocator.getPoolSize());
+    EXPECT_EQ(0u, bufferPoolAllocator.getPoolsCount());
+}
+
 using aggregatedSmallBuffersEnabledTestDoNotRunSetup = AggregatedSmallBuffersTestTemplate<1, true>;
 
-TEST_F(aggregatedSmallBuffersEnabledTestDoNotRunSetup, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledButPoolCreateFailedThenDoNotUsePool) {
+TEST_F(aggregatedSmallBuffersEnabledTestDoNotRunSetup, givenAggregatedSmallBuffersEnabledAndSizeEqualToThresholdWhenBufferCreateCalledButInitialPoolCreateFailedThenCreatePoolOnDemand) {
     ASSERT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled());
-    ASSERT_EQ(poolAllocator->mainStorage, nullptr);
+    ASSERT_TRUE(poolAllocator->bufferPools.empty());
     std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
 
     EXPECT_EQ(retVal, CL_SUCCESS);
-    EXPECT_NE(buffer.get(), nullptr);
-    EXPECT_EQ(poolAllocator->mainStorage, nullptr);
+    ASSERT_NE(buffer.get(), nullptr);
+    EXPECT_TRUE(buffer->isSubBuffer());
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+}
+
+TEST_F(aggregatedSmallBuffersEnabledTestDoNotRunSetup, givenAggregatedSmallBuffersEnabledWhenBufferCreateCalledAndPoolCreateFailsThenDoNotUsePool) {
+    ASSERT_TRUE(poolAllocator->bufferPools.empty());
+    setAllocationToFail(true);
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), flags, size, hostPtr, retVal));
+    setAllocationToFail(false);
+
+    EXPECT_TRUE(poolAllocator->bufferPools.empty());
+    EXPECT_EQ(1u, poolAllocator->getStatistics().allocationsNotFromPool);
+    if (buffer) {
+        EXPECT_FALSE(buffer->isSubBuffer());
+    }
 }
 
 template <int32_t poolBufferFlag = -1>
@@ -289,7 +452,7 @@ TEST_F(aggregatedSmallBuffersEnabledApiTest, givenSmallBufferWhenCreatingBufferT
     Buffer *parentBuffer = static_cast<Buffer *>(asBuffer->associatedMemObject);
     EXPECT_EQ(2, parentBuffer->getRefInternalCount());
     MockBufferPoolAllocator *mockBufferPoolAllocator = static_cast<MockBufferPoolAllocator *>(&context->getBufferPoolAllocator());
-    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->mainStorage);
+    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->bufferPools[0].mainStorage);
 
     retVal = clReleaseMemObject(smallBuffer);
     EXPECT_EQ(retVal, CL_SUCCESS);
@@ -340,7 +503,7 @@ TEST_F(aggregatedSmallBuffersEnabledApiTest, givenCopyHostPointerWhenCreatingBuf
     Buffer *parentBuffer = static_cast<Buffer *>(asBuffer->associatedMemObject);
     EXPECT_EQ(2, parentBuffer->getRefInternalCount());
     MockBufferPoolAllocator *mockBufferPoolAllocator = static_cast<MockBufferPoolAllocator *>(&context->getBufferPoolAllocator());
-    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->mainStorage);
+    EXPECT_EQ(parentBuffer, mockBufferPoolAllocator->bufferPools[0].mainStorage);
 
     // check that data has been copied
     auto address = asBuffer->getCpuAddress();
@@ -376,7 +539,7 @@ TEST_F(aggregatedSmallBuffersSubBufferApiTest, givenBufferFromPoolWhenCreateSubB
     MockBuffer *mockSubBuffer = static_cast<MockBuffer *>(subBuffer);
     EXPECT_EQ(mockSubBuffer->offset, mockBuffer->offset + region.origin);
     MockBufferPoolAllocator *mockBufferPoolAllocator = static_cast<MockBufferPoolAllocator *>(&context->getBufferPoolAllocator());
-    EXPECT_EQ(mockSubBuffer->associatedMemObject, mockBufferPoolAllocator->mainStorage);
+    EXPECT_EQ(mockSubBuffer->associatedMemObject, mockBufferPoolAllocator->bufferPools[0].mainStorage);
 
     retVal = clReleaseMemObject(subBuffer);
     EXPECT_EQ(retVal, CL_SUCCESS);
@@ -5,15 +5,21 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/test/common/fixtures/cpu_page_fault_manager_tests_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
 
 #include "gtest/gtest.h"
 
@@ -66,7 +72,7 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSynchronizeMemoryThenEnq
     EXPECT_EQ(cmdQ->transferToGpuCalled, 0);
     EXPECT_EQ(cmdQ->finishCalled, 0);
 
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 256, cmdQ.get());
     EXPECT_EQ(cmdQ->transferToCpuCalled, 1);
     EXPECT_EQ(cmdQ->transferToGpuCalled, 1);
     EXPECT_EQ(cmdQ->finishCalled, 1);
@@ -99,9 +105,68 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
 
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 0);
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 256, cmdQ.get());
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 1);
 
     svmAllocsManager->freeSVMAlloc(alloc);
     cmdQ->device = nullptr;
 }
+
+template <typename GfxFamily>
+struct CopyExecutingCommandQueue : public MockCommandQueueHw<GfxFamily> {
+    using MockCommandQueueHw<GfxFamily>::MockCommandQueueHw;
+
+    // copy kernels are not executed in ULTs, apply builtin copies on host to observe migrated data
+    void enqueueHandlerHook(const unsigned int commandType, const MultiDispatchInfo &dispatchInfo) override {
+        MockCommandQueueHw<GfxFamily>::enqueueHandlerHook(commandType, dispatchInfo);
+        const auto &params = dispatchInfo.peekBuiltinOpParams();
+        if (params.srcSvmAlloc && params.dstSvmAlloc && params.size.x > 0u) {
+            memcpy(ptrOffset(params.dstSvmAlloc->getUnderlyingBuffer(), params.dstOffset.x),
+                   ptrOffset(params.srcSvmAlloc->getUnderlyingBuffer(), params.srcOffset.x), params.size.x);
+        }
+    }
+};
+
+HWTEST_F(PageFaultManagerTest, givenChunksWrittenOnCpuWhenRunIsTransferredToGpuThenAllChunksAreCopiedAndMapOperationsAreRemoved) {
+    REQUIRE_SVM_OR_SKIP(defaultHwInfo);
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalMemory.set(1);
+
+    auto device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+    MockContext context(device.get(), true);
+    CopyExecutingCommandQueue<FamilyType> cmdQ(&context, device.get(), nullptr);
+    auto svmManager = reinterpret_cast<MockSVMAllocsManager *>(context.getSVMAllocsManager());
+
+    constexpr size_t chunkSize = MemoryConstants::pageSize;
+    constexpr size_t chunksCount = 4;
+    auto alloc = svmManager->createSVMAlloc(chunksCount * chunkSize, {}, context.getRootDeviceIndices(), context.getDeviceBitfields());
+    ASSERT_NE(nullptr, alloc);
+    auto svmData = svmManager->getSVMAlloc(alloc);
+    ASSERT_NE(nullptr, svmData->cpuAllocation);
+    auto gpuStorage = reinterpret_cast<uint8_t *>(svmData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex())->getUnderlyingBuffer());
+    memset(gpuStorage, 0, chunksCount * chunkSize);
+
+    pageFaultManager->insertAllocation(alloc, chunksCount * chunkSize, svmManager, &cmdQ, {});
+
+    for (size_t chunk = 1; chunk < chunksCount; chunk++) {
+        auto chunkPtr = ptrOffset(alloc, chunk * chunkSize);
+        pageFaultManager->baseCpuTransfer(chunkPtr, chunkSize, &cmdQ);
+        memset(chunkPtr, static_cast<int>(chunk), chunkSize);
+    }
+    EXPECT_EQ(chunksCount - 1, svmManager->svmMapOperations.getNumMapOperations());
+
+    pageFaultManager->baseGpuTransfer(ptrOffset(alloc, chunkSize), (chunksCount - 1) * chunkSize, &cmdQ);
+    EXPECT_EQ(0u, svmManager->svmMapOperations.getNumMapOperations());
+    for (size_t chunk = 0; chunk < chunksCount; chunk++) {
+        EXPECT_EQ(static_cast<uint8_t>(chunk), gpuStorage[chunk * chunkSize]);
+        EXPECT_EQ(static_cast<uint8_t>(chunk), gpuStorage[(chunk + 1) * chunkSize - 1]);
+    }
+
+    memset(gpuStorage + 2 * chunkSize, 0x20, chunkSize);
+    auto chunkPtr = ptrOffset(alloc, 2 * chunkSize);
+    pageFaultManager->baseCpuTransfer(chunkPtr, chunkSize, &cmdQ);
+    EXPECT_EQ(0x20, reinterpret_cast<uint8_t *>(chunkPtr)[0]);
+
+    pageFaultManager->removeAllocation(alloc);
+    svmManager->freeSVMAlloc(alloc);
+}
@@ -55,9 +55,10 @@ class MockContext : public Context {
 
     class MockBufferPoolAllocator : public BufferPoolAllocator {
       public:
-        using BufferPoolAllocator::chunkAllocator;
+        using BufferPoolAllocator::bufferPools;
         using BufferPoolAllocator::isAggregatedSmallBuffersEnabled;
-        using BufferPoolAllocator::mainStorage;
+        using BufferPoolAllocator::maxPoolsCount;
+        using BufferPoolAllocator::statistics;
     };
 
   private:
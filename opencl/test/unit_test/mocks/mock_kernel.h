@@ -104,6 +104,8 @@ class MockKernel : public Kernel {
     using Kernel::executionType;
     using Kernel::getDevice;
     using Kernel::getHardwareInfo;
+    using Kernel::getKernelTuningDatabase;
+    using Kernel::getKernelTuningHash;
     using Kernel::graphicsAllocationTypeUseSystemMemory;
     using Kernel::hasDirectStatelessAccessToHostMemory;
     using Kernel::hasDirectStatelessAccessToSharedBuffer;
@@ -130,6 +132,7 @@ class MockKernel : public Kernel {
     using Kernel::singleSubdevicePreferredInCurrentEnqueue;
     using Kernel::svmAllocationsRequireCacheFlush;
     using Kernel::unifiedMemoryControls;
+    using Kernel::workgroupSizeTuningMap;
 
     using Kernel::slmSizes;
     using Kernel::slmTotalSize;
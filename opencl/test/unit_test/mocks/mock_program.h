@@ -143,7 +143,7 @@ class MockProgram : public Program {
         return this->compile(getDevices(), this->options.c_str(), 0, nullptr, nullptr);
     }
 
-    void replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) override {
+    void replaceDeviceBinary(UniqueBinaryPtr &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) override {
         if (replaceDeviceBinaryCalledPerRootDevice.find(rootDeviceIndex) == replaceDeviceBinaryCalledPerRootDevice.end()) {
             replaceDeviceBinaryCalledPerRootDevice.insert({rootDeviceIndex, 1});
         } else {
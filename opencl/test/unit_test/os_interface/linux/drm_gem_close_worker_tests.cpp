@@ -15,6 +15,8 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/arrayref.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/test_macros/test.h"
@@ -26,8 +28,10 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <sched.h>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -38,12 +42,18 @@ class DrmMockForWorker : public Drm {
     std::atomic<int> gem_close_cnt;
     std::atomic<int> gem_close_expected;
     std::atomic<std::thread::id> ioctl_caller_thread_id;
+    std::vector<DrmIoctl> gemWaitAndCloseIoctls;
     DrmMockForWorker(RootDeviceEnvironment &rootDeviceEnvironment) : Drm(std::make_unique<HwDeviceIdDrm>(mockFd, mockPciPath), rootDeviceEnvironment) {
     }
     int ioctl(DrmIoctl request, void *arg) override {
         if (request == DrmIoctl::GemClose)
             gem_close_cnt++;
 
+        if (request == DrmIoctl::GemClose || request == DrmIoctl::GemWait) {
+            std::lock_guard<std::mutex> lock(mutex);
+            gemWaitAndCloseIoctls.push_back(request);
+        }
+
         ioctl_caller_thread_id = std::this_thread::get_id();
 
         return 0;
@@ -188,3 +198,86 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+struct WhiteBoxDrmGemCloseWorker : public DrmGemCloseWorker {
+    using DrmGemCloseWorker::DrmGemCloseWorker;
+    using DrmGemCloseWorker::processQueue;
+    using DrmGemCloseWorker::workCount;
+
+    // drains given buffer objects on the calling thread, as a single swap of worker queue would
+    void processBufferObjects(ArrayRef<BufferObject *> bufferObjects) {
+        std::queue<BufferObject *> inputQueue;
+        for (auto bo : bufferObjects) {
+            inputQueue.push(bo);
+        }
+        workCount += static_cast<uint32_t>(bufferObjects.size());
+        processQueue(inputQueue);
+    }
+};
+
+TEST_F(DrmGemCloseWorkerTests, givenQueueOfBufferObjectsWhenItIsProcessedThenAllBufferObjectsOfBatchAreWaitedForBeforeClosing) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.GemCloseWorkerBatchSize.set(4);
+    this->drmMock->gem_close_expected = 4;
+
+    auto worker = std::make_unique<WhiteBoxDrmGemCloseWorker>(*mm);
+    BufferObject *bos[4];
+    for (auto &bo : bos) {
+        bo = new BufferObject(this->drmMock, 3, 1, 0, 1);
+    }
+
+    worker->processBufferObjects(ArrayRef<BufferObject *>(bos));
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    if (!this->drmMock->isVmBindAvailable()) {
+        std::vector<DrmIoctl> expectedIoctls = {DrmIoctl::GemWait, DrmIoctl::GemWait, DrmIoctl::GemWait, DrmIoctl::GemWait,
+                                                DrmIoctl::GemClose, DrmIoctl::GemClose, DrmIoctl::GemClose, DrmIoctl::GemClose};
+        EXPECT_EQ(expectedIoctls, this->drmMock->gemWaitAndCloseIoctls);
+    }
+
+    auto &statistics = worker->getStatistics();
+    EXPECT_EQ(4u, statistics.closedBufferObjectsCount);
+    EXPECT_EQ(1u, statistics.drainsCount);
+    EXPECT_EQ(4u, statistics.maxQueueDepth);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchSizeSmallerThanQueueDepthWhenQueueIsProcessedThenBufferObjectsAreClosedInMultipleBatches) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.GemCloseWorkerBatchSize.set(2);
+    this->drmMock->gem_close_expected = 3;
+
+    auto worker = std::make_unique<WhiteBoxDrmGemCloseWorker>(*mm);
+    BufferObject *bos[3];
+    for (auto &bo : bos) {
+        bo = new BufferObject(this->drmMock, 3, 1, 0, 1);
+    }
+
+    worker->processBufferObjects(ArrayRef<BufferObject *>(bos));
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    if (!this->drmMock->isVmBindAvailable()) {
+        std::vector<DrmIoctl> expectedIoctls = {DrmIoctl::GemWait, DrmIoctl::GemWait, DrmIoctl::GemClose, DrmIoctl::GemClose,
+                                                DrmIoctl::GemWait, DrmIoctl::GemClose};
+        EXPECT_EQ(expectedIoctls, this->drmMock->gemWaitAndCloseIoctls);
+    }
+    EXPECT_EQ(3u, worker->getStatistics().closedBufferObjectsCount);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenPrintGemCloseWorkerStatisticsWhenWorkerIsDestroyedThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintGemCloseWorkerStatistics.set(true);
+    this->drmMock->gem_close_expected = 2;
+
+    auto worker = new WhiteBoxDrmGemCloseWorker(*mm);
+    BufferObject *bos[2] = {new BufferObject(this->drmMock, 3, 1, 0, 1), new BufferObject(this->drmMock, 3, 1, 0, 1)};
+    worker->processBufferObjects(ArrayRef<BufferObject *>(bos));
+    worker->close(true);
+
+    testing::internal::CaptureStderr();
+    delete worker;
+    auto output = testing::internal::GetCapturedStderr();
+
+    EXPECT_NE(std::string::npos, output.find("Gem close worker statistics: closed BOs: 2, drains: 1, max queue depth: 2"));
+}
@@ -142,6 +142,14 @@ TEST_P(ProcessElfBinaryTestsWithBinaryType, GivenBinaryTypeWhenResolveProgramThe
     ASSERT_EQ(binarySize, program->buildInfos[rootDeviceIndex].packedDeviceBinarySize);
     EXPECT_EQ(0, memcmp(pBinary.data(), program->buildInfos[rootDeviceIndex].packedDeviceBinary.get(), binarySize));
 
+    // device binary refers into the elf, give it own storage before deleting program's elf reference
+    auto &packedDeviceBinary = program->buildInfos[rootDeviceIndex].packedDeviceBinary;
+    auto &unpackedDeviceBinary = program->buildInfos[rootDeviceIndex].unpackedDeviceBinary;
+    EXPECT_TRUE(unpackedDeviceBinary.get_deleter().isView());
+    EXPECT_LE(packedDeviceBinary.get(), unpackedDeviceBinary.get());
+    EXPECT_GE(packedDeviceBinary.get() + binarySize, unpackedDeviceBinary.get() + genBinarySize);
+    unpackedDeviceBinary = makeCopy(genBinary.get(), genBinarySize);
+
     // delete program's elf reference to force a resolve
     program->buildInfos[rootDeviceIndex].packedDeviceBinary.reset();
     program->buildInfos[rootDeviceIndex].packedDeviceBinarySize = 0U;
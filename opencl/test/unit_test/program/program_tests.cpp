@@ -3131,6 +3131,8 @@ TEST(ProgramReplaceDeviceBinary, GivenBinaryZebinThenUseAsBothPackedAndUnpackedB
     ASSERT_NE(nullptr, program.buildInfos[rootDeviceIndex].unpackedDeviceBinary);
     EXPECT_EQ(0, memcmp(program.buildInfos[rootDeviceIndex].packedDeviceBinary.get(), zebin.storage.data(), program.buildInfos[rootDeviceIndex].packedDeviceBinarySize));
     EXPECT_EQ(0, memcmp(program.buildInfos[rootDeviceIndex].unpackedDeviceBinary.get(), zebin.storage.data(), program.buildInfos[rootDeviceIndex].unpackedDeviceBinarySize));
+    EXPECT_EQ(program.buildInfos[rootDeviceIndex].packedDeviceBinary.get(), program.buildInfos[rootDeviceIndex].unpackedDeviceBinary.get());
+    EXPECT_TRUE(program.buildInfos[rootDeviceIndex].unpackedDeviceBinary.get_deleter().isView());
 }
 
 TEST(ProgramCallbackTest, whenFunctionIsNullptrThenUserDataNeedsToBeNullptr) {
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2022 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Converts log written with LogBinaryFormat=1 to text, see shared/source/utilities/binary_log_writer.cpp
+
+import struct
+import sys
+
+MAGIC = b'NEOBLOG1'
+STRING, API_CALL, ALLOCATION, TEXT = 1, 2, 3, 4
+
+def decode(data, out):
+    if data[:len(MAGIC)] != MAGIC:
+        return False
+
+    # Records are written per thread, lines are collected and ordered by timestamp at the end
+    lines = []
+    strings = {}
+    offset = len(MAGIC)
+    while offset < len(data):
+        if len(data) - offset < 8:
+            return False
+        record_type, size = struct.unpack_from('<II', data, offset)
+        offset += 8
+        if len(data) - offset < size:
+            return False
+        payload = data[offset:offset + size]
+        offset += size
+
+        if record_type == STRING:
+            (string_id,) = struct.unpack_from('<Q', payload)
+            strings[string_id] = payload[8:].decode(errors='replace')
+        elif record_type == API_CALL:
+            timestamp, thread_id, function_id, enter, error_code = struct.unpack('<QQQIi', payload)
+            name = strings.get(function_id, 'unknown')
+            if enter:
+                lines.append((timestamp, '[%d] ThreadID: %d Function Enter: %s\n' % (timestamp, thread_id, name)))
+            else:
+                lines.append((timestamp, '[%d] ThreadID: %d Function Leave (%d): %s\n' % (timestamp, thread_id, error_code, name)))
+        elif record_type == ALLOCATION:
+            timestamp, thread_id, type_id, pool_id, gpu_address, alloc_size, root_device_index, _ = struct.unpack('<QQQQQQII', payload)
+            lines.append((timestamp, '[%d] ThreadID: %d AllocationType: %s MemoryPool: %s Root device index: %d GPU address: 0x%x - 0x%x\n' %
+                          (timestamp, thread_id, strings.get(type_id, 'unknown'), strings.get(pool_id, 'unknown'),
+                           root_device_index, gpu_address, gpu_address + alloc_size - 1)))
+        elif record_type == TEXT:
+            timestamp, thread_id = struct.unpack_from('<QQ', payload)
+            lines.append((timestamp, '[%d] %s' % (timestamp, payload[16:].decode(errors='replace'))))
+
+    # sort is stable, records with equal timestamps keep file order
+    lines.sort(key=lambda line: line[0])
+    for _, line in lines:
+        out.write(line)
+    return True
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        print('usage: %s <binary log file>' % sys.argv[0])
+        sys.exit(1)
+    with open(sys.argv[1], 'rb') as binary_log:
+        if not decode(binary_log.read(), sys.stdout):
+            print('%s is not a valid binary log' % sys.argv[1], file=sys.stderr)
+            sys.exit(1)
@@ -38,6 +38,22 @@ class AubHelper : public NonCopyableOrMovableClass {
         }
     }
 
+    static bool isGpuReadOnlyAllocationType(const AllocationType &type) {
+        switch (type) {
+        case AllocationType::COMMAND_BUFFER:
+        case AllocationType::CONSTANT_SURFACE:
+        case AllocationType::INDIRECT_OBJECT_HEAP:
+        case AllocationType::INTERNAL_HEAP:
+        case AllocationType::KERNEL_ISA:
+        case AllocationType::KERNEL_ISA_INTERNAL:
+        case AllocationType::LINEAR_STREAM:
+        case AllocationType::SURFACE_STATE_HEAP:
+            return true;
+        default:
+            return false;
+        }
+    }
+
     static uint64_t getTotalMemBankSize();
     static int getMemTrace(uint64_t pdEntryBits);
     static uint64_t getPTEntryBits(uint64_t pdEntryBits);
@@ -7,10 +7,14 @@
 
 #pragma once
 #include "shared/source/aub_mem_dump/aub_data.h"
+#include "shared/source/os_interface/os_thread.h"
 
+#include <condition_variable>
 #include <fstream>
+#include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace NEO {
 class AubHelper;
@@ -120,6 +124,20 @@ struct AubStream {
 };
 
 struct AubFileStream : public AubStream {
+    struct Statistics {
+        uint64_t bytesWritten = 0u;
+        uint64_t memoryWrites = 0u;
+        uint64_t skippedMemoryWrites = 0u;
+        uint64_t skippedMemoryBytes = 0u;
+        uint64_t fileWriteTimeNs = 0u;
+        uint64_t blockedTimeNs = 0u;
+        uint64_t flushes = 0u;
+        uint64_t deferredFlushes = 0u;
+    };
+
+    static constexpr size_t asyncWriteBufferSize = 4 * 1024 * 1024;
+
+    ~AubFileStream() override;
     void open(const char *filePath) override;
     void close() override;
     bool init(uint32_t stepping, uint32_t device) override;
@@ -139,10 +157,43 @@ struct AubFileStream : public AubStream {
                                        uint32_t addressSpace, uint32_t compareOperation);
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
+    const Statistics &getStatistics() const { return statistics; }
+    void setGpuReadOnlyMemoryWrite(bool gpuReadOnly) { gpuReadOnlyMemoryWrite = gpuReadOnly; }
 
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+  protected:
+    struct WrittenMemory {
+        uint32_t addressSpace;
+        size_t size;
+        uint64_t hash;
+    };
+
+    static void *asyncWriterFunc(void *self);
+    MOCKABLE_VIRTUAL void writeToFile(const char *data, size_t size);
+    void submitAsyncWriteBuffer(bool waitForWriter);
+    void stopAsyncWriter();
+    void printStatistics() const;
+
+    Statistics statistics;
+
+    // Contents of memory last written at a physical address, used to skip unchanged pages.
+    // Only memory which GPU does not write is skipped, other writes drop overlapping entries.
+    void invalidateWrittenMemory(uint64_t physAddress, size_t size);
+    bool skipUnchangedMemory = false;
+    bool gpuReadOnlyMemoryWrite = false;
+    std::map<uint64_t, WrittenMemory> writtenMemory;
+
+    // Data is collected in fillBuffer and written to file by asyncWriter while the next buffer is filled
+    std::unique_ptr<NEO::Thread> asyncWriter;
+    std::vector<char> fillBuffer;
+    std::vector<char> writeBuffer;
+    bool writeBufferPending = false;
+    bool stopAsyncWrite = false;
+    std::mutex asyncWriteMtx;
+    std::condition_variable asyncWriteCondition;
 };
 
 template <int addressingBits>
@@ -7,9 +7,11 @@
 
 #include "shared/source/command_stream/aub_command_stream_receiver.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
@@ -18,7 +20,9 @@
 #include "shared/source/os_interface/sys_calls_common.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <iterator>
 #include <sstream>
 
 namespace NEO {
@@ -89,24 +93,134 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 
 extern const size_t g_dwordCountMax;
 
+namespace {
+uint64_t getElapsedNs(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+} // namespace
+
+AubFileStream::~AubFileStream() {
+    stopAsyncWriter();
+}
+
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    statistics = {};
+    skipUnchangedMemory = NEO::DebugManager.flags.AUBDumpSkipUnchangedPages.get();
+    if (NEO::DebugManager.flags.AUBDumpAsyncWrite.get()) {
+        fillBuffer.reserve(asyncWriteBufferSize);
+        writeBuffer.reserve(asyncWriteBufferSize);
+        stopAsyncWrite = false;
+        asyncWriter = NEO::Thread::create(asyncWriterFunc, reinterpret_cast<void *>(this));
+    }
 }
 
 void AubFileStream::close() {
+    stopAsyncWriter();
+    printStatistics();
+    writtenMemory.clear();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    statistics.bytesWritten += size;
+    if (!asyncWriter) {
+        writeToFile(data, size);
+        return;
+    }
+
+    fillBuffer.insert(fillBuffer.end(), data, data + size);
+    if (fillBuffer.size() >= asyncWriteBufferSize) {
+        submitAsyncWriteBuffer(true);
+    }
+}
+
+void AubFileStream::writeToFile(const char *data, size_t size) {
+    auto start = std::chrono::steady_clock::now();
     fileHandle.write(data, size);
+    statistics.fileWriteTimeNs += getElapsedNs(start);
+}
+
+void *AubFileStream::asyncWriterFunc(void *self) {
+    auto stream = reinterpret_cast<AubFileStream *>(self);
+    std::unique_lock<std::mutex> lock(stream->asyncWriteMtx);
+    while (true) {
+        stream->asyncWriteCondition.wait(lock, [stream] { return stream->writeBufferPending || stream->stopAsyncWrite; });
+        if (!stream->writeBufferPending) {
+            break;
+        }
+        lock.unlock();
+        stream->writeToFile(stream->writeBuffer.data(), stream->writeBuffer.size());
+        stream->fileHandle.flush();
+        lock.lock();
+        stream->writeBuffer.clear();
+        stream->writeBufferPending = false;
+        stream->asyncWriteCondition.notify_all();
+    }
+    return nullptr;
+}
+
+void AubFileStream::submitAsyncWriteBuffer(bool waitForWriter) {
+    auto start = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(asyncWriteMtx);
+    if (writeBufferPending) {
+        if (!waitForWriter) {
+            // writer is busy, collected data is handed off with the next buffer
+            statistics.deferredFlushes++;
+            return;
+        }
+        asyncWriteCondition.wait(lock, [this] { return !writeBufferPending; });
+        statistics.blockedTimeNs += getElapsedNs(start);
+    }
+
+    if (!fillBuffer.empty()) {
+        fillBuffer.swap(writeBuffer);
+        writeBufferPending = true;
+        asyncWriteCondition.notify_all();
+    }
+}
+
+void AubFileStream::stopAsyncWriter() {
+    if (!asyncWriter) {
+        return;
+    }
+    submitAsyncWriteBuffer(true);
+    {
+        std::lock_guard<std::mutex> lock(asyncWriteMtx);
+        stopAsyncWrite = true;
+    }
+    asyncWriteCondition.notify_all();
+    asyncWriter->join();
+    asyncWriter.reset();
 }
 
 void AubFileStream::flush() {
+    statistics.flushes++;
+    if (asyncWriter) {
+        // writer flushes the file after every buffer, close() waits until all data is on disk
+        submitAsyncWriteBuffer(false);
+        return;
+    }
     fileHandle.flush();
 }
 
+void AubFileStream::printStatistics() const {
+    PRINT_DEBUG_STRING(skipUnchangedMemory || NEO::DebugManager.flags.AUBDumpAsyncWrite.get(), stderr,
+                       "AUB capture %s: %llu bytes written, %llu of %llu memory writes skipped as unchanged (%llu bytes), %llu of %llu flushes deferred, file write time: %llu ms, blocked on writer: %llu ms\n",
+                       fileName.c_str(),
+                       static_cast<unsigned long long>(statistics.bytesWritten),
+                       static_cast<unsigned long long>(statistics.skippedMemoryWrites),
+                       static_cast<unsigned long long>(statistics.memoryWrites),
+                       static_cast<unsigned long long>(statistics.skippedMemoryBytes),
+                       static_cast<unsigned long long>(statistics.deferredFlushes),
+                       static_cast<unsigned long long>(statistics.flushes),
+                       static_cast<unsigned long long>(statistics.fileWriteTimeNs / 1000000),
+                       static_cast<unsigned long long>(statistics.blockedTimeNs / 1000000));
+}
+
 bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     CmdServicesMemTraceVersion header = {};
 
@@ -133,6 +247,26 @@ bool AubFileStream::init(uint32_t stepping, uint32_t device) {
 }
 
 void AubFileStream::writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) {
+    statistics.memoryWrites++;
+    if (skipUnchangedMemory && !gpuReadOnlyMemoryWrite) {
+        // GPU may change this memory, so contents seen by previous writes are no longer known
+        invalidateWrittenMemory(physAddress, size);
+    } else if (skipUnchangedMemory) {
+        NEO::Hash hash;
+        hash.update(reinterpret_cast<const char *>(memory), size);
+        WrittenMemory contents = {addressSpace, size, hash.finish()};
+
+        auto previousContents = writtenMemory.find(physAddress);
+        if (previousContents != writtenMemory.end() && previousContents->second.addressSpace == contents.addressSpace &&
+            previousContents->second.size == contents.size && previousContents->second.hash == contents.hash) {
+            statistics.skippedMemoryWrites++;
+            statistics.skippedMemoryBytes += size;
+            return;
+        }
+        invalidateWrittenMemory(physAddress, size);
+        writtenMemory.emplace(physAddress, contents);
+    }
+
     writeMemoryWriteHeader(physAddress, size, addressSpace, hint);
 
     // Copy the contents from source to destination.
@@ -146,6 +280,19 @@ void AubFileStream::writeMemory(uint64_t physAddress, const void *memory, size_t
     }
 }
 
+void AubFileStream::invalidateWrittenMemory(uint64_t physAddress, size_t size) {
+    auto entry = writtenMemory.lower_bound(physAddress);
+    if (entry != writtenMemory.begin()) {
+        auto previousEntry = std::prev(entry);
+        if (previousEntry->first + previousEntry->second.size > physAddress) {
+            entry = previousEntry;
+        }
+    }
+    while (entry != writtenMemory.end() && entry->first < physAddress + size) {
+        entry = writtenMemory.erase(entry);
+    }
+}
+
 void AubFileStream::writeMemoryWriteHeader(uint64_t physAddress, size_t size, uint32_t addressSpace, uint32_t hint) {
     CmdServicesMemTraceMemoryWrite header = {};
     auto alignedBlockSize = (size + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
@@ -680,7 +680,9 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
     if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
     } else {
+        getAubStream()->setGpuReadOnlyMemoryWrite(AubHelper::isGpuReadOnlyAllocationType(gfxAllocation.getAllocationType()));
         writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        getAubStream()->setGpuReadOnlyMemoryWrite(false);
     }
 
     streamLocked.unlock();
@@ -99,6 +99,11 @@ CommandStreamReceiver::~CommandStreamReceiver() {
     }
     cleanupResources();
 
+    if (DebugManager.flags.PrintWaitStatistics.get() && waitPolicy.getWaitsCount() > 0u) {
+        auto name = osContext ? EngineHelpers::engineTypeToString(osContext->getEngineType()) : std::string("unknown engine");
+        waitPolicy.printStatistics(name.c_str());
+    }
+
     internalAllocationStorage->cleanAllocationList(-1, REUSABLE_ALLOCATION);
     internalAllocationStorage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
     getMemoryManager()->unregisterEngineForCsr(this);
@@ -361,6 +366,8 @@ WaitStatus CommandStreamReceiver::waitForCompletionWithTimeout(const WaitParams
         }
     }
 
+    this->releasePendingDirectSubmissions();
+
     auto retCode = baseWaitFunction(getTagAddress(), params, taskCountToWait);
     if (printWaitForCompletion) {
         printTagAddressContent(taskCountToWait, params.waitTimeout, false);
@@ -392,12 +399,24 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile uint32_t *pollAddres
 
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
+    currentTime = waitStartTime;
+    bool waited = false;
     for (uint32_t i = 0; i < activePartitions; i++) {
         while (*partitionAddress < taskCountToWait && timeDiff <= params.waitTimeout) {
             this->downloadTagAllocation(taskCountToWait);
-
-            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait)) {
-                break;
+            waited = true;
+
+            if (!params.indefinitelyPoll) {
+                bool ready = false;
+                if (WaitUtils::adaptiveWaitEnabled) {
+                    auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+                    ready = waitPolicy.waitFunction(partitionAddress, taskCountToWait, static_cast<uint64_t>(elapsedNs));
+                } else {
+                    ready = WaitUtils::waitFunction(partitionAddress, taskCountToWait);
+                }
+                if (ready) {
+                    break;
+                }
             }
 
             currentTime = std::chrono::high_resolution_clock::now();
@@ -421,6 +440,11 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile uint32_t *pollAddres
         partitionAddress = ptrOffset(partitionAddress, this->postSyncWriteOffset);
     }
 
+    if (waited) {
+        auto waitTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - waitStartTime).count();
+        waitPolicy.recordWait(static_cast<uint64_t>(waitTimeNs));
+    }
+
     return WaitStatus::Ready;
 }
 
@@ -24,6 +24,7 @@
 #include "shared/source/os_interface/os_thread.h"
 #include "shared/source/utilities/spinlock.h"
 #include "shared/source/utilities/stackvec.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include <chrono>
 #include <cstddef>
@@ -171,6 +172,7 @@ class CommandStreamReceiver {
     WaitStatus baseWaitFunction(volatile uint32_t *pollAddress, const WaitParams &params, uint32_t taskCountToWait);
     MOCKABLE_VIRTUAL bool testTaskCountReady(volatile uint32_t *pollAddress, uint32_t taskCountToWait);
     virtual void downloadAllocations(){};
+    const WaitUtils::AdaptiveWaitPolicy &getWaitPolicy() const { return waitPolicy; }
 
     void setSamplerCacheFlushRequired(SamplerCacheFlushState value) { this->samplerCacheFlushRequired = value; }
 
@@ -273,6 +275,7 @@ class CommandStreamReceiver {
     }
 
     virtual void stopDirectSubmission() {}
+    virtual void releasePendingDirectSubmissions() {}
 
     bool isStaticWorkPartitioningEnabled() const {
         return staticWorkPartitioningEnabled;
@@ -420,6 +423,7 @@ class CommandStreamReceiver {
 
     volatile uint32_t *tagAddress = nullptr;
     volatile DebugPauseState *debugPauseStateAddress = nullptr;
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
     SpinLock debugPauseStateLock;
     static void *asyncDebugBreakConfirmation(void *arg);
     std::function<void()> debugConfirmationFunction = []() { std::cin.get(); };
@@ -122,6 +122,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     }
 
     void stopDirectSubmission() override;
+    void releasePendingDirectSubmissions() override;
 
     virtual bool isKmdWaitModeActive() { return true; }
 
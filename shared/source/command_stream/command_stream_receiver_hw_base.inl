@@ -1370,6 +1370,18 @@ inline void CommandStreamReceiverHw<GfxFamily>::stopDirectSubmission() {
     }
 }
 
+template <typename GfxFamily>
+inline void CommandStreamReceiverHw<GfxFamily>::releasePendingDirectSubmissions() {
+    if (this->directSubmission.get() && this->directSubmission->hasPendingSubmissions()) {
+        auto lock = this->obtainUniqueOwnership();
+        this->directSubmission->releasePendingSubmissions();
+    }
+    if (this->blitterDirectSubmission.get() && this->blitterDirectSubmission->hasPendingSubmissions()) {
+        auto lock = this->obtainUniqueOwnership();
+        this->blitterDirectSubmission->releasePendingSubmissions();
+    }
+}
+
 template <typename GfxFamily>
 inline bool CommandStreamReceiverHw<GfxFamily>::initDirectSubmission() {
     bool ret = true;
@@ -1380,6 +1392,8 @@ inline bool CommandStreamReceiverHw<GfxFamily>::initDirectSubmission() {
     if (startDirect) {
         auto lock = this->obtainUniqueOwnership();
         if (!this->isAnyDirectSubmissionEnabled()) {
+            // controller is created first, direct submission coalesces dispatches only when controller can release them
+            auto directSubmissionController = executionEnvironment.initializeDirectSubmissionController();
             if (EngineHelpers::isBcs(this->osContext->getEngineType())) {
                 blitterDirectSubmission = DirectSubmissionHw<GfxFamily, BlitterDispatcher<GfxFamily>>::create(*this);
                 ret = blitterDirectSubmission->initialize(submitOnInit, this->isUsedNotifyEnableForPostSync());
@@ -1390,7 +1404,6 @@ inline bool CommandStreamReceiverHw<GfxFamily>::initDirectSubmission() {
                 ret = directSubmission->initialize(submitOnInit, this->isUsedNotifyEnableForPostSync());
                 completionFenceValuePointer = directSubmission->getCompletionValuePointer();
             }
-            auto directSubmissionController = executionEnvironment.initializeDirectSubmissionController();
             if (directSubmissionController) {
                 directSubmissionController->registerDirectSubmission(this);
             }
@@ -19,6 +19,8 @@
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <iomanip>
 #include <mutex>
@@ -109,20 +111,128 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+CompilerCache::~CompilerCache() {
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintBinaryCacheStatistics.get(), stderr,
+                       "Binary cache %s: hits: %llu, misses: %llu, stores: %llu, evictions: %llu, evicted bytes: %llu\n",
+                       config.cacheDir.c_str(),
+                       static_cast<unsigned long long>(statistics.hits.load()),
+                       static_cast<unsigned long long>(statistics.misses.load()),
+                       static_cast<unsigned long long>(statistics.stores.load()),
+                       static_cast<unsigned long long>(statistics.evictions.load()),
+                       static_cast<unsigned long long>(statistics.evictedBytes.load()));
+}
+
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
     std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+
+    size_t replacedFileSize = 0u;
+    if (config.cacheSize != 0u) {
+        if (binarySize > config.cacheSize) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(cacheAccessMtx);
+        // directory is scanned only on first store and when running size estimate goes over the limit
+        if (!cacheSizeEstimateValid || cacheSizeEstimate + binarySize > config.cacheSize) {
+            evictCache(config.cacheSize - binarySize);
+        }
+        replacedFileSize = getCacheFileSize(filePath);
+    }
+
+    if (!writeCacheFileAtomically(filePath, pBinary, binarySize)) {
+        return false;
+    }
+
+    if (config.cacheSize != 0u) {
+        std::lock_guard<std::mutex> lock(cacheAccessMtx);
+        cacheSizeEstimate += binarySize;
+        cacheSizeEstimate -= std::min(replacedFileSize, cacheSizeEstimate);
+    }
+    statistics.stores++;
+    return true;
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
     std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    // cache files are published with an atomic rename, so readers never observe partially written
+    // binaries and do not need to serialize with writers
+    auto binary = readCacheFile(filePath, cachedBinarySize);
+    if (binary == nullptr) {
+        statistics.misses++;
+        return binary;
+    }
+
+    statistics.hits++;
+    markCacheFileUsed(filePath);
+    return binary;
+}
+
+UniqueBinaryPtr CompilerCache::loadCachedDeviceBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
+    if (DebugManager.flags.EnableMappedBinaryCacheLoad.get() == 0) {
+        return loadCachedBinary(kernelFileHash, cachedBinarySize);
+    }
+
+    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+
+    // mapping stays alive as long as returned binary, so decoders can reference it without copying
+    auto binary = mapCacheFile(filePath, cachedBinarySize);
+    if (binary == nullptr) {
+        statistics.misses++;
+        return binary;
+    }
+
+    statistics.hits++;
+    markCacheFileUsed(filePath);
+    return binary;
+}
+
+void CompilerCache::evictCache(size_t targetCacheSize) {
+    auto files = getCacheFiles();
+
+    auto orphanedFilesBegin = std::stable_partition(files.begin(), files.end(), [](const CacheFileInfo &file) {
+        return !file.orphaned;
+    });
+    for (auto it = orphanedFilesBegin; it != files.end(); ++it) {
+        removeCacheFile(it->path);
+    }
+    files.erase(orphanedFilesBegin, files.end());
+
+    size_t currentCacheSize = 0u;
+    for (const auto &file : files) {
+        currentCacheSize += file.size;
+    }
+    cacheSizeEstimate = currentCacheSize;
+    cacheSizeEstimateValid = true;
+    if (currentCacheSize <= targetCacheSize) {
+        return;
+    }
+
+    std::sort(files.begin(), files.end(), [](const CacheFileInfo &lhs, const CacheFileInfo &rhs) {
+        return lhs.lastUsedTime < rhs.lastUsedTime;
+    });
+
+    for (const auto &file : files) {
+        if (currentCacheSize <= targetCacheSize) {
+            break;
+        }
+        if (removeCacheFile(file.path)) {
+            currentCacheSize -= file.size;
+            statistics.evictions++;
+            statistics.evictedBytes += file.size;
+        }
+    }
+    cacheSizeEstimate = currentCacheSize;
+}
+
+std::unique_ptr<char[]> CompilerCache::readCacheFile(const std::string &filePath, size_t &fileSize) {
+    return loadDataFromFile(filePath.c_str(), fileSize);
+}
+
+bool CompilerCache::removeCacheFile(const std::string &filePath) {
+    return 0 == std::remove(filePath.c_str());
 }
 
 } // namespace NEO
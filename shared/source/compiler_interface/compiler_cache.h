@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,13 +7,16 @@
 
 #pragma once
 
+#include "shared/source/helpers/binary_storage.h"
 #include "shared/source/utilities/arrayref.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace NEO {
 struct HardwareInfo;
@@ -22,12 +25,28 @@ struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
+    size_t cacheSize = 0u; // 0 - unlimited
+};
+
+struct CompilerCacheStatistics {
+    std::atomic<uint64_t> hits{0u};
+    std::atomic<uint64_t> misses{0u};
+    std::atomic<uint64_t> stores{0u};
+    std::atomic<uint64_t> evictions{0u};
+    std::atomic<uint64_t> evictedBytes{0u};
 };
 
 class CompilerCache {
   public:
+    struct CacheFileInfo {
+        std::string path;
+        size_t size = 0u;
+        uint64_t lastUsedTime = 0u;
+        bool orphaned = false; // temporary file left behind by an interrupted store
+    };
+
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -39,9 +58,36 @@ class CompilerCache {
 
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
+    MOCKABLE_VIRTUAL UniqueBinaryPtr loadCachedDeviceBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
+
+    const CompilerCacheConfig &getConfig() const { return config; }
+    const CompilerCacheStatistics &getStatistics() const { return statistics; }
+
+    // OS specific, temporary file is created in tmpFileDir and renamed to filePath
+    static bool writeFileAtomically(const std::string &tmpFileDir, const std::string &filePath, const char *pData, size_t dataSize);
 
   protected:
+    void evictCache(size_t targetCacheSize);
+
+    MOCKABLE_VIRTUAL std::unique_ptr<char[]> readCacheFile(const std::string &filePath, size_t &fileSize);
+    MOCKABLE_VIRTUAL bool removeCacheFile(const std::string &filePath);
+
+    // OS specific, see linux/compiler_cache_linux.cpp and windows/compiler_cache_windows.cpp
+    MOCKABLE_VIRTUAL UniqueBinaryPtr mapCacheFile(const std::string &filePath, size_t &fileSize);
+    MOCKABLE_VIRTUAL bool writeCacheFileAtomically(const std::string &filePath, const char *pBinary, size_t binarySize);
+    MOCKABLE_VIRTUAL void markCacheFileUsed(const std::string &filePath);
+    MOCKABLE_VIRTUAL size_t getCacheFileSize(const std::string &filePath);
+    MOCKABLE_VIRTUAL std::vector<CacheFileInfo> getCacheFiles();
+
+    // temporary files younger than this may still be written by another process
+    static constexpr uint64_t orphanedTempFileAgeSeconds = 10 * 60;
+
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
+    CompilerCacheStatistics statistics;
+
+    // Bytes stored in cache directory, refreshed from a directory scan only when over the limit
+    size_t cacheSizeEstimate = 0u;
+    bool cacheSizeEstimateValid = false;
 };
 } // namespace NEO
@@ -70,7 +70,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
                                                   input.src,
                                                   input.apiOptions,
                                                   input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+        output.deviceBinary.mem = cache->loadCachedDeviceBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
         }
@@ -123,7 +123,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                   input.apiOptions,
                                                   input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+        output.deviceBinary.mem = cache->loadCachedDeviceBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
         }
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/helpers/binary_storage.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/os_library.h"
 #include "shared/source/utilities/arrayref.h"
@@ -65,9 +66,14 @@ struct TranslationOutput {
         size_t size = 0;
     };
 
+    struct BinaryAndSize {
+        UniqueBinaryPtr mem;
+        size_t size = 0;
+    };
+
     IGC::CodeType::CodeType_t intermediateCodeType = IGC::CodeType::invalid;
     MemAndSize intermediateRepresentation;
-    MemAndSize deviceBinary;
+    BinaryAndSize deviceBinary;
     MemAndSize debugData;
     std::string frontendCompilerLog;
     std::string backendCompilerLog;
@@ -91,6 +97,17 @@ struct TranslationOutput {
         dst.size = src->GetSize<char>();
         dst.mem = ::makeCopy(src->GetMemory<void>(), src->GetSize<char>());
     }
+
+    static void makeCopy(BinaryAndSize &dst, CIF::Builtins::BufferSimple *src) {
+        if ((nullptr == src) || (src->GetSizeRaw() == 0)) {
+            dst.mem.reset();
+            dst.size = 0U;
+            return;
+        }
+
+        dst.size = src->GetSize<char>();
+        dst.mem = ::makeCopy(src->GetMemory<void>(), src->GetSize<char>());
+    }
 };
 
 struct SpecConstantInfo {
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+
+#include <cstdio>
+#include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NEO {
+
+namespace {
+void unmapCacheFile(char *ptr, size_t size) {
+    munmap(ptr, size);
+}
+} // namespace
+
+UniqueBinaryPtr CompilerCache::mapCacheFile(const std::string &filePath, size_t &fileSize) {
+    fileSize = 0u;
+
+    int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    auto mappedSize = static_cast<size_t>(fileStat.st_size);
+    // private mapping - pages are shared with page cache until written to
+    auto ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        return nullptr;
+    }
+
+    fileSize = mappedSize;
+    return UniqueBinaryPtr(static_cast<char *>(ptr), BinaryStorageDeleter(unmapCacheFile, mappedSize));
+}
+
+bool CompilerCache::writeCacheFileAtomically(const std::string &filePath, const char *pBinary, size_t binarySize) {
+    return writeFileAtomically(config.cacheDir, filePath, pBinary, binarySize);
+}
+
+bool CompilerCache::writeFileAtomically(const std::string &tmpFileDir, const std::string &filePath, const char *pBinary, size_t binarySize) {
+    std::string tmpFilePath = filePath + ".XXXXXX";
+    int fd = mkstemp(&tmpFilePath[0]);
+    if (fd < 0) {
+        return false;
+    }
+
+    size_t written = 0u;
+    while (written < binarySize) {
+        auto ret = write(fd, pBinary + written, binarySize - written);
+        if (ret <= 0) {
+            break;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    bool success = (written == binarySize);
+    success &= (0 == fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH));
+    success &= (0 == close(fd));
+
+    if (!success || 0 != rename(tmpFilePath.c_str(), filePath.c_str())) {
+        unlink(tmpFilePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void CompilerCache::markCacheFileUsed(const std::string &filePath) {
+    utimensat(AT_FDCWD, filePath.c_str(), nullptr, 0);
+}
+
+size_t CompilerCache::getCacheFileSize(const std::string &filePath) {
+    struct stat fileStat = {};
+    if (stat(filePath.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+        return 0u;
+    }
+    return static_cast<size_t>(fileStat.st_size);
+}
+
+std::vector<CompilerCache::CacheFileInfo> CompilerCache::getCacheFiles() {
+    std::vector<CacheFileInfo> files;
+
+    DIR *dir = opendir(config.cacheDir.c_str());
+    if (dir == nullptr) {
+        return files;
+    }
+
+    const auto &extension = config.cacheFileExtension;
+    // temporary files created by writeFileAtomically are named <hash><extension>.XXXXXX
+    const std::string tmpFileInfix = extension + ".";
+    const size_t tmpFileSuffixSize = tmpFileInfix.size() + 6;
+    const auto now = static_cast<uint64_t>(time(nullptr));
+
+    struct dirent *entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        std::string fileName = entry->d_name;
+        bool isCacheFile = fileName.size() > extension.size() &&
+                           fileName.compare(fileName.size() - extension.size(), extension.size(), extension) == 0;
+        bool isTmpFile = fileName.size() > tmpFileSuffixSize &&
+                         fileName.compare(fileName.size() - tmpFileSuffixSize, tmpFileInfix.size(), tmpFileInfix) == 0;
+        if (!isCacheFile && !isTmpFile) {
+            continue;
+        }
+
+        CacheFileInfo fileInfo;
+        fileInfo.path = config.cacheDir + "/" + fileName;
+
+        struct stat fileStat = {};
+        if (stat(fileInfo.path.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+            continue;
+        }
+        if (isTmpFile) {
+            if (now < static_cast<uint64_t>(fileStat.st_mtim.tv_sec) + orphanedTempFileAgeSeconds) {
+                continue;
+            }
+            fileInfo.orphaned = true;
+        }
+        fileInfo.size = static_cast<size_t>(fileStat.st_size);
+        fileInfo.lastUsedTime = static_cast<uint64_t>(fileStat.st_mtim.tv_sec) * 1000000000ull + static_cast<uint64_t>(fileStat.st_mtim.tv_nsec);
+        files.push_back(std::move(fileInfo));
+    }
+
+    closedir(dir);
+    return files;
+}
+
+} // namespace NEO
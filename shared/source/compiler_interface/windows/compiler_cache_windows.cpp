@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace NEO {
+
+UniqueBinaryPtr CompilerCache::mapCacheFile(const std::string &filePath, size_t &fileSize) {
+    return readCacheFile(filePath, fileSize);
+}
+
+bool CompilerCache::writeCacheFileAtomically(const std::string &filePath, const char *pBinary, size_t binarySize) {
+    return writeFileAtomically(config.cacheDir, filePath, pBinary, binarySize);
+}
+
+bool CompilerCache::writeFileAtomically(const std::string &tmpFileDir, const std::string &filePath, const char *pBinary, size_t binarySize) {
+    char tmpFilePath[MAX_PATH] = {};
+    if (0 == GetTempFileNameA(tmpFileDir.c_str(), "tmp", 0, tmpFilePath)) {
+        return false;
+    }
+
+    if (binarySize != writeDataToFile(tmpFilePath, pBinary, binarySize) ||
+        0 == MoveFileExA(tmpFilePath, filePath.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        DeleteFileA(tmpFilePath);
+        return false;
+    }
+    return true;
+}
+
+void CompilerCache::markCacheFileUsed(const std::string &filePath) {
+    HANDLE file = CreateFileA(filePath.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    FILETIME now = {};
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file, nullptr, nullptr, &now);
+    CloseHandle(file);
+}
+
+size_t CompilerCache::getCacheFileSize(const std::string &filePath) {
+    WIN32_FILE_ATTRIBUTE_DATA fileData = {};
+    if (0 == GetFileAttributesExA(filePath.c_str(), GetFileExInfoStandard, &fileData) ||
+        (fileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+        return 0u;
+    }
+    return static_cast<size_t>((static_cast<uint64_t>(fileData.nFileSizeHigh) << 32) | fileData.nFileSizeLow);
+}
+
+std::vector<CompilerCache::CacheFileInfo> CompilerCache::getCacheFiles() {
+    std::vector<CacheFileInfo> files;
+
+    WIN32_FIND_DATAA ffd;
+    std::string pattern = config.cacheDir + "/*" + config.cacheFileExtension;
+    HANDLE hFind = FindFirstFileA(pattern.c_str(), &ffd);
+    if (INVALID_HANDLE_VALUE != hFind) {
+        do {
+            if (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+                continue;
+            }
+            CacheFileInfo fileInfo;
+            fileInfo.path = config.cacheDir + "/" + ffd.cFileName;
+            fileInfo.size = static_cast<size_t>((static_cast<uint64_t>(ffd.nFileSizeHigh) << 32) | ffd.nFileSizeLow);
+            fileInfo.lastUsedTime = (static_cast<uint64_t>(ffd.ftLastWriteTime.dwHighDateTime) << 32) | ffd.ftLastWriteTime.dwLowDateTime;
+            files.push_back(std::move(fileInfo));
+        } while (FindNextFileA(hFind, &ffd) != 0);
+        FindClose(hFind);
+    }
+
+    // temporary files created by writeFileAtomically in cache directory are named tmpXXXX.tmp
+    pattern = config.cacheDir + "/tmp*.tmp";
+    hFind = FindFirstFileA(pattern.c_str(), &ffd);
+    if (INVALID_HANDLE_VALUE == hFind) {
+        return files;
+    }
+
+    FILETIME now = {};
+    GetSystemTimeAsFileTime(&now);
+    const uint64_t fileTimeTicksPerSecond = 10000000u;
+    const uint64_t orphanedBefore = ((static_cast<uint64_t>(now.dwHighDateTime) << 32) | now.dwLowDateTime) - orphanedTempFileAgeSeconds * fileTimeTicksPerSecond;
+
+    do {
+        uint64_t lastWriteTime = (static_cast<uint64_t>(ffd.ftLastWriteTime.dwHighDateTime) << 32) | ffd.ftLastWriteTime.dwLowDateTime;
+        if ((ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) || lastWriteTime > orphanedBefore) {
+            continue;
+        }
+        CacheFileInfo fileInfo;
+        fileInfo.path = config.cacheDir + "/" + ffd.cFileName;
+        fileInfo.size = static_cast<size_t>((static_cast<uint64_t>(ffd.nFileSizeHigh) << 32) | ffd.nFileSizeLow);
+        fileInfo.lastUsedTime = lastWriteTime;
+        fileInfo.orphaned = true;
+        files.push_back(std::move(fileInfo));
+    } while (FindNextFileA(hFind, &ffd) != 0);
+
+    FindClose(hFind);
+    return files;
+}
+
+} // namespace NEO
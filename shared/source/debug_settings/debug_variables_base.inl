@@ -37,6 +37,8 @@ DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumpi
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueSVMMemcpyOnly, false, "Force dumping allocations on clEnqueueSVMMemcpy only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
 DECLARE_DEBUG_VARIABLE(bool, GenerateAubFilePerProcessId, false, "Generate aub file with process id")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpAsyncWrite, false, "Write AUB file from a background thread, applies only when UseAubStream is disabled")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpSkipUnchangedPages, false, "Skip writes of command buffers, heaps, kernel ISA and constant surfaces identical to the last write at the same physical address, applies only when UseAubStream is disabled")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableSWTags, false, "Enable software tagging in batch buffer")
@@ -86,6 +88,8 @@ DECLARE_DEBUG_VARIABLE(std::string, LoadBinarySipFromFile, std::string("unk"), "
 DECLARE_DEBUG_VARIABLE(std::string, InjectInternalBuildOptions, std::string("unk"), "Appends internal build options string to user modules")
 DECLARE_DEBUG_VARIABLE(std::string, InjectApiBuildOptions, std::string("unk"), "Appends api build options string to user modules")
 DECLARE_DEBUG_VARIABLE(std::string, OverrideDeviceName, std::string("unk"), "Device name to override")
+DECLARE_DEBUG_VARIABLE(std::string, KernelTuningDatabasePath, std::string("unk"), "Path of the file storing kernel tuning results, unk: default (kernel_tuning.db in compiler cache directory)")
+DECLARE_DEBUG_VARIABLE(std::string, ChromeTraceFile, std::string("unk"), "Path of file to write Chrome trace json with API calls, submissions and GPU timestamp packets into, unk: disabled")
 DECLARE_DEBUG_VARIABLE(int64_t, OverrideMultiStoragePlacement, -1, "-1: disable, 0+: tile mask, each bit corresponds to tile")
 DECLARE_DEBUG_VARIABLE(int64_t, ForceCompressionDisabledForCompressedBlitCopies, -1, "-1: default, 0: disabled, 1: enabled. If compression is required, set AUX_CCS_E, but force CompressionEnable filed. 0 should result in uncompressed read/write")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceL1Caching, -1, "-1: default, 0: disable, 1: enable, When set to true driver will program L1 cache policy for surface state and stateless accesses")
@@ -241,14 +245,17 @@ DECLARE_DEBUG_VARIABLE(bool, LogAlignedAllocations, false, "Logs alignedMalloc a
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationMemoryPool, false, "Logs memory pool for allocations")
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationType, false, "Logs allocation type to stdout")
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationStdout, false, "Log allocations to stdout instead of file")
+DECLARE_DEBUG_VARIABLE(bool, LogBinaryFormat, false, "Write api call, allocation and debug log records to log file in binary format from a background thread, decode with scripts/decode_binary_log.py")
 DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, sizes and operations")
 DECLARE_DEBUG_VARIABLE(bool, LogWaitingForCompletion, false, "Logs waiting for completion")
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
 DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver chosen local workgroup sizes")
+DECLARE_DEBUG_VARIABLE(bool, PrintLocalWorkSizeCacheStatistics, false, "Print hits and misses of per kernel local work size cache when kernel is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch parameters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(bool, PrintProgramBinaryProcessingTime, false, "prints execution time of Program::processGenBinary() method during program building")
+DECLARE_DEBUG_VARIABLE(bool, PrintModuleCreationStatistics, false, "prints number of kernels, number of kernel ISA allocations and creation time of each created L0 module")
 DECLARE_DEBUG_VARIABLE(bool, PrintRelocations, false, "prints relocations debug information")
 DECLARE_DEBUG_VARIABLE(bool, PrintTimestampPacketContents, false, "prints all timestamps values during profiling data calculation")
 DECLARE_DEBUG_VARIABLE(bool, WddmResidencyLogger, false, "gather Wddm residency statistics to file")
@@ -260,6 +267,12 @@ DECLARE_DEBUG_VARIABLE(bool, PrintBlitDispatchDetails, false, "Print blit dispat
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlTimes, false, "Print ioctl times")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlEntries, false, "Print ioctl being called")
 DECLARE_DEBUG_VARIABLE(bool, PrintUmdSharedMigration, false, "Print log message when shared allocation is being migrated by UMD")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedAllocationMigrationChunkSize, -1, "-1: default (migrate whole allocation), >0: migrate shared allocations between CPU and GPU in chunks of given size in bytes, aligned up to page size")
+DECLARE_DEBUG_VARIABLE(bool, PrintGemCloseWorkerStatistics, false, "Print number of BOs closed by gem close worker, queue depth and drain time when gem close worker is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintUSMAllocationCacheStatistics, false, "Print hits, misses, rejected inserts and trims of USM allocation caches when SVM allocs manager is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintUSMAllocationPoolStatistics, false, "Print L0 USM allocation pool hit rate, created and released pools and saved graphics allocations when context is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintSmallBufferPoolStatistics, false, "Print small buffer pool hit rate, created and released pools and saved graphics allocations when context is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, PrintPageFaultStatistics, false, "Print number of CPU page faults handled for shared allocations, number of faults not matching any shared allocation and handling time to stderr when page fault manager is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, PrintImageBlitBlockCopyCmdDetails, false, "Prints XY_BLOCK_COPY_BLT command details")
 DECLARE_DEBUG_VARIABLE(bool, PrintCompletionFenceUsage, false, "Prints all usages of DRM completion fences")
 DECLARE_DEBUG_VARIABLE(bool, LogGdiCalls, false, "Log GDI calls")
@@ -288,6 +301,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platfor
 DECLARE_DEBUG_VARIABLE(int32_t, EventWaitOnHost, -1, "Wait for events on host instead of program semaphores for them, works for append kernel launch with immediate command list, -1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EventWaitOnHostNumClients, -1, "Number of command queues created within csr from which event wait on host will be applied, -1: default=2, >=0: client count")
 DECLARE_DEBUG_VARIABLE(int32_t, EventWaitOnHostNumThreads, -1, "Thread count from which event wait on host will be applied, -1: default=2, >=0: thread count")
+DECLARE_DEBUG_VARIABLE(int32_t, EventHostSynchronizeSpinTime, -1, "Time in microseconds of polling event before waiting on completion of command stream receiver which signals it, -1: default=50, >=0: time")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventHostSynchronizeCsrWait, -1, "Wait on completion of command stream receiver which signals event in event host synchronize, -1: default (enabled), 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalkerForAllQueues, -1, "Enable cache flush after walker even if queue doesn't require it")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideKernelSizeLimitForSmallDispatch, -1, "-1: default, >=0: on XEHP+ changes the threshold for treating kernel as small during NULL LWS selection")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideUseKmdWaitFunction, -1, "-1: default (L0: disabled), 0: disabled, 1: enabled. It uses only busy loop to wait or busy loop with KMD wait function, when KMD fallback is enabled")
@@ -300,6 +315,10 @@ DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQBcsInitialization, -1, "-1: default, 0:
 DECLARE_DEBUG_VARIABLE(int32_t, PreferInternalBcsEngine, -1, "-1: default, 0:disabled, 1: enabled. When enabled use internal BCS engine for internal transfers, when disabled use regular engine")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsCopy, -1, "-1: default, 0:disabled, 1: enabled. When enqueues copy to main copy engine then split between even linked copy engines")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default, >0: bitmask: indicates bcs engines for split")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMinChunkSize, -1, "-1: default (1MB), >0: minimal size in bytes of copy chunk submitted to single bcs engine when splitting")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsLoadBalancing, -1, "-1: default (enabled), 0: disabled, 1: enabled. Prefer bcs engines with fewer outstanding tasks and give them bigger chunks when splitting")
+DECLARE_DEBUG_VARIABLE(bool, PrintBcsSplitStatistics, false, "prints number of split copies and bytes routed to each bcs engine when split engines are released")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelIsaPooling, -1, "-1: default (disabled), 0: disabled, 1: enabled. Places ISA of all kernels of a module in shared allocations instead of one allocation per kernel")
 DECLARE_DEBUG_VARIABLE(int32_t, ReuseKernelBinaries, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver reuses kernel binaries.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers and heaps at initialization of immediate command list.")
 
@@ -322,6 +341,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableMonitorFence, -1, "Disabl
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmissionController, -1, "Enable direct submission terminating after given timeout, -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerTimeout, -1, "Set direct submission controller timeout, -1: default 5000 us, >=0: timeout in us")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerDivisor, -1, "Set direct submission controller timeout divider, -1: default 1, >0: divider value")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerMaxTimeout, -1, "Set upper limit of idle timeout learned from submission gaps, -1: default 50000 us, >=0: timeout in us")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionForceLocalMemoryStorageMode, -1, "Force local memory storage for command/ring/semaphore buffer, -1: default - for all engines, 0: disabled, 1: for multiOsContextCapable engine, 2: for all engines")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableRingSwitchTagUpdateWa, -1, "-1: default, 0 - disable, 1 - enable. If enabled, completionFences wont be updated if ring is not running.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionReadBackCommandBuffer, -1, "-1: default - disabled, 0 - disable, 1 - enable. If enabled, read first dword of cmd buffer after handling residency.")
@@ -329,8 +349,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionReadBackRingBuffer, -1, "-1: def
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionInsertExtraMiMemFenceCommands, -1, "-1: default, 0 - disable, 1 - enable. If enabled, add extra MI_MEM_FENCE instructions with acquire bit set")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionInsertSfenceInstructionPriorToSubmission, -1, "-1: default, 0 - disable, 1 - Insert _mm_sfence before unlocking semaphore only, 2 - insert before and after semaphore")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMaxRingBuffers, -1, "-1: default, >0: max ring buffer count, During switch ring buffer, if there is no available ring, wait for completion instead of allocating new one if DirectSubmissionMaxRingBuffers is reached")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionBlitterRingBufferSize, -1, "-1: default - 256, >0: size in KB of each blitter engine ring buffer, minimum is 64")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRenderRingBufferSize, -1, "-1: default - 256, >0: size in KB of each render engine ring buffer, minimum is 64")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionComputeRingBufferSize, -1, "-1: default - 256, >0: size in KB of each compute engine ring buffer, minimum is 64")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisablePrefetcher, -1, "-1: default, 0 - disable, 1 - enable. If enabled, disable prefetcher is being dispatched")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionCoalescingWindow, -1, "-1: default - disabled, 0: disabled, >0: max time in us semaphore release of consecutive dispatches is delayed to coalesce them")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionCoalescingMaxBytes, -1, "-1: default - 4096, >0: max ring bytes dispatched under one coalesced semaphore release")
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
+DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionControllerPrintStatistics, false, "Print ring start and stop counts and ring idle time when direct submission controller is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintRingBufferStatistics, false, "Print ring buffer count and number of submissions stalled on ring buffer reuse when direct submission resources are released")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableL0ReadLUIDExtension, false, "Enables Support for L0 Extension for reading the LUID from WDDM.")
@@ -356,9 +383,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, ReturnSubDevicesAsApiDevices, -1, "Expose each s
 DECLARE_DEBUG_VARIABLE(int32_t, ForceRunAloneContext, -1, "Control creation of run-alone HW context, -1:default, 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, AddClGlSharing, -1, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelWorkgroupSizeTuning, -1, "Select local work size of kernels enqueued without one by timing candidate sizes, -1:default(disabled), 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTuningPersistence, -1, "Store kernel tuning results in a file and reuse them in subsequent runs, -1:default(enabled), 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalWorkSizeCache, -1, "Reuse local work size computed for previous dispatch of kernel with the same global size, -1:default(enabled), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerBatchSize, -1, "-1: default (32), >0: number of buffer objects waited for and closed together by gem close worker")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrValidation, -1, "Validate BO from GEM_USERPTR, -1:default(enable), 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSysmanFileHandleCache, -1, "Keep sysman sysfs and telemetry files open between reads, -1:default(disabled), 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIncrementalProcessScan, -1, "Reuse file names of process file descriptors resolved by previous /proc scans while descriptors refer to the same files, -1:default(disabled), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_advanced_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
@@ -394,6 +427,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseBindlessMode, -1, "Use precompiled builtins i
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmSize, -1, "Force different slm size than default in kB")
 DECLARE_DEBUG_VARIABLE(int32_t, UseCyclesPerSecondTimer, 0, "0: default behavior, 0: disabled: Report L0 timer in nanosecond units, 1: enabled: Report L0 timer in cycles per second")
 DECLARE_DEBUG_VARIABLE(int32_t, WaitLoopCount, -1, "-1: use default, >=0: number of iterations in wait loop")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveWaitPolicy, -1, "-1: default (disabled), 0: disabled, 1: enabled. Spin, yield or sleep while polling completion tag depending on wait latency observed on given engine")
+DECLARE_DEBUG_VARIABLE(bool, PrintWaitStatistics, false, "prints number of waits, estimated latency and wait time histogram of each command stream receiver when it is destroyed")
 DECLARE_DEBUG_VARIABLE(int32_t, GTPinAllocateBufferInSharedMemory, -1, "Force GTPin to allocate buffer in shared memory")
 DECLARE_DEBUG_VARIABLE(int32_t, AlignLocalMemoryVaTo2MB, -1, "Allow 2MB pages for allocations with size>=2MB. On Linux it means aligned VA, on Windows it means aligned size. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableUserFenceForCompletionWait, -1, "-1: default (disabled), 0: disable, 1: enable : Use Wait User Fence instead Gem Wait")
@@ -436,10 +471,20 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSetWalkerPartitionCount, 0, "Experim
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSetWalkerPartitionType, -1, "Experimental implementation: Set COMPUTE_WALKER Partition Type. Valid values for types from 1 to 3")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableCustomLocalMemoryAlignment, 0, "Align local memory allocations to a given value. Works only with allocations at least as big as the value.  0: no effect, 2097152: 2 megabytes, 1073741824: 1 gigabyte")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableDeviceAllocationCache, -1, "Experimentally enable allocation cache.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableHostAllocationCache, -1, "Experimentally enable host USM allocation cache.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableSharedAllocationCache, -1, "Experimentally enable shared USM allocation cache.")
+DECLARE_DEBUG_VARIABLE(int64_t, USMAllocationCacheMaxSize, -1, "-1: default (1GB), >=0: maximal number of bytes kept in each USM allocation cache")
+DECLARE_DEBUG_VARIABLE(int32_t, USMAllocationCacheTrimThreshold, -1, "-1: default (90), 0-100: local memory usage percentage above which USM allocation caches are trimmed before allocating")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableUSMAllocationPool, -1, "Experimentally enable suballocating small L0 USM allocations from pools. Pooled allocations cannot be exported with IPC handles.")
+DECLARE_DEBUG_VARIABLE(int32_t, USMAllocationPoolSize, -1, "-1: default (2MB), >0: size of a single L0 USM allocation pool, aligned up to page size")
+DECLARE_DEBUG_VARIABLE(int32_t, USMAllocationPoolThreshold, -1, "-1: default (4KB), >0: largest L0 USM allocation size suballocated from pool")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default treshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default treshold (in bytes) for D2H CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
-DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer up to SmallBufferPoolAllocatorThreshold (default 4KB).")
+DECLARE_DEBUG_VARIABLE(int32_t, SmallBufferPoolAllocatorPoolSize, -1, "-1: default (64KB), >0: size of a single small buffer pool, raised to hold at least 16 buffers of threshold size")
+DECLARE_DEBUG_VARIABLE(int32_t, SmallBufferPoolAllocatorThreshold, -1, "-1: default (4KB), >0: largest buffer size allocated from small buffer pool")
+DECLARE_DEBUG_VARIABLE(int32_t, SmallBufferPoolAllocatorMaxPools, -1, "-1: default (32), >0: maximal number of small buffer pools per context")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableSourceLevelDebugger, false, "Experimentally enable source level debugger.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
@@ -496,3 +541,5 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableStateComputeModeTracking, -1, "-1: default
 DECLARE_DEBUG_VARIABLE(int32_t, EnableSetPair, -1, "Use SET_PAIR to pair two buffer objects behind the same file descriptor, -1: default, 0: disabled, 1: enabled")
 /* Binary Cache */
 DECLARE_DEBUG_VARIABLE(bool, BinaryCacheTrace, false, "enable cl_cache to produce .trace files with information about hash computation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableMappedBinaryCacheLoad, -1, "-1: default (enabled), 0: disable, 1: enable. Map cached device binaries into memory instead of reading them to a heap copy")
+DECLARE_DEBUG_VARIABLE(bool, PrintBinaryCacheStatistics, false, "prints binary cache hits, misses, stores and evictions to standard error when cache is destroyed")
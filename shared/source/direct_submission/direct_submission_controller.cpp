@@ -8,10 +8,14 @@
 #include "shared/source/direct_submission/direct_submission_controller.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cinttypes>
+#include <cstdio>
 
 namespace NEO {
 
@@ -22,22 +26,35 @@ DirectSubmissionController::DirectSubmissionController() {
     if (DebugManager.flags.DirectSubmissionControllerDivisor.get() != -1) {
         timeoutDivisor = DebugManager.flags.DirectSubmissionControllerDivisor.get();
     }
+    if (DebugManager.flags.DirectSubmissionControllerMaxTimeout.get() != -1) {
+        maxTimeout = DebugManager.flags.DirectSubmissionControllerMaxTimeout.get();
+    }
+    if (DebugManager.flags.DirectSubmissionCoalescingWindow.get() > 0) {
+        coalescingWindow = DebugManager.flags.DirectSubmissionCoalescingWindow.get();
+    }
 
     directSubmissionControllingThread = Thread::create(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
-    keepControlling.store(false);
+    stopControlling();
     if (directSubmissionControllingThread) {
         directSubmissionControllingThread->join();
         directSubmissionControllingThread.reset();
     }
+
+    PRINT_DEBUG_STRING(DebugManager.flags.DirectSubmissionControllerPrintStatistics.get(), stderr,
+                       "Direct submission controller: ring starts: %" PRIu64 ", ring stops: %" PRIu64 ", ring idle time: %" PRIu64 " us\n",
+                       statistics.ringStarts, statistics.ringStops, statistics.ringIdleTime);
 }
 
 void DirectSubmissionController::registerDirectSubmission(CommandStreamReceiver *csr) {
-    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
-    directSubmissions.insert(std::make_pair(csr, DirectSubmissionState{}));
-    this->adjustTimeout(csr);
+    {
+        std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+        directSubmissions.insert(std::make_pair(csr, DirectSubmissionState{}));
+        this->adjustTimeout(csr);
+    }
+    this->notifySubmission();
 }
 
 void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceiver *csr) {
@@ -47,54 +64,125 @@ void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceive
 
 void DirectSubmissionController::startControlling() {
     this->runControlling.store(true);
+    this->notifySubmission();
 }
 
-void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
-    auto controller = reinterpret_cast<DirectSubmissionController *>(self);
+DirectSubmissionController::Statistics DirectSubmissionController::getStatistics() {
+    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+    return statistics;
+}
 
-    while (!controller->runControlling.load()) {
-        if (!controller->keepControlling.load()) {
-            return nullptr;
-        }
+void DirectSubmissionController::notifySubmission() {
+    this->submissionsCount++;
+    if (this->waitingForSubmissions.load()) {
+        std::lock_guard<std::mutex> lock(this->condVarMutex);
+        this->condVar.notify_one();
+    }
+}
 
-        controller->sleep();
+void DirectSubmissionController::stopControlling() {
+    {
+        std::lock_guard<std::mutex> lock(this->condVarMutex);
+        this->keepControlling.store(false);
     }
+    this->condVar.notify_all();
+}
+
+void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
+    auto controller = reinterpret_cast<DirectSubmissionController *>(self);
 
     while (true) {
+        controller->sleep();
+
         if (!controller->keepControlling.load()) {
             return nullptr;
         }
 
-        controller->sleep();
-        controller->checkNewSubmissions();
+        if (controller->runControlling.load()) {
+            controller->checkNewSubmissions();
+        }
     }
 }
 
 void DirectSubmissionController::checkNewSubmissions() {
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    auto currentTime = this->getCurrentTimeUs();
+    this->nextCheckTime = 0u;
 
     for (auto &directSubmission : this->directSubmissions) {
         auto csr = directSubmission.first;
         auto &state = directSubmission.second;
 
         auto taskCount = csr->peekTaskCount();
-        if (taskCount == state.taskCount) {
+        if (taskCount != state.taskCount) {
             if (state.isStopped) {
-                continue;
-            } else {
-                auto lock = csr->obtainUniqueOwnership();
-                csr->stopDirectSubmission();
-                state.isStopped = true;
+                if (state.wasStarted) {
+                    this->updateIdleTimeout(state, currentTime - state.lastSubmissionTime);
+                }
+                state.isStopped = false;
+                state.wasStarted = true;
+                this->statistics.ringStarts++;
             }
-        } else {
-            state.isStopped = false;
             state.taskCount = taskCount;
+            state.lastSubmissionTime = currentTime;
+        } else if (!state.isStopped && currentTime - state.lastSubmissionTime >= this->getIdleTimeout(state)) {
+            auto lock = csr->obtainUniqueOwnership();
+            csr->stopDirectSubmission();
+            state.isStopped = true;
+            this->statistics.ringStops++;
+            this->statistics.ringIdleTime += currentTime - state.lastSubmissionTime;
+        }
+
+        if (!state.isStopped) {
+            csr->releasePendingDirectSubmissions();
+
+            auto idleDeadline = state.lastSubmissionTime + this->getIdleTimeout(state);
+            if (this->coalescingWindow > 0u) {
+                idleDeadline = std::min(idleDeadline, currentTime + this->coalescingWindow);
+            }
+            if (this->nextCheckTime == 0u || idleDeadline < this->nextCheckTime) {
+                this->nextCheckTime = idleDeadline;
+            }
         }
     }
 }
 
+void DirectSubmissionController::updateIdleTimeout(DirectSubmissionState &state, uint64_t idleGap) {
+    // Ring is kept running across gaps seen recently, gaps too long to bridge stop it after the base timeout
+    state.averageIdleGap = (state.averageIdleGap == 0u) ? idleGap : (3 * state.averageIdleGap + idleGap) / 4;
+    auto bridgedIdleGap = state.averageIdleGap + state.averageIdleGap / 2;
+    state.idleTimeout = (bridgedIdleGap <= static_cast<uint64_t>(this->maxTimeout)) ? bridgedIdleGap : 0u;
+}
+
+uint64_t DirectSubmissionController::getIdleTimeout(const DirectSubmissionState &state) const {
+    return std::max(state.idleTimeout, static_cast<uint64_t>(this->timeout));
+}
+
 void DirectSubmissionController::sleep() {
-    std::this_thread::sleep_for(std::chrono::microseconds(this->timeout));
+    std::unique_lock<std::mutex> lock(this->condVarMutex);
+    if (this->nextCheckTime == 0u) {
+        this->waitingForSubmissions.store(true);
+        this->condVar.wait(lock, [this] { return this->submissionsCount.load() != this->seenSubmissionsCount || !this->keepControlling.load(); });
+        this->waitingForSubmissions.store(false);
+        this->seenSubmissionsCount = this->submissionsCount.load();
+
+        // Task count is updated after the flush which notified the controller
+        auto checkInterval = static_cast<uint64_t>(this->timeout);
+        if (this->coalescingWindow > 0u) {
+            checkInterval = std::min(checkInterval, this->coalescingWindow);
+        }
+        this->nextCheckTime = this->getCurrentTimeUs() + checkInterval;
+    }
+
+    auto currentTime = this->getCurrentTimeUs();
+    if (this->nextCheckTime > currentTime) {
+        this->condVar.wait_for(lock, std::chrono::microseconds(this->nextCheckTime - currentTime), [this] { return !this->keepControlling.load(); });
+    }
+    this->nextCheckTime = 0u;
+}
+
+uint64_t DirectSubmissionController::getCurrentTimeUs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
 }
 
 void DirectSubmissionController::adjustTimeout(CommandStreamReceiver *csr) {
@@ -11,6 +11,7 @@
 
 #include <array>
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -20,28 +21,52 @@ class MemoryManager;
 class CommandStreamReceiver;
 class Thread;
 
+// Stops direct submission rings after an idle period learned per CSR from its
+// submission gaps. The controlling thread sleeps until the nearest idle deadline
+// and blocks until the next submission when no ring is running. With submission
+// coalescing enabled running rings are also checked every coalescing window to
+// release dispatches still waiting for their semaphore.
 class DirectSubmissionController {
   public:
+    struct Statistics {
+        uint64_t ringStarts = 0u;
+        uint64_t ringStops = 0u;
+        uint64_t ringIdleTime = 0u;
+    };
+
     DirectSubmissionController();
     virtual ~DirectSubmissionController();
 
     void registerDirectSubmission(CommandStreamReceiver *csr);
     void unregisterDirectSubmission(CommandStreamReceiver *csr);
 
+    // Called on every flush to a direct submission ring
     void startControlling();
+    bool isControlling() const { return runControlling.load() && keepControlling.load(); }
+
+    Statistics getStatistics();
 
     static bool isSupported();
 
   protected:
     struct DirectSubmissionState {
         bool isStopped = true;
+        bool wasStarted = false;
         uint32_t taskCount = 0u;
+        uint64_t lastSubmissionTime = 0u;
+        uint64_t averageIdleGap = 0u;
+        uint64_t idleTimeout = 0u;
     };
 
     static void *controlDirectSubmissionsState(void *self);
     void checkNewSubmissions();
     MOCKABLE_VIRTUAL void sleep();
+    MOCKABLE_VIRTUAL uint64_t getCurrentTimeUs();
 
+    void notifySubmission();
+    void stopControlling();
+    void updateIdleTimeout(DirectSubmissionState &state, uint64_t idleGap);
+    uint64_t getIdleTimeout(const DirectSubmissionState &state) const;
     void adjustTimeout(CommandStreamReceiver *csr);
 
     uint32_t maxCcsCount = 1u;
@@ -53,7 +78,19 @@ class DirectSubmissionController {
     std::atomic_bool keepControlling = true;
     std::atomic_bool runControlling = false;
 
+    // Submissions are counted so the controlling thread does not miss one that races with going idle
+    std::atomic<uint64_t> submissionsCount{0u};
+    std::atomic_bool waitingForSubmissions = false;
+    uint64_t seenSubmissionsCount = 0u;
+    uint64_t nextCheckTime = 0u;
+    std::condition_variable condVar;
+    std::mutex condVarMutex;
+
+    Statistics statistics;
+
     int timeout = 5000;
     int timeoutDivisor = 1;
+    int maxTimeout = 50000;
+    uint64_t coalescingWindow = 0u;
 };
 } // namespace NEO
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "shared/source/direct_submission/direct_submission_hw.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/execution_environment/execution_environment.h"
 
 namespace NEO {
 DirectSubmissionInputParams::DirectSubmissionInputParams(const CommandStreamReceiver &commandStreamReceiver) : osContext(commandStreamReceiver.getOsContext()), rootDeviceEnvironment(commandStreamReceiver.peekRootDeviceEnvironment()), rootDeviceIndex(commandStreamReceiver.getRootDeviceIndex()) {
@@ -16,6 +17,7 @@ DirectSubmissionInputParams::DirectSubmissionInputParams(const CommandStreamRece
     globalFenceAllocation = commandStreamReceiver.getGlobalFenceAllocation();
     workPartitionAllocation = commandStreamReceiver.getWorkPartitionAllocation();
     completionFenceAllocation = commandStreamReceiver.getTagAllocation();
+    directSubmissionController = commandStreamReceiver.peekExecutionEnvironment().directSubmissionController.get();
 }
 
 } // namespace NEO
@@ -12,6 +12,8 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 
 namespace NEO {
@@ -58,6 +60,7 @@ class LogicalStateHelper;
 struct HardwareInfo;
 class OsContext;
 class MemoryOperationsHandler;
+class DirectSubmissionController;
 
 struct DirectSubmissionInputParams : NonCopyableClass {
     DirectSubmissionInputParams(const CommandStreamReceiver &commandStreamReceiver);
@@ -68,6 +71,7 @@ struct DirectSubmissionInputParams : NonCopyableClass {
     const GraphicsAllocation *globalFenceAllocation = nullptr;
     GraphicsAllocation *workPartitionAllocation = nullptr;
     GraphicsAllocation *completionFenceAllocation = nullptr;
+    DirectSubmissionController *directSubmissionController = nullptr;
     const uint32_t rootDeviceIndex;
 };
 
@@ -86,6 +90,10 @@ class DirectSubmissionHw {
 
     MOCKABLE_VIRTUAL bool dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp);
 
+    bool hasPendingSubmissions() const { return pendingSubmissions.load(); }
+    uint32_t getRingBufferReuseStallsCount() const { return ringBufferReuseStalls; }
+    void releasePendingSubmissions();
+
     static std::unique_ptr<DirectSubmissionHw<GfxFamily, Dispatcher>> create(const DirectSubmissionInputParams &inputParams);
 
     virtual uint32_t *getCompletionValuePointer() { return nullptr; }
@@ -105,9 +113,12 @@ class DirectSubmissionHw {
     virtual uint64_t switchRingBuffers();
     virtual void handleSwitchRingBuffers() = 0;
     GraphicsAllocation *switchRingBuffersAllocations();
+    GraphicsAllocation *allocateRingBuffer();
+    void releaseIdleRingBuffers();
     virtual uint64_t updateTagValue() = 0;
     virtual void getTagAddressValue(TagData &tagData) = 0;
-    void unblockGpu();
+    void unblockGpu(uint32_t queueWorkCount);
+    bool isSubmissionCoalesced(size_t dispatchedSize);
 
     void cpuCachelineFlush(void *ptr, size_t size);
 
@@ -163,6 +174,8 @@ class DirectSubmissionHw {
     uint32_t currentRingBuffer = 0u;
     uint32_t previousRingBuffer = 0u;
     uint32_t maxRingBufferCount = std::numeric_limits<uint32_t>::max();
+    uint32_t ringBufferReuseStalls = 0u;
+    size_t ringBufferSize = 256 * MemoryConstants::kiloByte;
 
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
@@ -193,6 +206,17 @@ class DirectSubmissionHw {
     DirectSubmissionSfenceMode sfenceMode = DirectSubmissionSfenceMode::BeforeAndAfterSemaphore;
     volatile uint32_t reserved = 0u;
 
+    // Semaphore release of dispatches within coalescingWindow of the previous one is delayed
+    // until the window or coalescingMaxBytes is exceeded, the ring is stopped, CSR waits or
+    // controller checks the ring, so dispatches are coalesced only while controller is running
+    DirectSubmissionController *directSubmissionController = nullptr;
+    std::chrono::high_resolution_clock::time_point lastDispatchTime;
+    std::chrono::high_resolution_clock::time_point firstPendingSubmissionTime;
+    std::chrono::microseconds coalescingWindow{0};
+    size_t coalescingMaxBytes = 4 * MemoryConstants::kiloByte;
+    size_t pendingSubmissionsSize = 0u;
+    std::atomic_bool pendingSubmissions = false;
+
     bool ringStart = false;
     bool disableCpuCacheFlush = true;
     bool disableCacheFlush = false;
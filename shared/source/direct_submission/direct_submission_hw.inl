@@ -10,8 +10,10 @@
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/direct_submission/direct_submission_hw_diagnostic_mode.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/logical_state_helper.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -38,6 +40,7 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
     logicalStateHelper = inputParams.logicalStateHelper;
     hwInfo = inputParams.rootDeviceEnvironment.getHardwareInfo();
     memoryOperationHandler = inputParams.rootDeviceEnvironment.memoryOperationsInterface.get();
+    directSubmissionController = inputParams.directSubmissionController;
 
     auto hwInfoConfig = HwInfoConfig::get(hwInfo->platform.eProductFamily);
 
@@ -48,6 +51,16 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
         this->maxRingBufferCount = DebugManager.flags.DirectSubmissionMaxRingBuffers.get();
     }
 
+    auto ringBufferSizeKb = DebugManager.flags.DirectSubmissionRenderRingBufferSize.get();
+    if (EngineHelpers::isBcs(osContext.getEngineType())) {
+        ringBufferSizeKb = DebugManager.flags.DirectSubmissionBlitterRingBufferSize.get();
+    } else if (EngineHelpers::isCcs(osContext.getEngineType())) {
+        ringBufferSizeKb = DebugManager.flags.DirectSubmissionComputeRingBufferSize.get();
+    }
+    if (ringBufferSizeKb > 0) {
+        this->ringBufferSize = std::max(static_cast<size_t>(ringBufferSizeKb) * MemoryConstants::kiloByte, MemoryConstants::pageSize64k);
+    }
+
     if (DebugManager.flags.DirectSubmissionDisableCacheFlush.get() != -1) {
         disableCacheFlush = !!DebugManager.flags.DirectSubmissionDisableCacheFlush.get();
     }
@@ -70,6 +83,13 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
         isDisablePrefetcherRequired = !!DebugManager.flags.DirectSubmissionDisablePrefetcher.get();
     }
 
+    if (DebugManager.flags.DirectSubmissionCoalescingWindow.get() > 0) {
+        coalescingWindow = std::chrono::microseconds(DebugManager.flags.DirectSubmissionCoalescingWindow.get());
+    }
+    if (DebugManager.flags.DirectSubmissionCoalescingMaxBytes.get() != -1) {
+        coalescingMaxBytes = static_cast<size_t>(DebugManager.flags.DirectSubmissionCoalescingMaxBytes.get());
+    }
+
     UNRECOVERABLE_IF(!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureClflush) && !disableCpuCacheFlush);
 
     createDiagnostic();
@@ -86,20 +106,13 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
     DirectSubmissionAllocations allocations;
 
     bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
-    constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
-    constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
-    const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
-    const AllocationProperties commandStreamAllocationProperties{rootDeviceIndex,
-                                                                 true, allocationSize,
-                                                                 AllocationType::RING_BUFFER,
-                                                                 isMultiOsContextCapable, false, osContext.getDeviceBitfield()};
 
     for (uint32_t ringBufferIndex = 0; ringBufferIndex < RingBufferUse::initialRingBufferCount; ringBufferIndex++) {
-        auto ringBuffer = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+        auto ringBuffer = allocateRingBuffer();
         this->ringBuffers[ringBufferIndex].ringBuffer = ringBuffer;
         UNRECOVERABLE_IF(ringBuffer == nullptr);
         allocations.push_back(ringBuffer);
-        memset(ringBuffer->getUnderlyingBuffer(), 0, allocationSize);
+        memset(ringBuffer->getUnderlyingBuffer(), 0, ringBuffer->getUnderlyingBufferSize());
     }
 
     const AllocationProperties semaphoreAllocationProperties{rootDeviceIndex,
@@ -133,7 +146,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
     }
 
     handleResidency();
-    ringCommandStream.replaceBuffer(this->ringBuffers[0u].ringBuffer->getUnderlyingBuffer(), minimumRequiredSize);
+    ringCommandStream.replaceBuffer(this->ringBuffers[0u].ringBuffer->getUnderlyingBuffer(), this->ringBufferSize);
     ringCommandStream.replaceGraphicsAllocation(this->ringBuffers[0].ringBuffer);
 
     semaphorePtr = semaphores->getUnderlyingBuffer();
@@ -160,12 +173,12 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::makeResourcesResident(DirectSubm
 }
 
 template <typename GfxFamily, typename Dispatcher>
-inline void DirectSubmissionHw<GfxFamily, Dispatcher>::unblockGpu() {
+inline void DirectSubmissionHw<GfxFamily, Dispatcher>::unblockGpu(uint32_t queueWorkCount) {
     if (sfenceMode >= DirectSubmissionSfenceMode::BeforeSemaphoreOnly) {
         CpuIntrinsics::sfence();
     }
 
-    semaphoreData->QueueWorkCount = currentQueueWorkCount;
+    semaphoreData->QueueWorkCount = queueWorkCount;
 
     if (sfenceMode == DirectSubmissionSfenceMode::BeforeAndAfterSemaphore) {
         CpuIntrinsics::sfence();
@@ -286,12 +299,16 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::stopRingBuffer() {
     EncodeNoop<GfxFamily>::alignToCacheLine(ringCommandStream);
 
     cpuCachelineFlush(flushPtr, getSizeEnd());
-    this->unblockGpu();
+    this->unblockGpu(currentQueueWorkCount);
     cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
+    this->pendingSubmissionsSize = 0u;
+    this->pendingSubmissions.store(false);
 
     this->handleStopRingBuffer();
     this->ringStart = false;
 
+    this->releaseIdleRingBuffers();
+
     return true;
 }
 
@@ -490,9 +507,10 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
         reserved = *ringBufferStart;
     }
 
-    this->unblockGpu();
-
-    cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
+    if (!isSubmissionCoalesced(ptrDiff(ringCommandStream.getSpace(0), currentPosition))) {
+        this->unblockGpu(currentQueueWorkCount);
+        cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
+    }
     currentQueueWorkCount++;
     DirectSubmissionDiagnostics::diagnosticModeOneSubmit(diagnostic.get());
 
@@ -502,6 +520,49 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     return ringStart;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::isSubmissionCoalesced(size_t dispatchedSize) {
+    // without running controller nothing releases the last dispatch when no more work comes
+    if (coalescingWindow.count() == 0 || directSubmissionController == nullptr || !directSubmissionController->isControlling()) {
+        return false;
+    }
+
+    auto currentTime = std::chrono::high_resolution_clock::now();
+    bool coalesce = (currentTime - lastDispatchTime) < coalescingWindow &&
+                    pendingSubmissionsSize + dispatchedSize <= coalescingMaxBytes;
+    if (coalesce && pendingSubmissions.load()) {
+        coalesce = (currentTime - firstPendingSubmissionTime) < coalescingWindow;
+    }
+    lastDispatchTime = currentTime;
+
+    if (!coalesce) {
+        // releasing this dispatch releases all pending ones too
+        pendingSubmissionsSize = 0u;
+        pendingSubmissions.store(false);
+        return false;
+    }
+
+    if (!pendingSubmissions.load()) {
+        firstPendingSubmissionTime = currentTime;
+        pendingSubmissions.store(true);
+    }
+    pendingSubmissionsSize += dispatchedSize;
+    return true;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::releasePendingSubmissions() {
+    if (!pendingSubmissions.load()) {
+        return;
+    }
+
+    // semaphore closing the last dispatch stays blocked until next dispatch
+    this->unblockGpu(currentQueueWorkCount - 1);
+    cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
+    pendingSubmissionsSize = 0u;
+    pendingSubmissions.store(false);
+}
+
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::setReturnAddress(void *returnCmd, uint64_t returnAddress) {
     using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
@@ -556,18 +617,12 @@ inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRing
 
     if (nextAllocation == nullptr) {
         if (this->ringBuffers.size() == this->maxRingBufferCount) {
+            // all rings are busy, switch will wait for the next one to complete
             this->currentRingBuffer = (this->currentRingBuffer + 1) % this->ringBuffers.size();
             nextAllocation = this->ringBuffers[this->currentRingBuffer].ringBuffer;
+            this->ringBufferReuseStalls++;
         } else {
-            bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
-            constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
-            constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
-            const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
-            const AllocationProperties commandStreamAllocationProperties{rootDeviceIndex,
-                                                                         true, allocationSize,
-                                                                         AllocationType::RING_BUFFER,
-                                                                         isMultiOsContextCapable, false, osContext.getDeviceBitfield()};
-            nextAllocation = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+            nextAllocation = allocateRingBuffer();
             this->currentRingBuffer = static_cast<uint32_t>(this->ringBuffers.size());
             this->ringBuffers.emplace_back(0ull, nextAllocation);
             auto ret = memoryOperationHandler->makeResidentWithinOsContext(&this->osContext, ArrayRef<GraphicsAllocation *>(&nextAllocation, 1u), false) == MemoryOperationsStatus::SUCCESS;
@@ -578,8 +633,41 @@ inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRing
     return nextAllocation;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::allocateRingBuffer() {
+    bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
+    constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
+    const auto allocationSize = alignUp(this->ringBufferSize + additionalAllocationSize, MemoryConstants::pageSize64k);
+    const AllocationProperties commandStreamAllocationProperties{rootDeviceIndex,
+                                                                 true, allocationSize,
+                                                                 AllocationType::RING_BUFFER,
+                                                                 isMultiOsContextCapable, false, osContext.getDeviceBitfield()};
+    return memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::releaseIdleRingBuffers() {
+    // ring is stopped after idle period, rings allocated above initial count are released once GPU is done with them
+    for (auto ringBufferIndex = static_cast<uint32_t>(this->ringBuffers.size()); ringBufferIndex > RingBufferUse::initialRingBufferCount;) {
+        ringBufferIndex--;
+        if (ringBufferIndex == this->currentRingBuffer || !this->isCompleted(ringBufferIndex)) {
+            continue;
+        }
+        auto ringBuffer = this->ringBuffers[ringBufferIndex].ringBuffer;
+        memoryOperationHandler->evictWithinOsContext(&this->osContext, *ringBuffer);
+        memoryManager->freeGraphicsMemory(ringBuffer);
+        this->ringBuffers.erase(this->ringBuffers.begin() + ringBufferIndex);
+        if (ringBufferIndex < this->currentRingBuffer) {
+            this->currentRingBuffer--;
+        }
+    }
+    this->previousRingBuffer = this->currentRingBuffer;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 void DirectSubmissionHw<GfxFamily, Dispatcher>::deallocateResources() {
+    PRINT_DEBUG_STRING(DebugManager.flags.DirectSubmissionPrintRingBufferStatistics.get(), stderr,
+                       "Ring buffers: %zu, submissions stalled on ring buffer reuse: %u\n", this->ringBuffers.size(), this->ringBufferReuseStalls);
     for (uint32_t ringBufferIndex = 0; ringBufferIndex < this->ringBuffers.size(); ringBufferIndex++) {
         memoryManager->freeGraphicsMemory(this->ringBuffers[ringBufferIndex].ringBuffer);
     }
@@ -630,12 +718,16 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::performDiagnosticMode() {
             }
             BatchBuffer dummyBuffer = {};
             FlushStampTracker dummyTracker(true);
+            diagnostic->diagnosticModeDispatchLoopStart();
             for (uint32_t execution = 0; execution < diagnostic->getExecutionsCount(); execution++) {
                 dispatchCommandBuffer(dummyBuffer, dummyTracker);
                 if (workloadMode == 1) {
+                    releasePendingSubmissions();
                     diagnostic->diagnosticModeOneWaitCollect(execution, workloadModeOneStoreAddress, workloadModeOneExpectedValue);
                 }
             }
+            releasePendingSubmissions();
+            diagnostic->diagnosticModeDispatchLoopEnd();
             workloadMode = 0;
             disableCacheFlush = UllsDefaults::defaultDisableCacheFlush;
             disableMonitorFence = UllsDefaults::defaultDisableMonitorFence;
@@ -40,6 +40,13 @@ void DirectSubmissionDiagnosticsCollector::storeData() {
 
     IoFunctions::fprintf(logFile, "From allocations ready to exit of OS submit function %lld useconds\n", initTimeDiff);
 
+    if (!storeExecutions && executionsCount > 0) {
+        // no waits between dispatches, loop time is the CPU cost of dispatching
+        auto loopDelta = diagnosticModeDispatchLoopEndTime - diagnosticModeDispatchLoopStartTime;
+        int64_t dispatchTimeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(loopDelta).count() / executionsCount;
+        IoFunctions::fprintf(logFile, "Dispatch cost per submission %lld nsec\n", dispatchTimeDiff);
+    }
+
     if (storeExecutions) {
         for (uint32_t execution = 0; execution < executionsCount; execution++) {
             DirectSubmissionSingleDelta &delta = executionList[execution];
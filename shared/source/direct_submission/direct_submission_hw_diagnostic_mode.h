@@ -53,6 +53,12 @@ class DirectSubmissionDiagnosticsCollector {
     void diagnosticModeOneSubmit() {
         diagnosticModeOneSubmitTime = std::chrono::high_resolution_clock::now();
     }
+    void diagnosticModeDispatchLoopStart() {
+        diagnosticModeDispatchLoopStartTime = std::chrono::high_resolution_clock::now();
+    }
+    void diagnosticModeDispatchLoopEnd() {
+        diagnosticModeDispatchLoopEndTime = std::chrono::high_resolution_clock::now();
+    }
 
     void diagnosticModeOneWait(volatile void *waitLocation,
                                uint32_t waitValue) {
@@ -89,6 +95,8 @@ class DirectSubmissionDiagnosticsCollector {
     std::chrono::high_resolution_clock::time_point diagnosticModeOneWaitTime;
     std::chrono::high_resolution_clock::time_point diagnosticModeAllocationTime;
     std::chrono::high_resolution_clock::time_point diagnosticModeDiagnosticTime;
+    std::chrono::high_resolution_clock::time_point diagnosticModeDispatchLoopStartTime;
+    std::chrono::high_resolution_clock::time_point diagnosticModeDispatchLoopEndTime;
     DirectSubmissionExecution executionList;
 
     FILE *logFile = nullptr;
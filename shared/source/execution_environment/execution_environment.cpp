@@ -9,17 +9,21 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/affinity_mask.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/string_helpers.h"
+#include "shared/source/kernel/kernel_tuning_database.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/wait_util.h"
 
+#include "os_inc.h"
+
 namespace NEO {
 ExecutionEnvironment::ExecutionEnvironment() {
     WaitUtils::init();
@@ -111,6 +115,25 @@ DirectSubmissionController *ExecutionEnvironment::initializeDirectSubmissionCont
     return directSubmissionController.get();
 }
 
+KernelTuningDatabase *ExecutionEnvironment::getKernelTuningDatabase() {
+    std::lock_guard<std::mutex> lock(kernelTuningDatabaseMtx);
+    if (this->kernelTuningDatabase == nullptr) {
+        std::string filePath;
+        if (DebugManager.flags.EnableKernelTuningPersistence.get() != 0) {
+            if (DebugManager.flags.KernelTuningDatabasePath.get() != "unk") {
+                filePath = DebugManager.flags.KernelTuningDatabasePath.get();
+            } else {
+                auto cacheConfig = getDefaultCompilerCacheConfig();
+                if (cacheConfig.enabled && !cacheConfig.cacheDir.empty()) {
+                    filePath = cacheConfig.cacheDir + PATH_SEPARATOR + KernelTuningDatabase::defaultFileName;
+                }
+            }
+        }
+        this->kernelTuningDatabase = std::make_unique<KernelTuningDatabase>(filePath);
+    }
+    return kernelTuningDatabase.get();
+}
+
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     if (rootDeviceEnvironments.size() < numRootDevices) {
         rootDeviceEnvironments.resize(numRootDevices);
@@ -8,11 +8,13 @@
 #pragma once
 #include "shared/source/utilities/reference_tracked_object.h"
 
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
 namespace NEO {
 class DirectSubmissionController;
+class KernelTuningDatabase;
 class MemoryManager;
 struct OsEnvironment;
 struct RootDeviceEnvironment;
@@ -39,9 +41,11 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     }
     bool isDebuggingEnabled() { return debuggingEnabled; }
     DirectSubmissionController *initializeDirectSubmissionController();
+    KernelTuningDatabase *getKernelTuningDatabase();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::unique_ptr<KernelTuningDatabase> kernelTuningDatabase;
     std::unique_ptr<OsEnvironment> osEnvironment;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
@@ -51,5 +55,6 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     void adjustCcsCountImpl(RootDeviceEnvironment *rootDeviceEnvironment) const;
     bool debuggingEnabled = false;
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
+    std::mutex kernelTuningDatabaseMtx;
 };
 } // namespace NEO
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace NEO {
+
+// Deleter for device binaries which can be either heap allocated or backed by a file mapping.
+// Implicitly constructible from std::default_delete<char[]>, so heap allocated binaries
+// (e.g. returned by makeCopy) can be moved into UniqueBinaryPtr without changes.
+struct BinaryStorageDeleter {
+    using ReleaseFunctionT = void (*)(char *ptr, size_t size);
+
+    BinaryStorageDeleter() = default;
+    BinaryStorageDeleter(std::default_delete<char[]>) {}
+    BinaryStorageDeleter(ReleaseFunctionT releaseFunction, size_t mappedSize) : releaseFunction(releaseFunction), mappedSize(mappedSize) {}
+
+    void operator()(char *ptr) const {
+        if (releaseFunction != nullptr) {
+            releaseFunction(ptr, mappedSize);
+            return;
+        }
+        delete[] ptr;
+    }
+
+    bool isMapped() const {
+        return (releaseFunction != nullptr) && !isView();
+    }
+
+    bool isView() const {
+        return releaseFunction == &BinaryStorageDeleter::releaseNothing;
+    }
+
+    static void releaseNothing(char *ptr, size_t size) {}
+
+    ReleaseFunctionT releaseFunction = nullptr;
+    size_t mappedSize = 0u;
+};
+
+using UniqueBinaryPtr = std::unique_ptr<char[], BinaryStorageDeleter>;
+
+// Non owning binary pointing into storage owned by another UniqueBinaryPtr, which has to outlive it
+inline UniqueBinaryPtr makeBinaryView(const char *ptr) {
+    return UniqueBinaryPtr(const_cast<char *>(ptr), BinaryStorageDeleter(&BinaryStorageDeleter::releaseNothing, 0u));
+}
+
+} // namespace NEO
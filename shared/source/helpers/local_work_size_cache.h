@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/vec.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+
+// Remembers local work sizes computed for a kernel, so repeated dispatches
+// with the same shape do not rerun the work size search.
+class LocalWorkSizeCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxEntries = 16u;
+
+    struct Key {
+        Vec3<size_t> gws;
+        uint32_t workDim;
+        uint32_t slmTotalSize;
+        uint32_t maxWorkGroupSize;
+
+        bool operator==(const Key &other) const {
+            return gws == other.gws && workDim == other.workDim && slmTotalSize == other.slmTotalSize && maxWorkGroupSize == other.maxWorkGroupSize;
+        }
+    };
+
+    struct Entry {
+        Vec3<size_t> lws = {0, 0, 0};
+    };
+
+    struct Statistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t invalidations = 0u;
+    };
+
+    bool find(const Key &key, Entry &entry) {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (const auto &cachedEntry : entries) {
+            if (cachedEntry.first == key) {
+                entry = cachedEntry.second;
+                statistics.hits++;
+                return true;
+            }
+        }
+        statistics.misses++;
+        return false;
+    }
+
+    Entry store(const Key &key, const Vec3<size_t> &lws) {
+        Entry entry{lws};
+        std::lock_guard<std::mutex> lock(mtx);
+        if (entries.size() < maxEntries) {
+            entries.emplace_back(key, entry);
+        } else {
+            entries[nextEvictedEntry] = {key, entry};
+            nextEvictedEntry = (nextEvictedEntry + 1) % maxEntries;
+        }
+        return entry;
+    }
+
+    void invalidate() {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!entries.empty()) {
+            statistics.invalidations++;
+        }
+        entries.clear();
+        nextEvictedEntry = 0u;
+    }
+
+    size_t getEntriesCount() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return entries.size();
+    }
+
+    const Statistics &getStatistics() const { return statistics; }
+
+    void printStatistics(bool enabled, const std::string &kernelName) const {
+        PRINT_DEBUG_STRING(enabled && statistics.hits + statistics.misses > 0u, stderr,
+                           "Local work size cache of kernel %s: hits: %llu, misses: %llu, invalidations: %llu\n",
+                           kernelName.c_str(),
+                           static_cast<unsigned long long>(statistics.hits),
+                           static_cast<unsigned long long>(statistics.misses),
+                           static_cast<unsigned long long>(statistics.invalidations));
+    }
+
+  protected:
+    std::vector<std::pair<Key, Entry>> entries;
+    size_t nextEvictedEntry = 0u;
+    Statistics statistics;
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/kernel/kernel_tuning_database.h"
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/program/kernel_info.h"
+
+#include <sstream>
+
+namespace NEO {
+namespace {
+constexpr const char *databaseHeader = "# kernel tuning database v1";
+constexpr const char *workgroupSizeTag = "lws";
+constexpr const char *subdeviceTag = "subdevice";
+} // namespace
+
+KernelTuningDatabase::KernelTuningDatabase(const std::string &filePath) : filePath(filePath) {
+    load();
+}
+
+KernelTuningDatabase::~KernelTuningDatabase() {
+    save();
+}
+
+uint64_t KernelTuningDatabase::computeKernelHash(const KernelInfo &kernelInfo, const HardwareInfo &hwInfo) {
+    Hash hash;
+    hash.update(reinterpret_cast<const char *>(&hwInfo.platform.usDeviceID), sizeof(hwInfo.platform.usDeviceID));
+    hash.update(reinterpret_cast<const char *>(&hwInfo.platform.usRevId), sizeof(hwInfo.platform.usRevId));
+    hash.update("----", 4);
+    const auto &kernelName = kernelInfo.kernelDescriptor.kernelMetadata.kernelName;
+    hash.update(kernelName.c_str(), kernelName.size());
+    hash.update("----", 4);
+    if (kernelInfo.heapInfo.pKernelHeap != nullptr) {
+        hash.update(reinterpret_cast<const char *>(kernelInfo.heapInfo.pKernelHeap), kernelInfo.heapInfo.KernelHeapSize);
+    }
+    return hash.finish();
+}
+
+bool KernelTuningDatabase::getWorkgroupSize(uint64_t kernelHash, const Vec3<size_t> &gws, Vec3<size_t> &lws) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = workgroupSizes.find(WorkgroupSizeKey{kernelHash, gws.x, gws.y, gws.z});
+    if (it == workgroupSizes.end()) {
+        return false;
+    }
+    lws = it->second;
+    return true;
+}
+
+void KernelTuningDatabase::storeWorkgroupSize(uint64_t kernelHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws) {
+    std::lock_guard<std::mutex> lock(mtx);
+    workgroupSizes.insert_or_assign(WorkgroupSizeKey{kernelHash, gws.x, gws.y, gws.z}, lws);
+    dirty = true;
+}
+
+bool KernelTuningDatabase::getSingleSubdevicePreferred(uint64_t kernelHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, bool &singleSubdevicePreferred) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = singleSubdevicePreferences.find(SubdeviceKey{kernelHash, gws.x, gws.y, gws.z, lws.x, lws.y, lws.z});
+    if (it == singleSubdevicePreferences.end()) {
+        return false;
+    }
+    singleSubdevicePreferred = it->second;
+    return true;
+}
+
+void KernelTuningDatabase::storeSingleSubdevicePreferred(uint64_t kernelHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, bool singleSubdevicePreferred) {
+    std::lock_guard<std::mutex> lock(mtx);
+    singleSubdevicePreferences.insert_or_assign(SubdeviceKey{kernelHash, gws.x, gws.y, gws.z, lws.x, lws.y, lws.z}, singleSubdevicePreferred);
+    dirty = true;
+}
+
+size_t KernelTuningDatabase::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return workgroupSizes.size() + singleSubdevicePreferences.size();
+}
+
+std::string KernelTuningDatabase::serialize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::ostringstream stream;
+    stream << databaseHeader << "\n";
+    for (const auto &[key, lws] : workgroupSizes) {
+        stream << workgroupSizeTag << " " << std::hex << std::get<0>(key) << std::dec
+               << " " << std::get<1>(key) << " " << std::get<2>(key) << " " << std::get<3>(key)
+               << " " << lws.x << " " << lws.y << " " << lws.z << "\n";
+    }
+    for (const auto &[key, singleSubdevicePreferred] : singleSubdevicePreferences) {
+        stream << subdeviceTag << " " << std::hex << std::get<0>(key) << std::dec
+               << " " << std::get<1>(key) << " " << std::get<2>(key) << " " << std::get<3>(key)
+               << " " << std::get<4>(key) << " " << std::get<5>(key) << " " << std::get<6>(key)
+               << " " << (singleSubdevicePreferred ? 1 : 0) << "\n";
+    }
+    return stream.str();
+}
+
+void KernelTuningDatabase::deserialize(const std::string &data, bool overwriteExisting) {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::istringstream stream(data);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream lineStream(line);
+        std::string tag;
+        uint64_t kernelHash = 0;
+        size_t gws[3] = {};
+        size_t lws[3] = {};
+        lineStream >> tag >> std::hex >> kernelHash >> std::dec >> gws[0] >> gws[1] >> gws[2] >> lws[0] >> lws[1] >> lws[2];
+        if (lineStream.fail() || lws[0] * lws[1] * lws[2] == 0) {
+            continue;
+        }
+
+        if (tag == workgroupSizeTag) {
+            WorkgroupSizeKey key{kernelHash, gws[0], gws[1], gws[2]};
+            if (overwriteExisting) {
+                workgroupSizes.insert_or_assign(key, Vec3<size_t>{lws});
+            } else {
+                workgroupSizes.emplace(key, Vec3<size_t>{lws});
+            }
+        } else if (tag == subdeviceTag) {
+            int singleSubdevicePreferred = 0;
+            lineStream >> singleSubdevicePreferred;
+            if (lineStream.fail()) {
+                continue;
+            }
+            SubdeviceKey key{kernelHash, gws[0], gws[1], gws[2], lws[0], lws[1], lws[2]};
+            if (overwriteExisting) {
+                singleSubdevicePreferences.insert_or_assign(key, singleSubdevicePreferred != 0);
+            } else {
+                singleSubdevicePreferences.emplace(key, singleSubdevicePreferred != 0);
+            }
+        }
+    }
+}
+
+bool KernelTuningDatabase::load() {
+    if (filePath.empty() || !fileExistsHasSize(filePath)) {
+        return false;
+    }
+    size_t size = 0;
+    auto data = loadDataFromFile(filePath.c_str(), size);
+    if (data == nullptr) {
+        return false;
+    }
+    deserialize(std::string(data.get(), size), true);
+    return true;
+}
+
+bool KernelTuningDatabase::save() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (filePath.empty() || !dirty) {
+            return false;
+        }
+    }
+
+    // merge results stored by other processes since load, local results take precedence
+    if (fileExistsHasSize(filePath)) {
+        size_t size = 0;
+        auto data = loadDataFromFile(filePath.c_str(), size);
+        if (data != nullptr) {
+            deserialize(std::string(data.get(), size), false);
+        }
+    }
+
+    auto contents = serialize();
+    auto separatorPos = filePath.find_last_of("/\\");
+    auto fileDir = (separatorPos == std::string::npos) ? std::string(".") : filePath.substr(0, separatorPos);
+    if (!CompilerCache::writeFileAtomically(fileDir, filePath, contents.c_str(), contents.size())) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    dirty = false;
+    return true;
+}
+} // namespace NEO
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/vec.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace NEO {
+struct HardwareInfo;
+struct KernelInfo;
+
+// Stores kernel tuning results (local work size and single subdevice preference)
+// keyed by kernel hash and work sizes. Results are optionally persisted in a file
+// so that subsequent runs can skip exploration.
+class KernelTuningDatabase : NonCopyableOrMovableClass {
+  public:
+    static constexpr const char *defaultFileName = "kernel_tuning.db";
+
+    KernelTuningDatabase(const std::string &filePath);
+    MOCKABLE_VIRTUAL ~KernelTuningDatabase();
+
+    static uint64_t computeKernelHash(const KernelInfo &kernelInfo, const HardwareInfo &hwInfo);
+
+    bool getWorkgroupSize(uint64_t kernelHash, const Vec3<size_t> &gws, Vec3<size_t> &lws) const;
+    void storeWorkgroupSize(uint64_t kernelHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws);
+    bool getSingleSubdevicePreferred(uint64_t kernelHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, bool &singleSubdevicePreferred) const;
+    void storeSingleSubdevicePreferred(uint64_t kernelHash, const Vec3<size_t> &gws, const Vec3<size_t> &lws, bool singleSubdevicePreferred);
+
+    std::string serialize() const;
+    void deserialize(const std::string &data, bool overwriteExisting);
+
+    MOCKABLE_VIRTUAL bool load();
+    MOCKABLE_VIRTUAL bool save();
+
+    const std::string &getFilePath() const { return filePath; }
+    size_t getEntriesCount() const;
+
+  protected:
+    using WorkgroupSizeKey = std::tuple<uint64_t, size_t, size_t, size_t>;
+    using SubdeviceKey = std::tuple<uint64_t, size_t, size_t, size_t, size_t, size_t, size_t>;
+
+    std::string filePath;
+    std::map<WorkgroupSizeKey, Vec3<size_t>> workgroupSizes;
+    std::map<SubdeviceKey, bool> singleSubdevicePreferences;
+    bool dirty = false;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
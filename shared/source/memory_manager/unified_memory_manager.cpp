@@ -10,10 +10,14 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/api_specific_config.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
+#include "shared/source/memory_manager/local_memory_usage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/hw_info_config.h"
 
+#include <limits>
+
 namespace NEO {
 
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
@@ -26,37 +30,118 @@ void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData alloc
     allocations.erase(iter);
 }
 
-void SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
+uint32_t SVMAllocsManager::SvmAllocationCache::getSizeClass(size_t size) {
+    return std::min(Math::log2(static_cast<uint64_t>(size)), numSizeClasses - 1);
+}
+
+bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr, Device *device) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
+    if (this->totalSize + size > this->maxSize) {
+        this->statistics.rejectedInserts++;
+        return false;
+    }
+    auto &sizeClass = this->allocations[device][getSizeClass(size)];
+    sizeClass.emplace(std::lower_bound(sizeClass.begin(), sizeClass.end(), size), size, ptr);
+    this->totalSize += size;
+    return true;
 }
 
-void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
+void *SVMAllocsManager::SvmAllocationCache::get(size_t size, Device *device, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
-         allocationIter != allocations.end();
-         ++allocationIter) {
-        void *allocationPtr = allocationIter->allocation;
-        SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
-        UNRECOVERABLE_IF(!svmAllocData);
-        if (svmAllocData->device == unifiedMemoryProperties.device &&
-            svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
-            allocations.erase(allocationIter);
-            return allocationPtr;
+    auto deviceAllocations = this->allocations.find(device);
+    if (deviceAllocations != this->allocations.end()) {
+        const auto maxReusedSize = (size <= (std::numeric_limits<size_t>::max() >> maxReusedSizeClassesAbove)) ? size << maxReusedSizeClassesAbove
+                                                                                                              : std::numeric_limits<size_t>::max();
+        for (auto sizeClassIndex = getSizeClass(size); sizeClassIndex <= getSizeClass(maxReusedSize); sizeClassIndex++) {
+            auto &sizeClass = deviceAllocations->second[sizeClassIndex];
+            for (auto allocationIter = std::lower_bound(sizeClass.begin(), sizeClass.end(), size);
+                 allocationIter != sizeClass.end() && allocationIter->allocationSize <= maxReusedSize;
+                 ++allocationIter) {
+                void *allocationPtr = allocationIter->allocation;
+                SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
+                UNRECOVERABLE_IF(!svmAllocData);
+                if (svmAllocData->device != unifiedMemoryProperties.device ||
+                    svmAllocData->allocationFlagsProperty.allFlags != unifiedMemoryProperties.allocationFlags.allFlags ||
+                    svmAllocData->allocationFlagsProperty.allAllocFlags != unifiedMemoryProperties.allocationFlags.allAllocFlags) {
+                    continue;
+                }
+                if (svmAllocData->memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY &&
+                    !std::all_of(unifiedMemoryProperties.rootDeviceIndices.begin(), unifiedMemoryProperties.rootDeviceIndices.end(), [svmAllocData](uint32_t rootDeviceIndex) {
+                        return svmAllocData->gpuAllocations.getGraphicsAllocations().size() > rootDeviceIndex &&
+                               svmAllocData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex) != nullptr;
+                    })) {
+                    continue;
+                }
+                this->totalSize -= allocationIter->allocationSize;
+                sizeClass.erase(allocationIter);
+                this->statistics.hits++;
+                return allocationPtr;
+            }
         }
     }
+    this->statistics.misses++;
     return nullptr;
 }
 
 void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManager) {
     std::lock_guard<std::mutex> lock(this->mtx);
-    for (auto &cachedAllocationInfo : this->allocations) {
-        SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
-        DEBUG_BREAK_IF(nullptr == svmData);
-        svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, false, svmData);
+    if (this->allocations.empty()) {
+        return;
+    }
+    for (auto &deviceAllocations : this->allocations) {
+        for (auto &sizeClass : deviceAllocations.second) {
+            for (auto &cachedAllocationInfo : sizeClass) {
+                SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
+                DEBUG_BREAK_IF(nullptr == svmData);
+                svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, false, svmData);
+            }
+        }
     }
     this->allocations.clear();
+    this->totalSize = 0u;
+    this->statistics.trims++;
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::getNumAllocations() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    size_t numAllocations = 0u;
+    for (auto &deviceAllocations : this->allocations) {
+        for (auto &sizeClass : deviceAllocations.second) {
+            numAllocations += sizeClass.size();
+        }
+    }
+    return numAllocations;
+}
+
+bool SVMAllocsManager::SvmAllocationCache::isInCache(const void *ptr) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    for (auto &deviceAllocations : this->allocations) {
+        for (auto &sizeClass : deviceAllocations.second) {
+            for (auto &cachedAllocationInfo : sizeClass) {
+                if (cachedAllocationInfo.allocation == ptr) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+SVMAllocsManager::SvmAllocationCache::Statistics SVMAllocsManager::SvmAllocationCache::getStatistics() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    return this->statistics;
+}
+
+void SVMAllocsManager::SvmAllocationCache::printStatistics(const char *cacheName) {
+    auto cacheStatistics = getStatistics();
+    auto lookups = cacheStatistics.hits + cacheStatistics.misses;
+    PRINT_DEBUG_STRING(true, stderr, "USM %s allocation cache: hits: %llu, misses: %llu, hit rate: %.2f%%, rejected inserts: %llu, trims: %llu\n",
+                       cacheName,
+                       static_cast<unsigned long long>(cacheStatistics.hits),
+                       static_cast<unsigned long long>(cacheStatistics.misses),
+                       lookups ? 100.0 * static_cast<double>(cacheStatistics.hits) / static_cast<double>(lookups) : 0.0,
+                       static_cast<unsigned long long>(cacheStatistics.rejectedInserts),
+                       static_cast<unsigned long long>(cacheStatistics.trims));
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -95,6 +180,12 @@ void SVMAllocsManager::MapOperationsTracker::remove(const void *regionPtr) {
     operations.erase(iter);
 }
 
+void SVMAllocsManager::MapOperationsTracker::removeInRange(const void *regionPtr, size_t regionSize) {
+    auto begin = operations.lower_bound(regionPtr);
+    auto end = operations.lower_bound(ptrOffset(regionPtr, regionSize));
+    operations.erase(begin, end);
+}
+
 SvmMapOperation *SVMAllocsManager::MapOperationsTracker::get(const void *regionPtr) {
     SvmMapOperationsContainer::iterator iter;
     iter = operations.find(regionPtr);
@@ -142,13 +233,22 @@ SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsCon
     if (DebugManager.flags.ExperimentalEnableDeviceAllocationCache.get() != -1) {
         this->usmDeviceAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableDeviceAllocationCache.get();
     }
-    if (this->usmDeviceAllocationsCacheEnabled) {
-        this->initUsmDeviceAllocationsCache();
+    if (DebugManager.flags.ExperimentalEnableHostAllocationCache.get() != -1) {
+        this->usmHostAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableHostAllocationCache.get();
+    }
+    if (DebugManager.flags.ExperimentalEnableSharedAllocationCache.get() != -1) {
+        this->usmSharedAllocationsCacheEnabled = !!DebugManager.flags.ExperimentalEnableSharedAllocationCache.get();
     }
+    this->initUsmAllocationsCaches();
 }
 
 SVMAllocsManager::~SVMAllocsManager() {
-    this->trimUSMDeviceAllocCache();
+    if (DebugManager.flags.PrintUSMAllocationCacheStatistics.get()) {
+        this->usmDeviceAllocationsCache.printStatistics("device");
+        this->usmHostAllocationsCache.printStatistics("host");
+        this->usmSharedAllocationsCache.printStatistics("shared");
+    }
+    this->trimUSMAllocCaches();
 }
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationProperties svmProperties,
@@ -170,6 +270,16 @@ void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationPropertie
 
 void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
                                                           const UnifiedMemoryProperties &memoryProperties) {
+    bool useHostAllocationsCache = this->usmHostAllocationsCacheEnabled &&
+                                   memoryProperties.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY &&
+                                   memoryProperties.allocationFlags.hostptr == 0u;
+    if (useHostAllocationsCache) {
+        void *allocationFromCache = this->usmHostAllocationsCache.get(size, nullptr, memoryProperties, this);
+        if (allocationFromCache) {
+            return allocationFromCache;
+        }
+    }
+
     size_t pageSizeForAlignment = MemoryConstants::pageSize;
     size_t alignedSize = alignUp<size_t>(size, pageSizeForAlignment);
 
@@ -199,6 +309,10 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     void *externalHostPointer = reinterpret_cast<void *>(memoryProperties.allocationFlags.hostptr);
 
     void *usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    if (!usmPtr && useHostAllocationsCache) {
+        this->trimUSMAllocCaches();
+        usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    }
     if (!usmPtr) {
         return nullptr;
     }
@@ -256,10 +370,14 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
     if (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
         unifiedMemoryProperties.flags.isUSMDeviceAllocation = true;
         if (this->usmDeviceAllocationsCacheEnabled) {
-            void *allocationFromCache = this->usmDeviceAllocationsCache.get(size, memoryProperties, this);
+            void *allocationFromCache = this->usmDeviceAllocationsCache.get(size, memoryProperties.device, memoryProperties, this);
             if (allocationFromCache) {
                 return allocationFromCache;
             }
+            if (isLocalMemoryUsageAboveCacheTrimThreshold(rootDeviceIndex, deviceBitfield)) {
+                this->trimUSMDeviceAllocCache();
+                this->trimUSMSharedAllocCache();
+            }
         }
     } else if (memoryProperties.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY) {
         unifiedMemoryProperties.flags.isUSMHostAllocation = true;
@@ -269,7 +387,7 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
     if (!unifiedMemoryAllocation) {
         if (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY &&
             this->usmDeviceAllocationsCacheEnabled) {
-            this->trimUSMDeviceAllocCache();
+            this->trimUSMAllocCaches();
             unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
         }
         if (!unifiedMemoryAllocation) {
@@ -305,9 +423,21 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(size_t size,
     if (DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.get() != -1) {
         supportDualStorageSharedMemory = !!DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.get();
     }
+    bool useKmdMigration = supportDualStorageSharedMemory && memoryManager->isKmdMigrationAvailable(*memoryProperties.rootDeviceIndices.begin());
+
+    if (this->usmSharedAllocationsCacheEnabled && memoryProperties.device) {
+        void *allocationFromCache = this->usmSharedAllocationsCache.get(size, memoryProperties.device, memoryProperties, this);
+        if (allocationFromCache) {
+            if (supportDualStorageSharedMemory && !useKmdMigration) {
+                UNRECOVERABLE_IF(cmdQ == nullptr);
+                auto pageFaultManager = this->memoryManager->getPageFaultManager();
+                pageFaultManager->insertAllocation(allocationFromCache, getSVMAlloc(allocationFromCache)->size, this, cmdQ, memoryProperties.allocationFlags);
+            }
+            return allocationFromCache;
+        }
+    }
 
     if (supportDualStorageSharedMemory) {
-        bool useKmdMigration = memoryManager->isKmdMigrationAvailable(*memoryProperties.rootDeviceIndices.begin());
         void *unifiedMemoryPointer = nullptr;
 
         if (useKmdMigration) {
@@ -398,9 +528,7 @@ void SVMAllocsManager::removeSVMAlloc(const SvmAllocationData &svmAllocData) {
 bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
-        if (InternalMemoryType::DEVICE_UNIFIED_MEMORY == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
+        if (insertIntoUsmAllocationsCache(ptr, svmData)) {
             return true;
         }
         this->freeSVMAllocImpl(ptr, blocking, svmData);
@@ -441,6 +569,73 @@ void SVMAllocsManager::trimUSMDeviceAllocCache() {
     this->usmDeviceAllocationsCache.trim(this);
 }
 
+void SVMAllocsManager::trimUSMHostAllocCache() {
+    this->usmHostAllocationsCache.trim(this);
+}
+
+void SVMAllocsManager::trimUSMSharedAllocCache() {
+    this->usmSharedAllocationsCache.trim(this);
+}
+
+void SVMAllocsManager::trimUSMAllocCaches() {
+    this->trimUSMDeviceAllocCache();
+    this->trimUSMHostAllocCache();
+    this->trimUSMSharedAllocCache();
+}
+
+SVMAllocsManager::SvmAllocationCache *SVMAllocsManager::getUsmAllocationsCache(InternalMemoryType memoryType) {
+    switch (memoryType) {
+    case InternalMemoryType::DEVICE_UNIFIED_MEMORY:
+        return this->usmDeviceAllocationsCacheEnabled ? &this->usmDeviceAllocationsCache : nullptr;
+    case InternalMemoryType::HOST_UNIFIED_MEMORY:
+        return this->usmHostAllocationsCacheEnabled ? &this->usmHostAllocationsCache : nullptr;
+    case InternalMemoryType::SHARED_UNIFIED_MEMORY:
+        return this->usmSharedAllocationsCacheEnabled ? &this->usmSharedAllocationsCache : nullptr;
+    default:
+        return nullptr;
+    }
+}
+
+bool SVMAllocsManager::insertIntoUsmAllocationsCache(void *ptr, SvmAllocationData *svmData) {
+    auto cache = getUsmAllocationsCache(svmData->memoryType);
+    if (!cache || svmData->isImportedAllocation || svmData->allocationFlagsProperty.hostptr != 0u) {
+        return false;
+    }
+    if (svmData->memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY) {
+        if (!svmData->device) {
+            return false;
+        }
+        auto pageFaultManager = this->memoryManager->getPageFaultManager();
+        if (pageFaultManager) {
+            pageFaultManager->removeAllocation(ptr);
+        }
+    }
+    auto device = svmData->memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY ? nullptr : svmData->device;
+    return cache->insert(svmData->size, ptr, device);
+}
+
+bool SVMAllocsManager::isLocalMemoryUsageAboveCacheTrimThreshold(uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield) {
+    if (!memoryManager->isLocalMemorySupported(rootDeviceIndex)) {
+        return false;
+    }
+    uint64_t trimThreshold = 90u;
+    if (DebugManager.flags.USMAllocationCacheTrimThreshold.get() != -1) {
+        trimThreshold = static_cast<uint64_t>(DebugManager.flags.USMAllocationCacheTrimThreshold.get());
+    }
+    auto localMemorySize = memoryManager->getLocalMemorySize(rootDeviceIndex, static_cast<uint32_t>(deviceBitfield.to_ulong()));
+    if (localMemorySize == 0u) {
+        return false;
+    }
+    auto bankSelector = memoryManager->getLocalMemoryUsageBankSelector(AllocationType::BUFFER, rootDeviceIndex);
+    uint64_t occupiedMemorySize = 0u;
+    for (uint32_t bank = 0u; bank < deviceBitfield.size(); bank++) {
+        if (deviceBitfield.test(bank)) {
+            occupiedMemorySize += bankSelector->getOccupiedMemorySizeForBank(bank);
+        }
+    }
+    return occupiedMemorySize * 100u >= localMemorySize * trimThreshold;
+}
+
 void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                                     const RootDeviceIndicesContainer &rootDeviceIndices,
                                                     const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields) {
@@ -548,8 +743,13 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
     }
 }
 
-void SVMAllocsManager::initUsmDeviceAllocationsCache() {
-    this->usmDeviceAllocationsCache.allocations.reserve(128u);
+void SVMAllocsManager::initUsmAllocationsCaches() {
+    if (DebugManager.flags.USMAllocationCacheMaxSize.get() != -1) {
+        auto maxSize = static_cast<uint64_t>(DebugManager.flags.USMAllocationCacheMaxSize.get());
+        this->usmDeviceAllocationsCache.maxSize = maxSize;
+        this->usmHostAllocationsCache.maxSize = maxSize;
+        this->usmSharedAllocationsCache.maxSize = maxSize;
+    }
 }
 
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
@@ -648,6 +848,11 @@ void SVMAllocsManager::removeSvmMapOperation(const void *regionSvmPtr) {
     svmMapOperations.remove(regionSvmPtr);
 }
 
+void SVMAllocsManager::removeSvmMapOperations(const void *regionSvmPtr, size_t regionSize) {
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    svmMapOperations.removeInRange(regionSvmPtr, regionSize);
+}
+
 AllocationType SVMAllocsManager::getGraphicsAllocationTypeAndCompressionPreference(const UnifiedMemoryProperties &unifiedMemoryProperties, bool &compressionEnabled) const {
     compressionEnabled = false;
 
@@ -7,18 +7,22 @@
 
 #pragma once
 #include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
 #include "memory_properties_flags.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <map>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -94,6 +98,7 @@ class SVMAllocsManager {
         using SvmMapOperationsContainer = std::map<const void *, SvmMapOperation>;
         void insert(SvmMapOperation);
         void remove(const void *);
+        void removeInRange(const void *regionPtr, size_t regionSize);
         SvmMapOperation *get(const void *);
         size_t getNumMapOperations() const { return operations.size(); };
 
@@ -138,10 +143,33 @@ class SVMAllocsManager {
     };
 
     struct SvmAllocationCache {
-        void insert(size_t size, void *);
-        void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
+        static constexpr uint64_t defaultMaxSize = MemoryConstants::gigaByte;
+        static constexpr uint32_t numSizeClasses = 64u;
+        // cached allocation is reused only when it is at most (1 << maxReusedSizeClassesAbove) times bigger than requested
+        static constexpr uint32_t maxReusedSizeClassesAbove = 2u;
+
+        struct Statistics {
+            uint64_t hits = 0u;
+            uint64_t misses = 0u;
+            uint64_t rejectedInserts = 0u;
+            uint64_t trims = 0u;
+        };
+
+        bool insert(size_t size, void *ptr, Device *device);
+        void *get(size_t size, Device *device, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
         void trim(SVMAllocsManager *svmAllocsManager);
-        std::vector<SvmCacheAllocationInfo> allocations;
+        size_t getNumAllocations();
+        bool isInCache(const void *ptr);
+        Statistics getStatistics();
+        void printStatistics(const char *cacheName);
+
+        static uint32_t getSizeClass(size_t size);
+
+        using SizeClassedAllocations = std::array<std::vector<SvmCacheAllocationInfo>, numSizeClasses>;
+        std::unordered_map<Device *, SizeClassedAllocations> allocations;
+        uint64_t totalSize = 0u;
+        uint64_t maxSize = defaultMaxSize;
+        Statistics statistics;
         std::mutex mtx;
     };
 
@@ -167,6 +195,9 @@ class SVMAllocsManager {
     MOCKABLE_VIRTUAL void freeSVMAllocImpl(void *ptr, bool blocking, SvmAllocationData *svmData);
     bool freeSVMAlloc(void *ptr) { return freeSVMAlloc(ptr, false); }
     void trimUSMDeviceAllocCache();
+    void trimUSMHostAllocCache();
+    void trimUSMSharedAllocCache();
+    void trimUSMAllocCaches();
     void insertSVMAlloc(const SvmAllocationData &svmData);
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return SVMAllocs.getNumAllocs(); }
@@ -174,6 +205,7 @@ class SVMAllocsManager {
 
     MOCKABLE_VIRTUAL void insertSvmMapOperation(void *regionSvmPtr, size_t regionSize, void *baseSvmPtr, size_t offset, bool readOnlyMap);
     void removeSvmMapOperation(const void *regionSvmPtr);
+    void removeSvmMapOperations(const void *regionSvmPtr, size_t regionSize);
     SvmMapOperation *getSvmMapOperation(const void *regionPtr);
     MOCKABLE_VIRTUAL void addInternalAllocationsToResidencyContainer(uint32_t rootDeviceIndex,
                                                                      ResidencyContainer &residencyContainer,
@@ -201,7 +233,10 @@ class SVMAllocsManager {
 
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
 
-    void initUsmDeviceAllocationsCache();
+    void initUsmAllocationsCaches();
+    SvmAllocationCache *getUsmAllocationsCache(InternalMemoryType memoryType);
+    bool insertIntoUsmAllocationsCache(void *ptr, SvmAllocationData *svmData);
+    bool isLocalMemoryUsageAboveCacheTrimThreshold(uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield);
 
     MapBasedAllocationTracker SVMAllocs;
     MapOperationsTracker svmMapOperations;
@@ -210,6 +245,10 @@ class SVMAllocsManager {
     std::mutex mtxForIndirectAccess;
     bool multiOsContextSupport;
     SvmAllocationCache usmDeviceAllocationsCache;
+    SvmAllocationCache usmHostAllocationsCache;
+    SvmAllocationCache usmSharedAllocationsCache;
     bool usmDeviceAllocationsCacheEnabled = false;
+    bool usmHostAllocationsCacheEnabled = false;
+    bool usmSharedAllocationsCacheEnabled = false;
 };
 } // namespace NEO
@@ -103,6 +103,10 @@ class DrmAllocation : public GraphicsAllocation {
     size_t getMmapSize() { return this->mmapSize; }
     void setMmapSize(size_t size) { this->mmapSize = size; }
 
+    // Slot in DrmMemoryManager allocation registry, allows unregistering in constant time
+    size_t getRegistrationIndex() const { return this->registrationIndex; }
+    void setRegistrationIndex(size_t index) { this->registrationIndex = index; }
+
     MOCKABLE_VIRTUAL int makeBOsResident(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
     MOCKABLE_VIRTUAL int bindBO(BufferObject *bo, OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
     MOCKABLE_VIRTUAL int bindBOs(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
@@ -122,5 +126,6 @@ class DrmAllocation : public GraphicsAllocation {
 
     void *mmapPtr = nullptr;
     size_t mmapSize = 0u;
+    size_t registrationIndex = std::numeric_limits<size_t>::max();
 };
 } // namespace NEO
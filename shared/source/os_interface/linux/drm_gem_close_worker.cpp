@@ -7,6 +7,7 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
@@ -14,12 +15,17 @@
 #include "shared/source/os_interface/os_thread.h"
 
 #include <atomic>
+#include <chrono>
 #include <iostream>
 #include <queue>
 
 namespace NEO {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
+    if (DebugManager.flags.GemCloseWorkerBatchSize.get() > 0) {
+        batchSize = static_cast<size_t>(DebugManager.flags.GemCloseWorkerBatchSize.get());
+    }
+    batch.reserve(batchSize);
     thread = Thread::create(worker, reinterpret_cast<void *>(this));
 }
 
@@ -37,14 +43,22 @@ void DrmGemCloseWorker::closeThread() {
 DrmGemCloseWorker::~DrmGemCloseWorker() {
     active = false;
     closeThread();
+
+    if (DebugManager.flags.PrintGemCloseWorkerStatistics.get()) {
+        printStatistics();
+    }
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
+    // worker only sleeps on empty queue, so it has to be woken up only by the first push
+    auto wakeUpWorker = queue.empty();
     queue.push(bo);
     lock.unlock();
-    condition.notify_one();
+    if (wakeUpWorker) {
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
@@ -59,19 +73,45 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
-inline void DrmGemCloseWorker::close(BufferObject *bo) {
-    bo->wait(-1);
-    memoryManager.unreference(bo, false);
-    workCount--;
+void DrmGemCloseWorker::closeBatch(std::vector<BufferObject *> &batch) {
+    for (auto bo : batch) {
+        bo->wait(-1);
+    }
+    for (auto bo : batch) {
+        memoryManager.unreference(bo, false);
+    }
+    workCount -= static_cast<uint32_t>(batch.size());
+    statistics.closedBufferObjectsCount += batch.size();
+    batch.clear();
 }
 
-inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
-    BufferObject *workItem = nullptr;
+void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQueue) {
+    if (inputQueue.empty()) {
+        return;
+    }
+    auto drainStartTime = std::chrono::steady_clock::now();
+    statistics.maxQueueDepth = std::max(statistics.maxQueueDepth, static_cast<uint64_t>(inputQueue.size()));
+
     while (!inputQueue.empty()) {
-        workItem = inputQueue.front();
+        batch.push_back(inputQueue.front());
         inputQueue.pop();
-        close(workItem);
+        if (batch.size() == batchSize) {
+            closeBatch(batch);
+        }
+    }
+    if (!batch.empty()) {
+        closeBatch(batch);
     }
+
+    statistics.drainsCount++;
+    statistics.totalDrainTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - drainStartTime).count();
+}
+
+void DrmGemCloseWorker::printStatistics() const {
+    auto averageDrainTimeNs = statistics.drainsCount ? statistics.totalDrainTimeNs / statistics.drainsCount : 0u;
+    PRINT_DEBUG_STRING(true, stderr, "Gem close worker statistics: closed BOs: %llu, drains: %llu, max queue depth: %llu, average drain time: %f us\n",
+                       static_cast<unsigned long long>(statistics.closedBufferObjectsCount), static_cast<unsigned long long>(statistics.drainsCount),
+                       static_cast<unsigned long long>(statistics.maxQueueDepth), averageDrainTimeNs / 1e3);
 }
 
 void *DrmGemCloseWorker::worker(void *arg) {
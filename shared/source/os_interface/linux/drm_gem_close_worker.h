@@ -13,6 +13,7 @@
 #include <mutex>
 #include <queue>
 #include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -26,6 +27,15 @@ enum class gemCloseWorkerMode {
 
 class DrmGemCloseWorker {
   public:
+    static constexpr size_t defaultBatchSize = 32;
+
+    struct Statistics {
+        uint64_t drainsCount = 0;
+        uint64_t closedBufferObjectsCount = 0;
+        uint64_t maxQueueDepth = 0;
+        uint64_t totalDrainTimeNs = 0;
+    };
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
     MOCKABLE_VIRTUAL ~DrmGemCloseWorker();
 
@@ -37,10 +47,14 @@ class DrmGemCloseWorker {
 
     bool isEmpty();
 
+    // updated by worker thread only, consistent after blocking close
+    const Statistics &getStatistics() const { return statistics; }
+
   protected:
-    void close(BufferObject *workItem);
+    void closeBatch(std::vector<BufferObject *> &batch);
     void closeThread();
     void processQueue(std::queue<BufferObject *> &inputQueue);
+    void printStatistics() const;
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
@@ -49,6 +63,10 @@ class DrmGemCloseWorker {
     std::queue<BufferObject *> queue;
     std::atomic<uint32_t> workCount{0};
 
+    size_t batchSize = defaultBatchSize;
+    std::vector<BufferObject *> batch;
+    Statistics statistics;
+
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
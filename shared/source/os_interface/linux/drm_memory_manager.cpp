@@ -1167,23 +1167,37 @@ void DrmMemoryManager::makeAllocationResident(GraphicsAllocation *allocation) {
 void DrmMemoryManager::registerSysMemAlloc(GraphicsAllocation *allocation) {
     makeAllocationResident(allocation);
     std::lock_guard<std::mutex> lock(this->allocMutex);
+    static_cast<DrmAllocation *>(allocation)->setRegistrationIndex(this->sysMemAllocs.size());
     this->sysMemAllocs.push_back(allocation);
 }
 
 void DrmMemoryManager::registerLocalMemAlloc(GraphicsAllocation *allocation, uint32_t rootDeviceIndex) {
     makeAllocationResident(allocation);
     std::lock_guard<std::mutex> lock(this->allocMutex);
+    static_cast<DrmAllocation *>(allocation)->setRegistrationIndex(this->localMemAllocs[rootDeviceIndex].size());
     this->localMemAllocs[rootDeviceIndex].push_back(allocation);
 }
 
+bool DrmMemoryManager::removeRegisteredAllocation(std::vector<GraphicsAllocation *> &allocations, GraphicsAllocation *allocation) {
+    auto drmAllocation = static_cast<DrmAllocation *>(allocation);
+    auto index = drmAllocation->getRegistrationIndex();
+    if (index >= allocations.size() || allocations[index] != allocation) {
+        return false;
+    }
+
+    // order is not preserved, last allocation takes the freed slot
+    allocations[index] = allocations.back();
+    static_cast<DrmAllocation *>(allocations[index])->setRegistrationIndex(index);
+    allocations.pop_back();
+    drmAllocation->setRegistrationIndex(std::numeric_limits<size_t>::max());
+    return true;
+}
+
 void DrmMemoryManager::unregisterAllocation(GraphicsAllocation *allocation) {
     std::lock_guard<std::mutex> lock(this->allocMutex);
-    sysMemAllocs.erase(std::remove(sysMemAllocs.begin(), sysMemAllocs.end(), allocation),
-                       sysMemAllocs.end());
-    localMemAllocs[allocation->getRootDeviceIndex()].erase(std::remove(localMemAllocs[allocation->getRootDeviceIndex()].begin(),
-                                                                       localMemAllocs[allocation->getRootDeviceIndex()].end(),
-                                                                       allocation),
-                                                           localMemAllocs[allocation->getRootDeviceIndex()].end());
+    if (!removeRegisteredAllocation(sysMemAllocs, allocation)) {
+        removeRegisteredAllocation(localMemAllocs[allocation->getRootDeviceIndex()], allocation);
+    }
 }
 
 void DrmMemoryManager::registerAllocationInOs(GraphicsAllocation *allocation) {
@@ -23,7 +23,9 @@ class DrmMemoryOperationsHandler : public MemoryOperationsHandler {
     virtual MemoryOperationsStatus mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) = 0;
     virtual std::unique_lock<std::mutex> lockHandlerIfUsed() = 0;
 
-    virtual MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) = 0;
+    // bytesRequired == 0 evicts all unused allocations in every subdevice,
+    // otherwise least recently used allocations bound in vmHandleId are evicted until bytesRequired is freed
+    virtual MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded, size_t bytesRequired, uint32_t vmHandleId) = 0;
 
     static std::unique_ptr<DrmMemoryOperationsHandler> create(Drm &drm, uint32_t rootDeviceIndex);
 
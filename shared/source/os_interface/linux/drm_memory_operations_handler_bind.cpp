@@ -17,6 +17,10 @@
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
 
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+
 namespace NEO {
 
 DrmMemoryOperationsHandlerBind::DrmMemoryOperationsHandlerBind(const RootDeviceEnvironment &rootDeviceEnvironment, uint32_t rootDeviceIndex)
@@ -136,7 +140,7 @@ std::unique_lock<std::mutex> DrmMemoryOperationsHandlerBind::lockHandlerIfUsed()
     return std::unique_lock<std::mutex>();
 }
 
-MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) {
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded, size_t bytesRequired, uint32_t vmHandleId) {
     auto memoryManager = static_cast<DrmMemoryManager *>(this->rootDeviceEnvironment.executionEnvironment.memoryManager.get());
 
     std::unique_lock<std::mutex> evictLock(mutex, std::defer_lock);
@@ -146,66 +150,117 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bo
 
     auto allocLock = memoryManager->acquireAllocLock();
 
-    for (const auto status : {
-             this->evictUnusedAllocationsImpl(memoryManager->getSysMemAllocs(), waitForCompletion),
-             this->evictUnusedAllocationsImpl(memoryManager->getLocalMemAllocs(this->rootDeviceIndex), waitForCompletion)}) {
+    // both pools compete for the same VM space, so they are ordered together
+    std::vector<GraphicsAllocation *> allocationsForEviction(memoryManager->getSysMemAllocs());
+    const auto &localMemAllocs = memoryManager->getLocalMemAllocs(this->rootDeviceIndex);
+    allocationsForEviction.insert(allocationsForEviction.end(), localMemAllocs.begin(), localMemAllocs.end());
 
-        if (status == MemoryOperationsStatus::GPU_HANG_DETECTED_DURING_OPERATION) {
-            return MemoryOperationsStatus::GPU_HANG_DETECTED_DURING_OPERATION;
-        }
-    }
+    evictionStatistics.evictionRequests++;
+    return this->evictUnusedAllocationsImpl(allocationsForEviction, waitForCompletion, bytesRequired, vmHandleId);
+}
 
-    return MemoryOperationsStatus::SUCCESS;
+bool DrmMemoryOperationsHandlerBind::isBoundInSubdevice(GraphicsAllocation &gfxAllocation, OsContext *osContext, uint32_t subdeviceIndex) {
+    auto drmAllocation = static_cast<DrmAllocation *>(&gfxAllocation);
+    auto bo = drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[subdeviceIndex] : drmAllocation->getBO();
+    return bo != nullptr && bo->bindInfo[bo->getOsContextId(osContext)][subdeviceIndex];
 }
 
-MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion) {
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion, size_t bytesRequired, uint32_t vmHandleId) {
     const auto &engines = this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEngines();
-    std::vector<GraphicsAllocation *> evictCandidates;
+
+    struct EvictCandidate {
+        GraphicsAllocation *allocation;
+        uint64_t idleTaskCount;
+    };
+    std::vector<EvictCandidate> evictCandidates;
+    // allocation unbound from several subdevices is counted once in statistics
+    std::unordered_set<GraphicsAllocation *> evictedAllocations;
 
     for (auto subdeviceIndex = 0u; subdeviceIndex < HwHelper::getSubDevicesCount(rootDeviceEnvironment.getHardwareInfo()); subdeviceIndex++) {
+        // binding failed in a single VM, freeing space in other subdevices does not help it
+        if (bytesRequired != 0u && subdeviceIndex != vmHandleId) {
+            continue;
+        }
+
+        if (waitForCompletion) {
+            for (const auto &engine : engines) {
+                if (this->rootDeviceIndex == engine.commandStreamReceiver->getRootDeviceIndex() &&
+                    engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
+                    const auto waitStatus = engine.commandStreamReceiver->waitForCompletionWithTimeout(WaitParams{false, false, 0}, engine.commandStreamReceiver->peekLatestFlushedTaskCount());
+                    if (waitStatus == WaitStatus::GpuHang) {
+                        return MemoryOperationsStatus::GPU_HANG_DETECTED_DURING_OPERATION;
+                    }
+                }
+            }
+        }
+
         for (auto &allocation : allocationsForEviction) {
             bool evict = true;
+            bool isBound = bytesRequired == 0u;
+            // task counts completed since last use, the smallest value among contexts decides
+            uint64_t idleTaskCount = std::numeric_limits<uint64_t>::max();
 
             for (const auto &engine : engines) {
                 if (this->rootDeviceIndex == engine.commandStreamReceiver->getRootDeviceIndex() &&
                     engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
-                    if (allocation->isAlwaysResident(engine.osContext->getContextId())) {
+                    auto contextId = engine.osContext->getContextId();
+                    if (allocation->isAlwaysResident(contextId)) {
                         evict = false;
                         break;
                     }
 
-                    if (waitForCompletion) {
-                        const auto waitStatus = engine.commandStreamReceiver->waitForCompletionWithTimeout(WaitParams{false, false, 0}, engine.commandStreamReceiver->peekLatestFlushedTaskCount());
-                        if (waitStatus == WaitStatus::GpuHang) {
-                            return MemoryOperationsStatus::GPU_HANG_DETECTED_DURING_OPERATION;
+                    if (allocation->isUsedByOsContext(contextId)) {
+                        auto completedTaskCount = *engine.commandStreamReceiver->getTagAddress();
+                        if (allocation->getTaskCount(contextId) > completedTaskCount) {
+                            evict = false;
+                            break;
                         }
+                        idleTaskCount = std::min(idleTaskCount, static_cast<uint64_t>(completedTaskCount - allocation->getTaskCount(contextId)));
                     }
 
-                    if (allocation->isUsedByOsContext(engine.osContext->getContextId()) &&
-                        allocation->getTaskCount(engine.osContext->getContextId()) > *engine.commandStreamReceiver->getTagAddress()) {
-                        evict = false;
-                        break;
+                    if (!isBound) {
+                        isBound = isBoundInSubdevice(*allocation, engine.osContext, subdeviceIndex);
                     }
                 }
             }
-            if (evict) {
-                evictCandidates.push_back(allocation);
+            if (evict && isBound) {
+                evictCandidates.push_back({allocation, idleTaskCount});
             }
         }
 
-        for (auto &allocationToEvict : evictCandidates) {
+        if (bytesRequired != 0u) {
+            std::stable_sort(evictCandidates.begin(), evictCandidates.end(), [](const EvictCandidate &left, const EvictCandidate &right) {
+                return left.idleTaskCount > right.idleTaskCount;
+            });
+        }
+
+        size_t evictedBytes = 0u;
+        for (auto &candidate : evictCandidates) {
+            if (bytesRequired != 0u && evictedBytes >= bytesRequired) {
+                break;
+            }
             for (const auto &engine : engines) {
                 if (this->rootDeviceIndex == engine.commandStreamReceiver->getRootDeviceIndex() &&
                     engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
                     DeviceBitfield deviceBitfield;
                     deviceBitfield.set(subdeviceIndex);
-                    this->evictImpl(engine.osContext, *allocationToEvict, deviceBitfield);
+                    this->evictImpl(engine.osContext, *candidate.allocation, deviceBitfield);
                 }
             }
+            evictedBytes += candidate.allocation->getUnderlyingBufferSize();
+            if (evictedAllocations.insert(candidate.allocation).second) {
+                evictionStatistics.evictedAllocations++;
+                evictionStatistics.evictedBytes += candidate.allocation->getUnderlyingBufferSize();
+            }
         }
         evictCandidates.clear();
     }
 
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "Eviction requests: %llu, evicted allocations: %llu, evicted bytes: %llu\n",
+                       static_cast<unsigned long long>(evictionStatistics.evictionRequests),
+                       static_cast<unsigned long long>(evictionStatistics.evictedAllocations),
+                       static_cast<unsigned long long>(evictionStatistics.evictedBytes));
+
     return MemoryOperationsStatus::SUCCESS;
 }
 
@@ -13,6 +13,12 @@ namespace NEO {
 struct RootDeviceEnvironment;
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
   public:
+    struct EvictionStatistics {
+        uint64_t evictionRequests = 0u;
+        uint64_t evictedAllocations = 0u;
+        uint64_t evictedBytes = 0u;
+    };
+
     DrmMemoryOperationsHandlerBind(const RootDeviceEnvironment &rootDeviceEnvironment, uint32_t rootDeviceIndex);
     ~DrmMemoryOperationsHandlerBind() override;
 
@@ -25,7 +31,8 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
     MemoryOperationsStatus mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) override;
     [[nodiscard]] std::unique_lock<std::mutex> lockHandlerIfUsed() override;
 
-    MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) override;
+    MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded, size_t bytesRequired, uint32_t vmHandleId) override;
+    const EvictionStatistics &getEvictionStatistics() const { return evictionStatistics; }
 
     uint32_t getRootDeviceIndex() {
         return this->rootDeviceIndex;
@@ -36,9 +43,11 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
 
   protected:
     MOCKABLE_VIRTUAL int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
-    MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion);
+    MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion, size_t bytesRequired, uint32_t vmHandleId);
+    bool isBoundInSubdevice(GraphicsAllocation &gfxAllocation, OsContext *osContext, uint32_t subdeviceIndex);
 
     const RootDeviceEnvironment &rootDeviceEnvironment;
     uint32_t rootDeviceIndex = 0;
+    EvictionStatistics evictionStatistics;
 };
 } // namespace NEO
@@ -65,7 +65,7 @@ std::unique_lock<std::mutex> DrmMemoryOperationsHandlerDefault::lockHandlerIfUse
     return std::unique_lock<std::mutex>();
 }
 
-MemoryOperationsStatus DrmMemoryOperationsHandlerDefault::evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) {
+MemoryOperationsStatus DrmMemoryOperationsHandlerDefault::evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded, size_t bytesRequired, uint32_t vmHandleId) {
     return MemoryOperationsStatus::SUCCESS;
 }
 
@@ -26,7 +26,7 @@ class DrmMemoryOperationsHandlerDefault : public DrmMemoryOperationsHandler {
     MemoryOperationsStatus mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) override;
     [[nodiscard]] std::unique_lock<std::mutex> lockHandlerIfUsed() override;
 
-    MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) override;
+    MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded, size_t bytesRequired, uint32_t vmHandleId) override;
 
   protected:
     std::unordered_set<GraphicsAllocation *> residency;
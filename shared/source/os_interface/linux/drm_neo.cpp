@@ -1437,8 +1437,13 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
 int Drm::bindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo) {
     auto ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true);
     if (ret != 0) {
-        static_cast<DrmMemoryOperationsHandlerBind *>(this->rootDeviceEnvironment.memoryOperationsInterface.get())->evictUnusedAllocations(false, false);
+        auto memoryOperationsInterface = static_cast<DrmMemoryOperationsHandlerBind *>(this->rootDeviceEnvironment.memoryOperationsInterface.get());
+        memoryOperationsInterface->evictUnusedAllocations(false, false, bo->peekSize(), vmHandleId);
         ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true);
+        if (ret != 0) {
+            memoryOperationsInterface->evictUnusedAllocations(false, false, 0u, vmHandleId);
+            ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true);
+        }
     }
     return ret;
 }
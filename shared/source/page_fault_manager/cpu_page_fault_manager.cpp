@@ -8,6 +8,8 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/spinlock.h"
@@ -15,12 +17,27 @@
 #include <algorithm>
 
 namespace NEO {
+PageFaultManager::~PageFaultManager() {
+    auto averageTimeNs = statistics.faultsCount ? statistics.totalFaultHandlingTimeNs / statistics.faultsCount : 0u;
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintPageFaultStatistics.get(), stderr,
+                       "Page fault statistics: handled faults: %llu, unresolved faults: %llu, average handling time: %f us, max handling time: %f us\n",
+                       static_cast<unsigned long long>(statistics.faultsCount), static_cast<unsigned long long>(statistics.missesCount),
+                       averageTimeNs / 1e3, statistics.maxFaultHandlingTimeNs / 1e3);
+}
+
 void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties) {
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::Cpu : AllocationDomain::None;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    auto chunkSize = getMigrationChunkSize();
+    if (chunkSize != 0u && size > chunkSize && this->gpuDomainHandler == &handleGpuDomainTransferForHw) {
+        pageFaultData.chunkSize = chunkSize;
+        pageFaultData.chunkDomains.resize(Math::divideAndRoundUp(size, chunkSize), domain);
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -39,6 +56,10 @@ void PageFaultManager::removeAllocation(void *ptr) {
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
             }
+            auto &chunkDomains = pageFaultData.chunkDomains;
+            if (std::find(chunkDomains.begin(), chunkDomains.end(), AllocationDomain::Gpu) != chunkDomains.end()) {
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
         }
         this->memoryData.erase(ptr);
     }
@@ -71,35 +92,87 @@ void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocs
 
 inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
     if (pageFaultData.domain == AllocationDomain::Cpu) {
-        std::chrono::steady_clock::time_point start;
-        std::chrono::steady_clock::time_point end;
+        if (pageFaultData.chunkDomains.empty()) {
+            this->migrateRangeToGpuDomain(ptr, pageFaultData.size, pageFaultData);
+        } else {
+            auto &chunkDomains = pageFaultData.chunkDomains;
+            const auto chunksCount = chunkDomains.size();
+            for (size_t chunk = 0u; chunk < chunksCount;) {
+                if (chunkDomains[chunk] != AllocationDomain::Cpu) {
+                    chunk++;
+                    continue;
+                }
+                const auto firstChunk = chunk;
+                while (chunk < chunksCount && chunkDomains[chunk] == AllocationDomain::Cpu) {
+                    chunk++;
+                }
+                const auto offset = firstChunk * pageFaultData.chunkSize;
+                const auto rangeSize = std::min(chunk * pageFaultData.chunkSize, pageFaultData.size) - offset;
+                this->migrateRangeToGpuDomain(ptrOffset(ptr, offset), rangeSize, pageFaultData);
+            }
+        }
+    }
+    std::fill(pageFaultData.chunkDomains.begin(), pageFaultData.chunkDomains.end(), AllocationDomain::Gpu);
+    pageFaultData.domain = AllocationDomain::Gpu;
+}
 
-        start = std::chrono::steady_clock::now();
-        this->transferToGpu(ptr, pageFaultData.cmdQ);
-        end = std::chrono::steady_clock::now();
-        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+inline void PageFaultManager::migrateRangeToGpuDomain(void *ptr, size_t size, PageFaultData &pageFaultData) {
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
 
-        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
-            printf("UMD transferred shared allocation %llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
-        }
+    start = std::chrono::steady_clock::now();
+    this->transferToGpu(ptr, size, pageFaultData.cmdQ);
+    end = std::chrono::steady_clock::now();
+    long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
-        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+    if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+        printf("UMD transferred shared allocation %llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), size, elapsedTime / 1e3);
     }
-    pageFaultData.domain = AllocationDomain::Gpu;
+
+    this->protectCPUMemoryAccess(ptr, size);
+}
+
+std::map<void *, PageFaultManager::PageFaultData>::iterator PageFaultManager::findAllocation(void *ptr) {
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return this->memoryData.end();
+    }
+    --alloc;
+    if (ptr >= ptrOffset(alloc->first, alloc->second.size)) {
+        return this->memoryData.end();
+    }
+    return alloc;
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
+    auto start = std::chrono::steady_clock::now();
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
-        }
+
+    auto alloc = findAllocation(ptr);
+    if (alloc == this->memoryData.end()) {
+        statistics.missesCount++;
+        return false;
+    }
+
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.chunkDomains.empty()) {
+        gpuDomainHandler(this, allocPtr, pageFaultData);
+    } else {
+        this->handleChunkedPageFault(allocPtr, ptr, pageFaultData);
     }
-    return false;
+
+    uint64_t elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    statistics.faultsCount++;
+    statistics.totalFaultHandlingTimeNs += elapsedTime;
+    statistics.maxFaultHandlingTimeNs = std::max(statistics.maxFaultHandlingTimeNs, elapsedTime);
+    return true;
+}
+
+PageFaultManager::PageFaultStatistics PageFaultManager::getStatistics() {
+    std::unique_lock<SpinLock> lock{mtx};
+    return statistics;
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
@@ -118,20 +191,49 @@ void PageFaultManager::handleGpuDomainTransferForAubAndTbx(PageFaultManager *pag
 
 inline void PageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData) {
     if (pageFaultData.domain == AllocationDomain::Gpu) {
-        std::chrono::steady_clock::time_point start;
-        std::chrono::steady_clock::time_point end;
+        this->migrateRangeToCpuDomain(ptr, pageFaultData.size, pageFaultData);
+        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+    }
+    pageFaultData.domain = AllocationDomain::Cpu;
+}
 
-        start = std::chrono::steady_clock::now();
-        this->transferToCpu(ptr, pageFaultData.size, pageFaultData.cmdQ);
-        end = std::chrono::steady_clock::now();
-        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+inline void PageFaultManager::migrateRangeToCpuDomain(void *ptr, size_t size, PageFaultData &pageFaultData) {
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
 
-        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
-            printf("UMD transferred shared allocation %llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
-        }
-        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+    start = std::chrono::steady_clock::now();
+    this->transferToCpu(ptr, size, pageFaultData.cmdQ);
+    end = std::chrono::steady_clock::now();
+    long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+        printf("UMD transferred shared allocation %llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), size, elapsedTime / 1e3);
+    }
+}
+
+void PageFaultManager::handleChunkedPageFault(void *allocPtr, void *faultPtr, PageFaultData &pageFaultData) {
+    const auto chunk = ptrDiff(faultPtr, allocPtr) / pageFaultData.chunkSize;
+    const auto chunkOffset = chunk * pageFaultData.chunkSize;
+    const auto chunkSize = std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset);
+    auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+
+    if (pageFaultData.chunkDomains[chunk] == AllocationDomain::Gpu) {
+        this->migrateRangeToCpuDomain(chunkPtr, chunkSize, pageFaultData);
+    }
+    pageFaultData.chunkDomains[chunk] = AllocationDomain::Cpu;
+
+    if (pageFaultData.domain == AllocationDomain::Gpu) {
+        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(allocPtr);
     }
     pageFaultData.domain = AllocationDomain::Cpu;
+    this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+}
+
+size_t PageFaultManager::getMigrationChunkSize() const {
+    if (!chunkedMigrationApiSupport || DebugManager.flags.SharedAllocationMigrationChunkSize.get() <= 0) {
+        return 0u;
+    }
+    return alignUp(static_cast<size_t>(DebugManager.flags.SharedAllocationMigrationChunkSize.get()), MemoryConstants::pageSize);
 }
 
 void PageFaultManager::selectGpuDomainHandler() {
@@ -12,8 +12,9 @@
 
 #include "memory_properties_flags.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -24,7 +25,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
   public:
     static std::unique_ptr<PageFaultManager> create();
 
-    virtual ~PageFaultManager() = default;
+    virtual ~PageFaultManager();
 
     MOCKABLE_VIRTUAL void moveAllocationToGpuDomain(void *ptr);
     MOCKABLE_VIRTUAL void moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager);
@@ -42,8 +43,19 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t chunkSize = 0u;
+        std::vector<AllocationDomain> chunkDomains;
     };
 
+    struct PageFaultStatistics {
+        uint64_t faultsCount = 0u;
+        uint64_t missesCount = 0u; // faults outside of any shared allocation
+        uint64_t totalFaultHandlingTimeNs = 0u;
+        uint64_t maxFaultHandlingTimeNs = 0u;
+    };
+
+    PageFaultStatistics getStatistics();
+
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
 
     void setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr);
@@ -52,11 +64,13 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
 
+    static bool chunkedMigrationApiSupport;
+
   protected:
     virtual void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) = 0;
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
-    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
     static void handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -64,10 +78,16 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    inline void migrateRangeToGpuDomain(void *ptr, size_t size, PageFaultData &pageFaultData);
+    inline void migrateRangeToCpuDomain(void *ptr, size_t size, PageFaultData &pageFaultData);
+    void handleChunkedPageFault(void *allocPtr, void *faultPtr, PageFaultData &pageFaultData);
+    size_t getMigrationChunkSize() const;
+    std::map<void *, PageFaultData>::iterator findAllocation(void *ptr);
 
     decltype(&handleGpuDomainTransferForHw) gpuDomainHandler = &handleGpuDomainTransferForHw;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    std::map<void *, PageFaultData> memoryData;
+    PageFaultStatistics statistics;
     SpinLock mtx;
 };
 } // namespace NEO
@@ -0,0 +1,347 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/binary_log_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+namespace NEO {
+namespace {
+std::atomic<uint64_t> nextWriterId{1u};
+
+struct ThreadBufferCache {
+    uint64_t writerId = 0u;
+    void *buffer = nullptr;
+};
+thread_local ThreadBufferCache threadBufferCache;
+
+struct RecordHeader {
+    uint32_t type;
+    uint32_t size;
+};
+
+struct StringPayload {
+    uint64_t id;
+};
+
+struct ApiCallPayload {
+    uint64_t timestamp;
+    uint64_t threadId;
+    uint64_t functionId;
+    uint32_t enter;
+    int32_t errorCode;
+};
+
+struct AllocationPayload {
+    uint64_t timestamp;
+    uint64_t threadId;
+    uint64_t allocationTypeId;
+    uint64_t memoryPoolId;
+    uint64_t gpuAddress;
+    uint64_t size;
+    uint32_t rootDeviceIndex;
+    uint32_t reserved;
+};
+
+struct TextPayload {
+    uint64_t timestamp;
+    uint64_t threadId;
+};
+} // namespace
+
+BinaryLogWriter::BinaryLogWriter(const std::string &fileName, bool startWriterThread) : writerId(nextWriterId++) {
+    file.open(fileName, std::ios::binary | std::ios::trunc);
+    file.write(fileMagic.data(), fileMagic.size());
+    if (startWriterThread) {
+        writerThread = Thread::create(writerThreadFunc, reinterpret_cast<void *>(this));
+    }
+}
+
+BinaryLogWriter::~BinaryLogWriter() {
+    {
+        std::lock_guard<std::mutex> lock(writerMtx);
+        stopWriter = true;
+    }
+    writerCondition.notify_all();
+    if (writerThread) {
+        writerThread->join();
+    }
+    drain();
+}
+
+void *BinaryLogWriter::writerThreadFunc(void *self) {
+    auto writer = reinterpret_cast<BinaryLogWriter *>(self);
+    std::unique_lock<std::mutex> lock(writer->writerMtx);
+    auto drainInterval = std::chrono::milliseconds(minDrainIntervalMs);
+    while (!writer->stopWriter) {
+        writer->writerCondition.wait_for(lock, drainInterval);
+        lock.unlock();
+        bool recordsWritten = writer->drain();
+        lock.lock();
+        if (recordsWritten) {
+            drainInterval = std::chrono::milliseconds(minDrainIntervalMs);
+        } else {
+            drainInterval = std::min(drainInterval * 2, std::chrono::milliseconds(maxDrainIntervalMs));
+        }
+    }
+    return nullptr;
+}
+
+uint64_t BinaryLogWriter::getTimestamp() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t BinaryLogWriter::getThreadId() {
+    static thread_local uint64_t threadId = static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    return threadId;
+}
+
+BinaryLogWriter::ThreadBuffer *BinaryLogWriter::getThreadBuffer() {
+    if (threadBufferCache.writerId == writerId) {
+        return reinterpret_cast<ThreadBuffer *>(threadBufferCache.buffer);
+    }
+
+    std::lock_guard<std::mutex> lock(threadBuffersMtx);
+    ThreadBuffer *threadBuffer = nullptr;
+    for (auto &buffer : threadBuffers) {
+        if (buffer->threadId == getThreadId()) {
+            threadBuffer = buffer.get();
+            break;
+        }
+    }
+    if (threadBuffer == nullptr) {
+        threadBuffers.push_back(std::make_unique<ThreadBuffer>());
+        threadBuffer = threadBuffers.back().get();
+        threadBuffer->threadId = getThreadId();
+    }
+    threadBufferCache.writerId = writerId;
+    threadBufferCache.buffer = threadBuffer;
+    return threadBuffer;
+}
+
+void BinaryLogWriter::pushRecord(const Record &record) {
+    // Single producer (owning thread), single consumer (drain) ring, records are dropped when full
+    auto threadBuffer = getThreadBuffer();
+    auto head = threadBuffer->head.load(std::memory_order_relaxed);
+    auto usedRecords = head - threadBuffer->tail.load(std::memory_order_acquire);
+    if (usedRecords >= threadBufferRecords) {
+        droppedRecords++;
+        return;
+    }
+    threadBuffer->records[head % threadBufferRecords] = record;
+    threadBuffer->head.store(head + 1, std::memory_order_release);
+
+    // Writer may be backing off, wake it up before the buffer overflows
+    if (usedRecords + 1 == threadBufferRecords / 2) {
+        writerCondition.notify_one();
+    }
+}
+
+void BinaryLogWriter::logApiCall(const char *function, bool enter, int32_t errorCode) {
+    Record record;
+    record.timestamp = getTimestamp();
+    record.type = RecordType::ApiCall;
+    record.value = errorCode;
+    record.name = function;
+    record.data[0] = enter ? 1u : 0u;
+    pushRecord(record);
+}
+
+void BinaryLogWriter::logAllocation(const char *allocationType, const char *memoryPool, uint32_t rootDeviceIndex, uint64_t gpuAddress, uint64_t size) {
+    Record record;
+    record.timestamp = getTimestamp();
+    record.type = RecordType::Allocation;
+    record.value = static_cast<int32_t>(rootDeviceIndex);
+    record.name = allocationType;
+    record.detail = memoryPool;
+    record.data[0] = gpuAddress;
+    record.data[1] = size;
+    pushRecord(record);
+}
+
+void BinaryLogWriter::logText(const std::string &text) {
+    std::lock_guard<std::mutex> lock(textRecordsMtx);
+    textRecords.push_back({getTimestamp(), getThreadId(), text});
+}
+
+void BinaryLogWriter::flush() {
+    drain();
+}
+
+void BinaryLogWriter::writeRecord(RecordType type, const void *payload, size_t payloadSize, const char *text, size_t textSize) {
+    RecordHeader header = {static_cast<uint32_t>(type), static_cast<uint32_t>(payloadSize + textSize)};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(payload), payloadSize);
+    if (textSize > 0u) {
+        file.write(text, textSize);
+    }
+}
+
+uint64_t BinaryLogWriter::getStringId(const char *string) {
+    if (string == nullptr) {
+        return 0u;
+    }
+    auto stringId = stringIds.find(string);
+    if (stringId != stringIds.end()) {
+        return stringId->second;
+    }
+    StringPayload payload = {stringIds.size() + 1};
+    writeRecord(RecordType::String, &payload, sizeof(payload), string, strlen(string));
+    stringIds.emplace(string, payload.id);
+    return payload.id;
+}
+
+bool BinaryLogWriter::drain() {
+    std::lock_guard<std::mutex> drainLock(drainMtx);
+    bool recordsWritten = false;
+
+    std::vector<ThreadBuffer *> buffers;
+    {
+        std::lock_guard<std::mutex> lock(threadBuffersMtx);
+        for (auto &buffer : threadBuffers) {
+            buffers.push_back(buffer.get());
+        }
+    }
+
+    for (auto buffer : buffers) {
+        auto head = buffer->head.load(std::memory_order_acquire);
+        auto tail = buffer->tail.load(std::memory_order_relaxed);
+        recordsWritten |= (tail != head);
+        for (; tail != head; tail++) {
+            const auto &record = buffer->records[tail % threadBufferRecords];
+            if (record.type == RecordType::ApiCall) {
+                ApiCallPayload payload = {record.timestamp, buffer->threadId, getStringId(record.name),
+                                          static_cast<uint32_t>(record.data[0]), record.value};
+                writeRecord(RecordType::ApiCall, &payload, sizeof(payload));
+            } else if (record.type == RecordType::Allocation) {
+                AllocationPayload payload = {record.timestamp, buffer->threadId, getStringId(record.name), getStringId(record.detail),
+                                             record.data[0], record.data[1], static_cast<uint32_t>(record.value), 0u};
+                writeRecord(RecordType::Allocation, &payload, sizeof(payload));
+            }
+        }
+        buffer->tail.store(tail, std::memory_order_release);
+    }
+
+    std::vector<TextRecord> texts;
+    {
+        std::lock_guard<std::mutex> lock(textRecordsMtx);
+        texts.swap(textRecords);
+    }
+    auto dropped = droppedRecords.load();
+    if (dropped != reportedDroppedRecords) {
+        texts.push_back({getTimestamp(), getThreadId(), "Dropped " + std::to_string(dropped - reportedDroppedRecords) + " log records\n"});
+        reportedDroppedRecords = dropped;
+    }
+    for (const auto &text : texts) {
+        TextPayload payload = {text.timestamp, text.threadId};
+        writeRecord(RecordType::Text, &payload, sizeof(payload), text.text.c_str(), text.text.size());
+    }
+    recordsWritten |= !texts.empty();
+
+    if (recordsWritten) {
+        file.flush();
+    }
+    return recordsWritten;
+}
+
+bool BinaryLogWriter::decode(const char *data, size_t size, std::ostream &out) {
+    if (size < fileMagic.size() || memcmp(data, fileMagic.data(), fileMagic.size()) != 0) {
+        return false;
+    }
+
+    // Records are written per thread, lines are collected and ordered by timestamp at the end
+    std::vector<std::pair<uint64_t, std::string>> lines;
+    std::unordered_map<uint64_t, std::string> strings;
+    auto getString = [&strings](uint64_t id) -> std::string {
+        auto string = strings.find(id);
+        return (string != strings.end()) ? string->second : "unknown";
+    };
+
+    size_t offset = fileMagic.size();
+    while (offset < size) {
+        RecordHeader header;
+        if (size - offset < sizeof(header)) {
+            return false;
+        }
+        memcpy(&header, data + offset, sizeof(header));
+        offset += sizeof(header);
+        if (size - offset < header.size) {
+            return false;
+        }
+        const char *payloadData = data + offset;
+        offset += header.size;
+
+        switch (static_cast<RecordType>(header.type)) {
+        case RecordType::String: {
+            StringPayload payload;
+            if (header.size < sizeof(payload)) {
+                return false;
+            }
+            memcpy(&payload, payloadData, sizeof(payload));
+            strings[payload.id] = std::string(payloadData + sizeof(payload), header.size - sizeof(payload));
+            break;
+        }
+        case RecordType::ApiCall: {
+            ApiCallPayload payload;
+            if (header.size != sizeof(payload)) {
+                return false;
+            }
+            memcpy(&payload, payloadData, sizeof(payload));
+            std::stringstream line;
+            line << "[" << payload.timestamp << "] ThreadID: " << payload.threadId << " ";
+            if (payload.enter) {
+                line << "Function Enter: ";
+            } else {
+                line << "Function Leave (" << payload.errorCode << "): ";
+            }
+            line << getString(payload.functionId) << "\n";
+            lines.emplace_back(payload.timestamp, line.str());
+            break;
+        }
+        case RecordType::Allocation: {
+            AllocationPayload payload;
+            if (header.size != sizeof(payload)) {
+                return false;
+            }
+            memcpy(&payload, payloadData, sizeof(payload));
+            std::stringstream line;
+            line << "[" << payload.timestamp << "] ThreadID: " << payload.threadId
+                 << " AllocationType: " << getString(payload.allocationTypeId)
+                 << " MemoryPool: " << getString(payload.memoryPoolId)
+                 << " Root device index: " << payload.rootDeviceIndex
+                 << " GPU address: 0x" << std::hex << payload.gpuAddress << " - 0x" << payload.gpuAddress + payload.size - 1 << std::dec << "\n";
+            lines.emplace_back(payload.timestamp, line.str());
+            break;
+        }
+        case RecordType::Text: {
+            TextPayload payload;
+            if (header.size < sizeof(payload)) {
+                return false;
+            }
+            memcpy(&payload, payloadData, sizeof(payload));
+            lines.emplace_back(payload.timestamp, "[" + std::to_string(payload.timestamp) + "] " + std::string(payloadData + sizeof(payload), header.size - sizeof(payload)));
+            break;
+        }
+        default:
+            // Records added by newer versions are skipped
+            break;
+        }
+    }
+
+    std::stable_sort(lines.begin(), lines.end(), [](const auto &line1, const auto &line2) { return line1.first < line2.first; });
+    for (const auto &line : lines) {
+        out << line.second;
+    }
+    return true;
+}
+} // namespace NEO
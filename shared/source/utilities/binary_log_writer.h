@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Collects compact log records in per thread ring buffers and writes them
+// from a background thread into a single binary file. The writer backs off while
+// idle and is woken up when a ring buffer gets half full.
+// Use BinaryLogWriter::decode or scripts/decode_binary_log.py to convert the file to text,
+// both order records of all threads by timestamp.
+class BinaryLogWriter : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t threadBufferRecords = 4096u;
+    static constexpr uint32_t minDrainIntervalMs = 1u;
+    static constexpr uint32_t maxDrainIntervalMs = 64u;
+    static constexpr std::array<char, 8> fileMagic = {'N', 'E', 'O', 'B', 'L', 'O', 'G', '1'};
+
+    enum class RecordType : uint32_t {
+        String = 1,
+        ApiCall = 2,
+        Allocation = 3,
+        Text = 4
+    };
+
+    BinaryLogWriter(const std::string &fileName, bool startWriterThread);
+    MOCKABLE_VIRTUAL ~BinaryLogWriter();
+
+    // Names are expected to be string literals, they are stored by pointer and written once
+    void logApiCall(const char *function, bool enter, int32_t errorCode);
+    void logAllocation(const char *allocationType, const char *memoryPool, uint32_t rootDeviceIndex, uint64_t gpuAddress, uint64_t size);
+    void logText(const std::string &text);
+
+    void flush();
+    uint64_t getDroppedRecordsCount() const { return droppedRecords.load(); }
+
+    static bool decode(const char *data, size_t size, std::ostream &out);
+
+  protected:
+    struct Record {
+        uint64_t timestamp = 0u;
+        RecordType type = RecordType::Text;
+        int32_t value = 0;
+        const char *name = nullptr;
+        const char *detail = nullptr;
+        uint64_t data[2] = {};
+    };
+
+    struct ThreadBuffer {
+        uint64_t threadId = 0u;
+        std::atomic<uint64_t> head{0u};
+        std::atomic<uint64_t> tail{0u};
+        std::array<Record, threadBufferRecords> records;
+    };
+
+    struct TextRecord {
+        uint64_t timestamp;
+        uint64_t threadId;
+        std::string text;
+    };
+
+    static void *writerThreadFunc(void *self);
+    static uint64_t getTimestamp();
+    static uint64_t getThreadId();
+
+    ThreadBuffer *getThreadBuffer();
+    void pushRecord(const Record &record);
+    bool drain();
+    void writeRecord(RecordType type, const void *payload, size_t payloadSize, const char *text = nullptr, size_t textSize = 0u);
+    uint64_t getStringId(const char *string);
+
+    const uint64_t writerId;
+    std::ofstream file;
+
+    std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+    std::mutex threadBuffersMtx;
+    std::atomic<uint64_t> droppedRecords{0u};
+    uint64_t reportedDroppedRecords = 0u;
+
+    std::vector<TextRecord> textRecords;
+    std::mutex textRecordsMtx;
+
+    // Accessed only while draining
+    std::unordered_map<const char *, uint64_t> stringIds;
+    std::mutex drainMtx;
+
+    std::unique_ptr<Thread> writerThread;
+    std::condition_variable writerCondition;
+    std::mutex writerMtx;
+    bool stopWriter = false;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,110 @@
 
 #include "shared/source/utilities/heap_allocator.h"
 
+#include "shared/source/helpers/basic_math.h"
+
+#include <algorithm>
+#include <iterator>
+
 namespace NEO {
 
-bool operator<(const HeapChunk &hc1, const HeapChunk &hc2) {
-    return hc1.ptr < hc2.ptr;
+uint32_t FreedChunks::getAlignmentClass(uint64_t ptr) {
+    return std::min(static_cast<uint32_t>(Math::ffs(ptr)), alignmentClassesCount - 1);
+}
+
+void FreedChunks::insertBySize(uint64_t ptr, size_t size) {
+    auto alignmentClass = getAlignmentClass(ptr);
+    chunksBySize.emplace(size, ptr);
+    chunksByAlignment[alignmentClass].emplace(size, ptr);
+    usedAlignmentClasses |= (1ull << alignmentClass);
+}
+
+void FreedChunks::eraseBySize(uint64_t ptr, size_t size) {
+    auto alignmentClass = getAlignmentClass(ptr);
+    chunksBySize.erase({size, ptr});
+    chunksByAlignment[alignmentClass].erase({size, ptr});
+    if (chunksByAlignment[alignmentClass].empty()) {
+        usedAlignmentClasses &= ~(1ull << alignmentClass);
+    }
+}
+
+void FreedChunks::insert(uint64_t ptr, size_t size) {
+    chunksByAddress.emplace(ptr, size);
+    insertBySize(ptr, size);
+}
+
+FreedChunks::iterator FreedChunks::erase(iterator chunk) {
+    eraseBySize(chunk->first, chunk->second);
+    return chunksByAddress.erase(chunk);
+}
+
+void FreedChunks::shrink(iterator chunk, size_t newSize) {
+    eraseBySize(chunk->first, chunk->second);
+    chunk->second = newSize;
+    insertBySize(chunk->first, newSize);
+}
+
+void FreedChunks::store(uint64_t ptr, size_t size) {
+    auto chunkEnd = ptr + size;
+    auto next = chunksByAddress.lower_bound(ptr);
+
+    while (next != chunksByAddress.end() && next->first + next->second <= chunkEnd) {
+        next = erase(next);
+    }
+
+    if (next != chunksByAddress.end() && next->first == chunkEnd) {
+        size += next->second;
+        next = erase(next);
+    }
+
+    if (next != chunksByAddress.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == ptr) {
+            ptr = previous->first;
+            size += previous->second;
+            erase(previous);
+        }
+    }
+
+    insert(ptr, size);
+}
+
+FreedChunks::iterator FreedChunks::findBestFit(size_t size, size_t requiredAlignment) {
+    auto bestFit = chunksBySize.lower_bound({size, 0llu});
+    if (bestFit == chunksBySize.end()) {
+        return chunksByAddress.end();
+    }
+    if (isAligned(bestFit->second, requiredAlignment)) {
+        return chunksByAddress.find(bestFit->second);
+    }
+
+    // every chunk in an alignment class not lower than the required one is aligned,
+    // so at most one lookup per class is needed regardless of misaligned chunks count
+    DEBUG_BREAK_IF(!Math::isPow2(requiredAlignment));
+    auto minAlignmentClass = std::min(Math::log2(static_cast<uint64_t>(requiredAlignment)), alignmentClassesCount - 1);
+    auto alignmentClasses = usedAlignmentClasses & ~((1ull << minAlignmentClass) - 1);
+
+    const std::pair<size_t, uint64_t> *alignedBestFit = nullptr;
+    while (alignmentClasses != 0u) {
+        auto alignmentClass = static_cast<uint32_t>(Math::ffs(alignmentClasses));
+        alignmentClasses &= alignmentClasses - 1;
+
+        auto chunk = chunksByAlignment[alignmentClass].lower_bound({size, 0llu});
+        if (chunk != chunksByAlignment[alignmentClass].end() && (alignedBestFit == nullptr || *chunk < *alignedBestFit)) {
+            alignedBestFit = &*chunk;
+        }
+    }
+    return alignedBestFit ? chunksByAddress.find(alignedBestFit->second) : chunksByAddress.end();
+}
+
+FreedChunks::iterator FreedChunks::findEndingAt(uint64_t address) {
+    auto next = chunksByAddress.lower_bound(address);
+    if (next != chunksByAddress.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second == address) {
+            return previous;
+        }
+    }
+    return chunksByAddress.end();
 }
 } // namespace NEO
@@ -9,19 +9,49 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 
-#include <algorithm>
+#include <array>
 #include <cstdint>
-#include <vector>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
 
 namespace NEO {
 
-struct HeapChunk {
-    HeapChunk(uint64_t ptr, size_t size) : ptr(ptr), size(size) {}
-    uint64_t ptr;
-    size_t size;
-};
+// Free chunks indexed both by address (for coalescing) and by size (for best fit lookup)
+class FreedChunks {
+  public:
+    using ChunksByAddress = std::map<uint64_t, size_t>;
+    using iterator = ChunksByAddress::iterator;
+
+    size_t size() const { return chunksByAddress.size(); }
+    bool empty() const { return chunksByAddress.empty(); }
+    iterator begin() { return chunksByAddress.begin(); }
+    iterator end() { return chunksByAddress.end(); }
+    iterator find(uint64_t ptr) { return chunksByAddress.find(ptr); }
+
+    void insert(uint64_t ptr, size_t size);
+    iterator erase(iterator chunk);
+    void shrink(iterator chunk, size_t newSize);
+    void store(uint64_t ptr, size_t size);
 
-bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
+    iterator findBestFit(size_t size, size_t requiredAlignment);
+    iterator findEndingAt(uint64_t address);
+
+  protected:
+    using ChunksBySize = std::set<std::pair<size_t, uint64_t>>;
+    static constexpr uint32_t alignmentClassesCount = 64u;
+
+    static uint32_t getAlignmentClass(uint64_t ptr);
+    void insertBySize(uint64_t ptr, size_t size);
+    void eraseBySize(uint64_t ptr, size_t size);
+
+    ChunksByAddress chunksByAddress;
+    ChunksBySize chunksBySize;
+    // Same chunks bucketed by log2 of address alignment, bounds custom alignment lookups
+    std::array<ChunksBySize, alignmentClassesCount> chunksByAlignment;
+    uint64_t usedAlignmentClasses = 0u;
+};
 
 class HeapAllocator {
   public:
@@ -34,8 +64,6 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
         pLeftBound = address;
         pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
     }
 
     uint64_t allocate(size_t &sizeToAllocate) {
@@ -56,7 +84,7 @@ class HeapAllocator {
             return 0llu;
         }
 
-        std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+        FreedChunks &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
         uint32_t defragmentCount = 0;
 
         for (;;) {
@@ -149,134 +177,70 @@ class HeapAllocator {
     size_t allocationAlignment;
     const size_t sizeThreshold;
 
-    std::vector<HeapChunk> freedChunksSmall;
-    std::vector<HeapChunk> freedChunksBig;
+    FreedChunks freedChunksSmall;
+    FreedChunks freedChunksBig;
     std::mutex mtx;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
-        size_t elements = freedChunks.size();
-        size_t bestFitIndex = -1;
-        size_t bestFitSize = 0;
+    uint64_t getFromFreedChunks(size_t size, FreedChunks &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
         sizeOfFreedChunk = 0;
 
-        for (size_t i = 0; i < elements; i++) {
-            const bool chunkAligned = isAligned(freedChunks[i].ptr, requiredAlignment);
-            if (!chunkAligned) {
-                continue;
-            }
+        auto bestFit = freedChunks.findBestFit(size, requiredAlignment);
+        if (bestFit == freedChunks.end()) {
+            return 0llu;
+        }
 
-            if (freedChunks[i].size == size) {
-                auto ptr = freedChunks[i].ptr;
-                freedChunks.erase(freedChunks.begin() + i);
-                return ptr;
-            }
+        auto ptr = bestFit->first;
+        auto bestFitSize = bestFit->second;
 
-            if (freedChunks[i].size > size) {
-                if (freedChunks[i].size < bestFitSize || bestFitSize == 0) {
-                    bestFitIndex = i;
-                    bestFitSize = freedChunks[i].size;
-                }
-            }
+        if (bestFitSize == size) {
+            freedChunks.erase(bestFit);
+            return ptr;
         }
 
-        if (bestFitSize != 0) {
-            if (bestFitSize < (size << 1)) {
-                auto ptr = freedChunks[bestFitIndex].ptr;
-                sizeOfFreedChunk = freedChunks[bestFitIndex].size;
-                freedChunks.erase(freedChunks.begin() + bestFitIndex);
-                return ptr;
-            } else {
-                size_t sizeDelta = freedChunks[bestFitIndex].size - size;
+        if (bestFitSize < (size << 1)) {
+            sizeOfFreedChunk = bestFitSize;
+            freedChunks.erase(bestFit);
+            return ptr;
+        }
 
-                DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
+        size_t sizeDelta = bestFitSize - size;
 
-                auto ptr = freedChunks[bestFitIndex].ptr + sizeDelta;
-                freedChunks[bestFitIndex].size = sizeDelta;
-                return ptr;
-            }
-        }
-        return 0llu;
-    }
+        DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
 
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
-        for (auto &freedChunk : freedChunks) {
-            if (freedChunk.ptr == ptr + size) {
-                freedChunk.ptr = ptr;
-                freedChunk.size += size;
-                return;
-            }
-            if (freedChunk.ptr + freedChunk.size == ptr) {
-                freedChunk.size += size;
-                return;
-            }
-            if ((freedChunk.ptr + freedChunk.size) == (ptr + size)) {
-                if (ptr < freedChunk.ptr) {
-                    freedChunk.ptr = ptr;
-                    freedChunk.size = size;
-                    return;
-                }
-            }
+        if (!isAligned(ptr + sizeDelta, requiredAlignment)) {
+            // tail of the chunk does not meet custom alignment, return its aligned head instead
+            freedChunks.erase(bestFit);
+            freedChunks.insert(ptr + size, sizeDelta);
+            return ptr;
         }
 
-        freedChunks.emplace_back(ptr, size);
+        freedChunks.shrink(bestFit, sizeDelta);
+        return ptr + sizeDelta;
+    }
+
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedChunks &freedChunks) {
+        freedChunks.store(ptr, size);
     }
 
     void mergeLastFreedSmall() {
-        size_t maxSizeOfSmallChunks = freedChunksSmall.size();
-
-        if (maxSizeOfSmallChunks > 0) {
-            auto ptr = freedChunksSmall[maxSizeOfSmallChunks - 1].ptr;
-            size_t chunkSize = freedChunksSmall[maxSizeOfSmallChunks - 1].size;
-            if (ptr == pRightBound) {
-                pRightBound = ptr + chunkSize;
-                freedChunksSmall.pop_back();
-            }
+        auto chunk = freedChunksSmall.find(pRightBound);
+        if (chunk != freedChunksSmall.end()) {
+            pRightBound += chunk->second;
+            freedChunksSmall.erase(chunk);
         }
     }
 
     void mergeLastFreedBig() {
-        size_t maxSizeOfBigChunks = freedChunksBig.size();
-
-        if (maxSizeOfBigChunks > 0) {
-            auto ptr = freedChunksBig[maxSizeOfBigChunks - 1].ptr;
-            size_t chunkSize = freedChunksBig[maxSizeOfBigChunks - 1].size;
-            if (ptr == pLeftBound - chunkSize) {
-                pLeftBound = ptr;
-                freedChunksBig.pop_back();
-            }
+        auto chunk = freedChunksBig.findEndingAt(pLeftBound);
+        if (chunk != freedChunksBig.end()) {
+            pLeftBound = chunk->first;
+            freedChunksBig.erase(chunk);
         }
     }
 
     void defragment() {
-
-        if (freedChunksSmall.size() > 1) {
-            std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
-            size_t maxSize = freedChunksSmall.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksSmall[i].ptr;
-                size_t chunkSize = freedChunksSmall[i].size;
-
-                if (freedChunksSmall[i - 1].ptr == ptr + chunkSize) {
-                    freedChunksSmall[i - 1].ptr = ptr;
-                    freedChunksSmall[i - 1].size += chunkSize;
-                    freedChunksSmall.erase(freedChunksSmall.begin() + i);
-                }
-            }
-        }
+        // freed chunks are coalesced when stored, only chunks adjacent to the bounds are left to merge
         mergeLastFreedSmall();
-        if (freedChunksBig.size() > 1) {
-            std::sort(freedChunksBig.begin(), freedChunksBig.end());
-
-            size_t maxSize = freedChunksBig.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksBig[i].ptr;
-                size_t chunkSize = freedChunksBig[i].size;
-                if ((freedChunksBig[i - 1].ptr + freedChunksBig[i - 1].size) == ptr) {
-                    freedChunksBig[i - 1].size += chunkSize;
-                    freedChunksBig.erase(freedChunksBig.begin() + i);
-                }
-            }
-        }
         mergeLastFreedBig();
         DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
     }
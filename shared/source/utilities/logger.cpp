@@ -9,6 +9,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/utilities/binary_log_writer.h"
 
 #include <memory>
 #include <string>
@@ -30,6 +31,10 @@ FileLogger<DebugLevel>::FileLogger(std::string filename, const DebugVariables &f
     logAllocationMemoryPool = flags.LogAllocationMemoryPool.get();
     logAllocationType = flags.LogAllocationType.get();
     logAllocationStdout = flags.LogAllocationStdout.get();
+
+    if (enabled() && flags.LogBinaryFormat.get()) {
+        binaryLogWriter = std::make_unique<BinaryLogWriter>(logFileName, true);
+    }
 }
 
 template <DebugFunctionalityLevel DebugLevel>
@@ -45,6 +50,15 @@ void FileLogger<DebugLevel>::writeToFile(std::string filename, const char *str,
     }
 }
 
+template <DebugFunctionalityLevel DebugLevel>
+void FileLogger<DebugLevel>::writeToLog(const std::string &str) {
+    if (binaryLogWriter) {
+        binaryLogWriter->logText(str);
+        return;
+    }
+    writeToFile(logFileName, str.c_str(), str.size(), std::ios::app);
+}
+
 template <DebugFunctionalityLevel DebugLevel>
 void FileLogger<DebugLevel>::dumpKernel(const std::string &name, const std::string &src) {
     if (false == enabled()) {
@@ -64,6 +78,11 @@ void FileLogger<DebugLevel>::logApiCall(const char *function, bool enter, int32_
     }
 
     if (logApiCalls) {
+        if (binaryLogWriter) {
+            binaryLogWriter->logApiCall(function, enter, errorCode);
+            return;
+        }
+
         std::thread::id thisThread = std::this_thread::get_id();
 
         std::stringstream ss;
@@ -90,6 +109,13 @@ void FileLogger<DebugLevel>::logAllocation(GraphicsAllocation const *graphicsAll
     }
 
     if (logAllocationMemoryPool || logAllocationType) {
+        if (binaryLogWriter && !logAllocationStdout) {
+            binaryLogWriter->logAllocation(getAllocationTypeString(graphicsAllocation), getMemoryPoolString(graphicsAllocation),
+                                           graphicsAllocation->getRootDeviceIndex(), graphicsAllocation->getGpuAddress(),
+                                           graphicsAllocation->getUnderlyingBufferSize());
+            return;
+        }
+
         std::stringstream ss;
         std::thread::id thisThread = std::this_thread::get_id();
 
@@ -7,10 +7,12 @@
 
 #pragma once
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/trace_exporter.h"
 
 #include <cinttypes>
 #include <cstddef>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -18,6 +20,7 @@
 #include <utility>
 
 namespace NEO {
+class BinaryLogWriter;
 class Kernel;
 struct MultiDispatchInfo;
 class GraphicsAllocation;
@@ -44,6 +47,7 @@ class FileLogger {
     size_t getInput(const size_t *input, int32_t index);
 
     MOCKABLE_VIRTUAL void writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode);
+    void writeToLog(const std::string &str);
 
     void dumpBinaryProgram(int32_t numDevices, const size_t *lengths, const unsigned char **binaries);
 
@@ -103,8 +107,7 @@ class FileLogger {
                 printInputs(ss, "ThreadID", thisThread, params...);
                 ss << "------------------------------" << std::endl;
 
-                const auto str = ss.str();
-                writeToFile(logFileName, str.c_str(), str.length(), std::ios::app);
+                writeToLog(ss.str());
             }
         }
     }
@@ -126,8 +129,7 @@ class FileLogger {
                 std::stringstream ss;
                 print(ss, "ThreadID", thisThread, params...);
 
-                const auto str = ss.str();
-                writeToFile(logFileName, str.c_str(), str.length(), std::ios::app);
+                writeToLog(ss.str());
             }
         }
     }
@@ -145,6 +147,7 @@ class FileLogger {
   protected:
     std::mutex mutex;
     std::string logFileName;
+    std::unique_ptr<BinaryLogWriter> binaryLogWriter;
     bool dumpKernels = false;
     bool logApiCalls = false;
     bool logAllocationMemoryPool = false;
@@ -196,15 +199,24 @@ class LoggerApiEnterWrapper {
         : funcName(funcName), errorCode(errorCode) {
         if (Enabled) {
             fileLoggerInstance().logApiCall(funcName, true, 0);
+            traceExporter = traceExporterInstance();
+            if (traceExporter) {
+                traceStart = traceExporter->getCpuTimestamp();
+            }
         }
     }
     ~LoggerApiEnterWrapper() {
         if (Enabled) {
             fileLoggerInstance().logApiCall(funcName, false, (errorCode != nullptr) ? *errorCode : 0);
+            if (traceExporter) {
+                traceExporter->addHostSpan(funcName, "api", traceStart, traceExporter->getCpuTimestamp());
+            }
         }
     }
     const char *funcName;
     const int *errorCode;
+    TraceExporter *traceExporter = nullptr;
+    uint64_t traceStart = 0u;
 };
 
 }; // namespace NEO
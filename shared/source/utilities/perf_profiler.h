@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/utilities/timer_util.h"
+#include "shared/source/utilities/trace_exporter.h"
 
 #include <atomic>
 #include <fstream>
@@ -103,7 +104,7 @@ extern thread_local PerfProfiler *gPerfProfiler;
 
 struct PerfProfilerApiWrapper {
     PerfProfilerApiWrapper(const char *funcName)
-        : funcName(funcName) {
+        : funcName(funcName), traceScope(funcName, "api") {
         PerfProfiler::create();
         gPerfProfiler->apiEnter();
     }
@@ -113,6 +114,7 @@ struct PerfProfilerApiWrapper {
     }
 
     const char *funcName;
+    TraceExporterScope traceScope;
 };
 #endif
 }; // namespace NEO
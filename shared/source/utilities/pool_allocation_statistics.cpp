@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/pool_allocation_statistics.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+namespace NEO {
+
+double PoolAllocationStatistics::getHitRate() const {
+    auto allocations = allocationsFromPool + allocationsNotFromPool;
+    return allocations ? 100.0 * static_cast<double>(allocationsFromPool) / static_cast<double>(allocations) : 0.0;
+}
+
+uint64_t PoolAllocationStatistics::getSavedAllocations() const {
+    // every pool is a graphics allocation itself
+    return allocationsFromPool > poolsCreated ? allocationsFromPool - poolsCreated : 0u;
+}
+
+void PoolAllocationStatistics::print(bool enabled, const char *poolName, const char *allocationsName) const {
+    PRINT_DEBUG_STRING(enabled, stderr,
+                       "%s: %s from pool: %llu, %s not from pool: %llu, pool hit rate: %.2f%%, pools created: %llu, pools released: %llu, saved graphics allocations: %llu\n",
+                       poolName,
+                       allocationsName,
+                       static_cast<unsigned long long>(allocationsFromPool),
+                       allocationsName,
+                       static_cast<unsigned long long>(allocationsNotFromPool),
+                       getHitRate(),
+                       static_cast<unsigned long long>(poolsCreated),
+                       static_cast<unsigned long long>(poolsReleased),
+                       static_cast<unsigned long long>(getSavedAllocations()));
+}
+
+} // namespace NEO
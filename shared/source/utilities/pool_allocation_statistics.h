@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace NEO {
+
+// Counters shared by allocators which suballocate small allocations from pools
+struct PoolAllocationStatistics {
+    uint64_t allocationsFromPool = 0u;
+    uint64_t allocationsNotFromPool = 0u;
+    uint64_t poolsCreated = 0u;
+    uint64_t poolsReleased = 0u;
+
+    double getHitRate() const;
+    uint64_t getSavedAllocations() const;
+    void print(bool enabled, const char *poolName, const char *allocationsName) const;
+};
+
+} // namespace NEO
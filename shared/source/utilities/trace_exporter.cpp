@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_exporter.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/os_interface/os_time.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+
+namespace NEO {
+namespace {
+void writeJsonString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+void writeMicroseconds(std::ostream &out, uint64_t nanoseconds) {
+    out << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000 << std::setfill(' ');
+}
+} // namespace
+
+TraceExporter *traceExporterOverride = nullptr;
+
+TraceExporter *traceExporterInstance() {
+    if (traceExporterOverride) {
+        return traceExporterOverride;
+    }
+    static std::unique_ptr<TraceExporter> traceExporter = DebugManager.flags.ChromeTraceFile.get() != "unk"
+                                                              ? std::make_unique<TraceExporter>(DebugManager.flags.ChromeTraceFile.get(), OSTime::create(nullptr))
+                                                              : nullptr;
+    return traceExporter.get();
+}
+
+TraceExporter::TraceExporter(const std::string &fileName, std::unique_ptr<OSTime> osTime) : fileName(fileName), osTime(std::move(osTime)) {
+}
+
+TraceExporter::~TraceExporter() {
+    writeToFile();
+}
+
+uint32_t TraceExporter::getHostTrackId() {
+    static std::atomic<uint32_t> nextTrackId{1u};
+    static thread_local uint32_t trackId = nextTrackId++;
+    return trackId;
+}
+
+uint64_t TraceExporter::getCpuTimestamp() {
+    uint64_t timestamp = 0u;
+    osTime->getCpuTime(&timestamp);
+    return timestamp;
+}
+
+void TraceExporter::addHostSpan(const char *name, const char *category, uint64_t start, uint64_t end) {
+    std::lock_guard<std::mutex> lock(mtx);
+    spans.push_back({name, category, getHostTrackId(), start, end});
+}
+
+void TraceExporter::addGpuSpan(const std::string &name, uint32_t rootDeviceIndex, uint64_t start, uint64_t end) {
+    std::lock_guard<std::mutex> lock(mtx);
+    spans.push_back({name, "gpu", gpuTrackIdBase + rootDeviceIndex, start, end});
+}
+
+void TraceExporter::setTimestampPacketsName(const TimestampPacketContainer &timestampPackets, const std::string &name) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto node : timestampPackets.peekNodes()) {
+        timestampPacketNames[node] = name;
+    }
+}
+
+void TraceExporter::addTimestampPackets(const TimestampPacketContainer &timestampPackets, OSTime &deviceOsTime, double timerResolution,
+                                        uint32_t timestampBits, uint32_t rootDeviceIndex) {
+    if (timestampPackets.peekNodes().empty()) {
+        return;
+    }
+    TimeStampData reference = {};
+    if (!deviceOsTime.getCpuGpuTime(&reference)) {
+        return;
+    }
+
+    for (auto node : timestampPackets.peekNodes()) {
+        // only named nodes are exported, so nodes shared between containers are reported once
+        std::string name;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            auto nodeName = timestampPacketNames.find(node);
+            if (nodeName == timestampPacketNames.end()) {
+                continue;
+            }
+            name = std::move(nodeName->second);
+            timestampPacketNames.erase(nodeName);
+        }
+
+        // packets keep only the low bits of the global timestamp, ticks are counted back from the reference pair
+        auto bits = std::min(timestampBits, static_cast<uint32_t>(node->getSinglePacketSize() * 2));
+        auto mask = (bits < 64u) ? ((1ull << bits) - 1) : ~0ull;
+        for (uint32_t packet = 0u; packet < node->getPacketsUsed(); packet++) {
+            auto globalStart = node->getGlobalStartValue(packet);
+            auto globalEnd = node->getGlobalEndValue(packet);
+            if (globalStart == 1u || globalEnd == 1u) {
+                continue;
+            }
+            auto ticksSinceStart = (reference.GPUTimeStamp - globalStart) & mask;
+            auto ticksSinceEnd = (reference.GPUTimeStamp - globalEnd) & mask;
+            auto start = reference.CPUTimeinNS - static_cast<uint64_t>(ticksSinceStart * timerResolution);
+            auto end = reference.CPUTimeinNS - static_cast<uint64_t>(ticksSinceEnd * timerResolution);
+            addGpuSpan(name, rootDeviceIndex, start, std::max(start, end));
+        }
+    }
+}
+
+std::string TraceExporter::serialize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto processId = SysCalls::getProcessId();
+
+    std::vector<uint32_t> gpuTracks;
+    for (const auto &span : spans) {
+        if (span.trackId >= gpuTrackIdBase && std::find(gpuTracks.begin(), gpuTracks.end(), span.trackId) == gpuTracks.end()) {
+            gpuTracks.push_back(span.trackId);
+        }
+    }
+
+    std::ostringstream stream;
+    stream << "{\"traceEvents\":[\n";
+    stream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << processId << ",\"args\":{\"name\":\"NEO\"}}";
+    for (auto trackId : gpuTracks) {
+        stream << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processId << ",\"tid\":" << trackId
+               << ",\"args\":{\"name\":\"GPU " << trackId - gpuTrackIdBase << "\"}}";
+    }
+    for (const auto &span : spans) {
+        stream << ",\n{\"name\":";
+        writeJsonString(stream, span.name);
+        stream << ",\"cat\":\"" << span.category << "\",\"ph\":\"X\",\"pid\":" << processId << ",\"tid\":" << span.trackId << ",\"ts\":";
+        writeMicroseconds(stream, span.start);
+        stream << ",\"dur\":";
+        writeMicroseconds(stream, span.end - span.start);
+        stream << "}";
+    }
+    stream << "\n]}\n";
+    return stream.str();
+}
+
+bool TraceExporter::writeToFile() {
+    if (fileName.empty()) {
+        return false;
+    }
+    auto contents = serialize();
+    return writeDataToFile(fileName.c_str(), contents.c_str(), contents.size()) == contents.size();
+}
+
+size_t TraceExporter::getSpansCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return spans.size();
+}
+} // namespace NEO
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class OSTime;
+class TagNodeBase;
+class TimestampPacketContainer;
+
+// Collects host and GPU time spans on a common CPU timeline and writes them
+// in Chrome trace event format (chrome://tracing, ui.perfetto.dev).
+class TraceExporter : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t gpuTrackIdBase = 0x10000000u;
+
+    struct Span {
+        std::string name;
+        const char *category;
+        uint32_t trackId;
+        uint64_t start;
+        uint64_t end;
+    };
+
+    TraceExporter(const std::string &fileName, std::unique_ptr<OSTime> osTime);
+    MOCKABLE_VIRTUAL ~TraceExporter();
+
+    uint64_t getCpuTimestamp();
+    void addHostSpan(const char *name, const char *category, uint64_t start, uint64_t end);
+    void addGpuSpan(const std::string &name, uint32_t rootDeviceIndex, uint64_t start, uint64_t end);
+
+    // Nodes named with setTimestampPacketsName are exported once, GPU ticks are converted
+    // to CPU time using a fresh CPU/GPU timestamp pair from deviceOsTime
+    void setTimestampPacketsName(const TimestampPacketContainer &timestampPackets, const std::string &name);
+    void addTimestampPackets(const TimestampPacketContainer &timestampPackets, OSTime &deviceOsTime, double timerResolution,
+                             uint32_t timestampBits, uint32_t rootDeviceIndex);
+
+    std::string serialize();
+    bool writeToFile();
+    size_t getSpansCount();
+
+  protected:
+    static uint32_t getHostTrackId();
+
+    std::string fileName;
+    std::unique_ptr<OSTime> osTime;
+    std::vector<Span> spans;
+    std::unordered_map<const TagNodeBase *, std::string> timestampPacketNames;
+    std::mutex mtx;
+};
+
+// Set by tests to trace into their own exporter
+extern TraceExporter *traceExporterOverride;
+TraceExporter *traceExporterInstance();
+
+class TraceExporterScope : NonCopyableOrMovableClass {
+  public:
+    TraceExporterScope(const char *name, const char *category) : exporter(traceExporterInstance()), name(name), category(category) {
+        if (exporter) {
+            start = exporter->getCpuTimestamp();
+        }
+    }
+
+    ~TraceExporterScope() {
+        if (exporter) {
+            exporter->addHostSpan(name, category, start, exporter->getCpuTimestamp());
+        }
+    }
+
+  protected:
+    TraceExporter *exporter;
+    const char *name;
+    const char *category;
+    uint64_t start = 0u;
+};
+} // namespace NEO
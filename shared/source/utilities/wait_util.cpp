@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,17 +9,91 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
 namespace NEO {
 
 namespace WaitUtils {
 
 uint32_t waitCount = defaultWaitCount;
+bool adaptiveWaitEnabled = false;
 
 void init() {
     int32_t overrideWaitCount = DebugManager.flags.WaitLoopCount.get();
     if (overrideWaitCount != -1) {
         waitCount = static_cast<uint32_t>(overrideWaitCount);
     }
+    adaptiveWaitEnabled = DebugManager.flags.EnableAdaptiveWaitPolicy.get() == 1;
+}
+
+bool AdaptiveWaitPolicy::waitFunction(volatile uint32_t *pollAddress, uint32_t expectedValue, uint64_t elapsedNs) {
+    auto phase = getPhase(elapsedNs);
+    if (phase == WaitPhase::Spin) {
+        for (uint32_t i = 0; i < spinPauseCount; i++) {
+            CpuIntrinsics::pause();
+        }
+    }
+    if (*pollAddress >= expectedValue) {
+        return true;
+    }
+    if (phase == WaitPhase::Yield) {
+        std::this_thread::yield();
+    } else if (phase == WaitPhase::Sleep) {
+        std::this_thread::sleep_for(std::chrono::microseconds(sleepTimeUs));
+    }
+    return false;
+}
+
+WaitPhase AdaptiveWaitPolicy::getPhase(uint64_t elapsedNs) const {
+    auto latencyNs = getEstimatedLatencyNs();
+    auto spinTimeNs = std::clamp(2 * latencyNs, minSpinTimeNs, maxSpinTimeNs);
+    if (elapsedNs < spinTimeNs) {
+        return WaitPhase::Spin;
+    }
+    auto yieldTimeNs = std::clamp(4 * latencyNs, minYieldTimeNs, maxYieldTimeNs);
+    if (elapsedNs < yieldTimeNs) {
+        return WaitPhase::Yield;
+    }
+    return WaitPhase::Sleep;
+}
+
+void AdaptiveWaitPolicy::recordWait(uint64_t waitTimeNs) {
+    auto latencyNs = getEstimatedLatencyNs();
+    if (waitsCount.fetch_add(1u, std::memory_order_relaxed) == 0u) {
+        latencyNs = waitTimeNs;
+    } else {
+        latencyNs = (7 * latencyNs + waitTimeNs) / 8;
+    }
+    estimatedLatencyNs.store(latencyNs, std::memory_order_relaxed);
+    histogram[getHistogramBucketIndex(waitTimeNs)].fetch_add(1u, std::memory_order_relaxed);
+}
+
+size_t AdaptiveWaitPolicy::getHistogramBucketIndex(uint64_t waitTimeNs) {
+    auto waitTimeUs = waitTimeNs / 1000u;
+    size_t bucket = 0u;
+    while (waitTimeUs > 0u && bucket < histogramBucketsCount - 1) {
+        waitTimeUs >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void AdaptiveWaitPolicy::printStatistics(const char *name) const {
+    PRINT_DEBUG_STRING(true, stderr, "Wait statistics for %s: waits: %llu, estimated latency: %f us\n", name,
+                       static_cast<unsigned long long>(getWaitsCount()), getEstimatedLatencyNs() / 1e3);
+    for (size_t bucket = 0; bucket < histogramBucketsCount; bucket++) {
+        auto count = getHistogramBucket(bucket);
+        if (count == 0u) {
+            continue;
+        }
+        if (bucket == histogramBucketsCount - 1) {
+            PRINT_DEBUG_STRING(true, stderr, "  >= %llu us: %llu\n", 1ull << (bucket - 1), static_cast<unsigned long long>(count));
+        } else {
+            PRINT_DEBUG_STRING(true, stderr, "  < %llu us: %llu\n", 1ull << bucket, static_cast<unsigned long long>(count));
+        }
+    }
 }
 
 } // namespace WaitUtils
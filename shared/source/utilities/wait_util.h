@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #pragma once
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <thread>
@@ -18,6 +20,7 @@ namespace WaitUtils {
 
 constexpr uint32_t defaultWaitCount = 1u;
 extern uint32_t waitCount;
+extern bool adaptiveWaitEnabled;
 
 template <typename T>
 inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate) {
@@ -38,6 +41,39 @@ inline bool waitFunction(volatile uint32_t *pollAddress, uint32_t expectedValue)
 }
 
 void init();
+
+enum class WaitPhase : uint32_t {
+    Spin,
+    Yield,
+    Sleep
+};
+
+class AdaptiveWaitPolicy {
+  public:
+    static constexpr size_t histogramBucketsCount = 20u;
+    static constexpr uint64_t minSpinTimeNs = 1'000u;
+    static constexpr uint64_t maxSpinTimeNs = 50'000u;
+    static constexpr uint64_t minYieldTimeNs = 100'000u;
+    static constexpr uint64_t maxYieldTimeNs = 1'000'000u;
+    static constexpr uint64_t sleepTimeUs = 50u;
+    static constexpr uint32_t spinPauseCount = 32u;
+
+    bool waitFunction(volatile uint32_t *pollAddress, uint32_t expectedValue, uint64_t elapsedNs);
+    WaitPhase getPhase(uint64_t elapsedNs) const;
+
+    void recordWait(uint64_t waitTimeNs);
+    uint64_t getEstimatedLatencyNs() const { return estimatedLatencyNs.load(std::memory_order_relaxed); }
+    uint64_t getWaitsCount() const { return waitsCount.load(std::memory_order_relaxed); }
+    uint64_t getHistogramBucket(size_t bucket) const { return histogram[bucket].load(std::memory_order_relaxed); }
+    static size_t getHistogramBucketIndex(uint64_t waitTimeNs);
+
+    void printStatistics(const char *name) const;
+
+  protected:
+    std::atomic<uint64_t> estimatedLatencyNs{0u};
+    std::atomic<uint64_t> waitsCount{0u};
+    std::array<std::atomic<uint64_t>, histogramBucketsCount> histogram{};
+};
 } // namespace WaitUtils
 
 } // namespace NEO
@@ -29,6 +29,10 @@ class CompilerCacheMock : public CompilerCache {
             return nullptr;
     }
 
+    UniqueBinaryPtr loadCachedDeviceBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        return loadCachedBinary(kernelFileHash, cachedBinarySize);
+    }
+
     bool cacheResult = false;
     uint32_t cacheInvoked = 0u;
     bool loadResult = false;
@@ -37,9 +37,10 @@ class MockPageFaultManager : public PageFaultManager {
         transferToCpuAddress = ptr;
         transferToCpuSize = size;
     }
-    void transferToGpu(void *ptr, void *cmdQ) override {
+    void transferToGpu(void *ptr, size_t size, void *cmdQ) override {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
+        transferToGpuSize = size;
     }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
@@ -50,8 +51,8 @@ class MockPageFaultManager : public PageFaultManager {
     void baseCpuTransfer(void *ptr, size_t size, void *cmdQ) {
         PageFaultManager::transferToCpu(ptr, size, cmdQ);
     }
-    void baseGpuTransfer(void *ptr, void *cmdQ) {
-        PageFaultManager::transferToGpu(ptr, cmdQ);
+    void baseGpuTransfer(void *ptr, size_t size, void *cmdQ) {
+        PageFaultManager::transferToGpu(ptr, size, cmdQ);
     }
     void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) override {}
 
@@ -77,6 +78,7 @@ class MockPageFaultManager : public PageFaultManager {
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferToGpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
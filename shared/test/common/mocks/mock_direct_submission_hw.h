@@ -17,9 +17,12 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass = DirectSubmissionHw<GfxFamily, Dispatcher>;
     using BaseClass::activeTiles;
     using BaseClass::allocateResources;
+    using BaseClass::coalescingMaxBytes;
+    using BaseClass::coalescingWindow;
     using BaseClass::completionFenceAllocation;
     using BaseClass::cpuCachelineFlush;
     using BaseClass::currentQueueWorkCount;
+    using BaseClass::directSubmissionController;
     using BaseClass::currentRingBuffer;
     using BaseClass::dcFlushRequired;
     using BaseClass::deallocateResources;
@@ -51,9 +54,12 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::osContext;
     using BaseClass::partitionConfigSet;
     using BaseClass::partitionedMode;
+    using BaseClass::pendingSubmissions;
     using BaseClass::performDiagnosticMode;
     using BaseClass::postSyncOffset;
+    using BaseClass::releaseIdleRingBuffers;
     using BaseClass::reserved;
+    using BaseClass::ringBufferSize;
     using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
     using BaseClass::ringStart;
@@ -18,6 +18,7 @@ template <DebugFunctionalityLevel DebugLevel>
 class TestFileLogger : public NEO::FileLogger<DebugLevel> {
   public:
     using NEO::FileLogger<DebugLevel>::FileLogger;
+    using NEO::FileLogger<DebugLevel>::binaryLogWriter;
 
     ~TestFileLogger() override {
         std::remove(NEO::FileLogger<DebugLevel>::logFileName.c_str());
@@ -7,6 +7,7 @@
 
 #include "shared/source/aub_mem_dump/page_table_entry_bits.h"
 #include "shared/source/command_stream/aub_command_stream_receiver_hw.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hardware_context_controller.h"
 #include "shared/source/helpers/neo_driver_version.h"
 #include "shared/source/os_interface/os_context.h"
@@ -27,8 +28,12 @@
 #include "gtest/gtest.h"
 #include "sys_calls.h"
 
+#include <atomic>
+#include <cstdio>
 #include <fstream>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -1016,3 +1021,200 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWithAubManagerWhenInit
 
     EXPECT_EQ(expectedAddedComments, mockAubManager->receivedComments);
 }
+
+TEST(AubFileStreamTest, givenSkipUnchangedPagesWhenSameMemoryIsWrittenAgainThenWriteIsSkipped) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+
+    std::string fileName = "skip_unchanged_pages.aub";
+    std::vector<char> memory(MemoryConstants::pageSize, 1);
+    AUBCommandStreamReceiver::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    aubFileStream.setGpuReadOnlyMemoryWrite(true);
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    auto sizeAfterFirstWrite = aubFileStream.getStatistics().bytesWritten;
+
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(sizeAfterFirstWrite, aubFileStream.getStatistics().bytesWritten);
+    EXPECT_EQ(1u, aubFileStream.getStatistics().skippedMemoryWrites);
+    EXPECT_EQ(memory.size(), aubFileStream.getStatistics().skippedMemoryBytes);
+
+    aubFileStream.writeMemory(0x2000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceLocal, 0);
+    memory[0] = 2;
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceLocal, 0);
+    EXPECT_EQ(4 * sizeAfterFirstWrite, aubFileStream.getStatistics().bytesWritten);
+    EXPECT_EQ(5u, aubFileStream.getStatistics().memoryWrites);
+    EXPECT_EQ(1u, aubFileStream.getStatistics().skippedMemoryWrites);
+
+    testing::internal::CaptureStderr();
+    aubFileStream.close();
+    auto output = testing::internal::GetCapturedStderr();
+    EXPECT_NE(std::string::npos, output.find("1 of 5 memory writes skipped as unchanged"));
+    std::remove(fileName.c_str());
+}
+
+TEST(AubFileStreamTest, givenSkipUnchangedPagesWhenMemoryWritableByGpuOverlapsPreviousWriteThenSameMemoryIsWrittenAgain) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpSkipUnchangedPages.set(true);
+
+    std::string fileName = "skip_unchanged_pages_gpu_writable.aub";
+    std::vector<char> memory(MemoryConstants::pageSize, 1);
+    AUBCommandStreamReceiver::AubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(0u, aubFileStream.getStatistics().skippedMemoryWrites);
+
+    aubFileStream.setGpuReadOnlyMemoryWrite(true);
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    aubFileStream.setGpuReadOnlyMemoryWrite(false);
+    aubFileStream.writeMemory(0x1800, memory.data(), 0x100, AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    aubFileStream.setGpuReadOnlyMemoryWrite(true);
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(0u, aubFileStream.getStatistics().skippedMemoryWrites);
+
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(1u, aubFileStream.getStatistics().skippedMemoryWrites);
+
+    testing::internal::CaptureStderr();
+    aubFileStream.close();
+    testing::internal::GetCapturedStderr();
+    std::remove(fileName.c_str());
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedPagesWhenAllocationsAreWrittenAgainThenOnlyAllocationsNotWrittenByGpuAreSkipped) {
+    struct SkipUnchangedAubFileStream : MockAubFileStream {
+        using MockAubFileStream::skipUnchangedMemory;
+    };
+    auto aubFileStream = std::make_unique<SkipUnchangedAubFileStream>();
+    aubFileStream->skipUnchangedMemory = true;
+    auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+    aubCsr->initializeEngine();
+    aubCsr->stream = aubFileStream.get();
+
+    std::vector<char> memory(MemoryConstants::pageSize, 1);
+    auto writeTwice = [&](AllocationType allocationType) {
+        MockGraphicsAllocation allocation(memory.data(), memory.size());
+        allocation.setAllocationType(allocationType);
+        auto skippedMemoryWrites = aubFileStream->getStatistics().skippedMemoryWrites;
+        for (int i = 0; i < 2; i++) {
+            aubCsr->setAubWritable(true, allocation);
+            EXPECT_TRUE(aubCsr->writeMemory(allocation));
+        }
+        return aubFileStream->getStatistics().skippedMemoryWrites - skippedMemoryWrites;
+    };
+
+    EXPECT_EQ(0u, writeTwice(AllocationType::BUFFER));
+    EXPECT_LT(0u, writeTwice(AllocationType::KERNEL_ISA));
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedPagesWhenCommandBuffersAndHeapsAreWrittenOnEveryFlushThenUnchangedPagesAreSkipped) {
+    struct SkipUnchangedAubFileStream : MockAubFileStream {
+        using MockAubFileStream::skipUnchangedMemory;
+    };
+    auto aubFileStream = std::make_unique<SkipUnchangedAubFileStream>();
+    aubFileStream->skipUnchangedMemory = true;
+    auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+    aubCsr->initializeEngine();
+    aubCsr->stream = aubFileStream.get();
+
+    std::vector<char> memory(MemoryConstants::pageSize, 1);
+    for (auto allocationType : {AllocationType::COMMAND_BUFFER, AllocationType::INDIRECT_OBJECT_HEAP, AllocationType::LINEAR_STREAM,
+                                AllocationType::SURFACE_STATE_HEAP}) {
+        MockGraphicsAllocation allocation(memory.data(), memory.size());
+        allocation.setAllocationType(allocationType);
+
+        EXPECT_TRUE(aubCsr->writeMemory(allocation));
+        auto memoryWrites = aubFileStream->getStatistics().memoryWrites;
+        auto skippedMemoryWrites = aubFileStream->getStatistics().skippedMemoryWrites;
+
+        // not one time writable, so every flush writes it again without resetting aub writable state
+        EXPECT_TRUE(aubCsr->isAubWritable(allocation));
+        EXPECT_TRUE(aubCsr->writeMemory(allocation));
+        auto newMemoryWrites = aubFileStream->getStatistics().memoryWrites - memoryWrites;
+        EXPECT_LT(0u, newMemoryWrites);
+        EXPECT_EQ(newMemoryWrites, aubFileStream->getStatistics().skippedMemoryWrites - skippedMemoryWrites);
+
+        memory[0]++;
+        skippedMemoryWrites = aubFileStream->getStatistics().skippedMemoryWrites;
+        EXPECT_TRUE(aubCsr->writeMemory(allocation));
+        EXPECT_GT(newMemoryWrites, aubFileStream->getStatistics().skippedMemoryWrites - skippedMemoryWrites);
+    }
+}
+
+TEST(AubFileStreamTest, givenAsyncWriteWhenMemoryIsWrittenThenFileContentsMatchSynchronousWrite) {
+    DebugManagerStateRestore stateRestore;
+    std::vector<char> memory(AUBCommandStreamReceiver::AubFileStream::asyncWriteBufferSize / 2 + 1);
+    for (size_t i = 0; i < memory.size(); i++) {
+        memory[i] = static_cast<char>(i);
+    }
+
+    auto captureFile = [&memory](const std::string &fileName) {
+        AUBCommandStreamReceiver::AubFileStream aubFileStream;
+        aubFileStream.open(fileName.c_str());
+        for (uint64_t physAddress = 0; physAddress < 5 * MemoryConstants::gigaByte; physAddress += MemoryConstants::gigaByte) {
+            aubFileStream.writeMemory(physAddress, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+            aubFileStream.flush();
+        }
+        aubFileStream.writeMMIO(0x2000, 0x1234);
+        aubFileStream.close();
+
+        size_t size = 0;
+        auto data = loadDataFromFile(fileName.c_str(), size);
+        std::remove(fileName.c_str());
+        return std::string(data.get(), size);
+    };
+
+    auto syncContents = captureFile("sync_write.aub");
+
+    DebugManager.flags.AUBDumpAsyncWrite.set(true);
+    testing::internal::CaptureStderr();
+    auto asyncContents = captureFile("async_write.aub");
+    testing::internal::GetCapturedStderr();
+
+    EXPECT_LT(5 * memory.size(), syncContents.size());
+    EXPECT_EQ(syncContents, asyncContents);
+}
+
+TEST(AubFileStreamTest, givenAsyncWriteWhenFlushingWhileWriterIsBusyThenFlushDoesNotWaitAndDataIsWrittenOnClose) {
+    struct BlockingWriteAubFileStream : AUBCommandStreamReceiver::AubFileStream {
+        using AubFileStream::statistics;
+        void writeToFile(const char *data, size_t size) override {
+            while (!writerUnblocked) {
+                std::this_thread::yield();
+            }
+            AubFileStream::writeToFile(data, size);
+        }
+        std::atomic<bool> writerUnblocked{false};
+    };
+
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpAsyncWrite.set(true);
+
+    std::string fileName = "async_write_flush.aub";
+    std::vector<char> memory(AUBCommandStreamReceiver::AubFileStream::asyncWriteBufferSize);
+    BlockingWriteAubFileStream aubFileStream;
+    aubFileStream.open(fileName.c_str());
+    aubFileStream.writeMemory(0x1000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    aubFileStream.writeMMIO(0x2000, 0x1234);
+
+    aubFileStream.flush();
+    EXPECT_EQ(1u, aubFileStream.statistics.flushes);
+    EXPECT_EQ(1u, aubFileStream.statistics.deferredFlushes);
+    EXPECT_EQ(0u, aubFileStream.statistics.blockedTimeNs);
+
+    aubFileStream.writerUnblocked = true;
+    testing::internal::CaptureStderr();
+    aubFileStream.close();
+    auto output = testing::internal::GetCapturedStderr();
+    EXPECT_NE(std::string::npos, output.find("1 of 1 flushes deferred"));
+
+    size_t size = 0;
+    loadDataFromFile(fileName.c_str(), size);
+    EXPECT_EQ(aubFileStream.statistics.bytesWritten, size);
+    std::remove(fileName.c_str());
+}
@@ -24,6 +24,7 @@
 #include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_driver_model.h"
@@ -752,7 +753,7 @@ HWTEST_F(InitDirectSubmissionTest, givenDirectSubmissionControllerEnabledWhenIni
                                                                                                         PreemptionMode::ThreadGroup, device->getDeviceBitfield())));
 
     auto controller = static_cast<DirectSubmissionControllerMock *>(device->executionEnvironment->initializeDirectSubmissionController());
-    controller->keepControlling.store(false);
+    controller->stopControlling();
     EXPECT_EQ(controller->directSubmissions.size(), 0u);
 
     osContext->ensureContextInitialized();
@@ -2174,6 +2175,26 @@ HWTEST_F(CommandStreamReceiverTest, givenMultipleActivePartitionsWhenWaitLogIsEn
     EXPECT_STREQ(expectedOutput.str().c_str(), output.c_str());
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenAdaptiveWaitPolicyEnabledWhenWaitingForNotReadyTagThenWaitIsRecordedInCsrWaitPolicy) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+    VariableBackup<bool> backupAdaptiveWaitEnabled(&WaitUtils::adaptiveWaitEnabled);
+    WaitUtils::init();
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    *csr.tagAddress = 0u;
+    csr.latestFlushedTaskCount = 1u;
+    VariableBackup<std::function<void(GraphicsAllocation &)>> backupDownloadAllocationImpl(&csr.downloadAllocationImpl, [&csr](GraphicsAllocation &graphicsAllocation) {
+        *csr.tagAddress = 1u;
+    });
+
+    EXPECT_EQ(WaitStatus::Ready, csr.waitForCompletionWithTimeout(WaitParams{false, false, 0}, 1u));
+    EXPECT_EQ(1u, csr.getWaitPolicy().getWaitsCount());
+
+    EXPECT_EQ(WaitStatus::Ready, csr.waitForCompletionWithTimeout(WaitParams{false, false, 0}, 1u));
+    EXPECT_EQ(1u, csr.getWaitPolicy().getWaitsCount());
+}
+
 TEST_F(CommandStreamReceiverTest, givenPreambleFlagIsSetWhenGettingFlagStateThenExpectCorrectState) {
     EXPECT_FALSE(commandStreamReceiver->getPreambleSetFlag());
     commandStreamReceiver->setPreambleSetFlag(true);
@@ -24,6 +24,7 @@
 
 #include <array>
 #include <list>
+#include <map>
 #include <memory>
 
 using namespace NEO;
@@ -307,6 +308,256 @@ TEST(CompilerCacheTests, GivenNonExistantConfigWhenLoadingFromCacheThenNullIsRet
     EXPECT_EQ(0U, size);
 }
 
+TEST(CompilerCacheTests, GivenNonExistantConfigWhenLoadingFromCacheThenMissIsCounted) {
+    CompilerCache cache(CompilerCacheConfig{});
+    size_t size;
+    auto ret = cache.loadCachedBinary("----do-not-exists----", size);
+    EXPECT_EQ(nullptr, ret);
+    EXPECT_EQ(1u, cache.getStatistics().misses.load());
+    EXPECT_EQ(0u, cache.getStatistics().hits.load());
+}
+
+class CompilerCacheWithInMemoryFiles : public CompilerCache {
+  public:
+    using CompilerCache::cacheSizeEstimate;
+    using CompilerCache::evictCache;
+
+    CompilerCacheWithInMemoryFiles(const CompilerCacheConfig &config) : CompilerCache(config) {}
+
+    std::unique_ptr<char[]> readCacheFile(const std::string &filePath, size_t &fileSize) override {
+        fileSize = 0u;
+        auto it = files.find(filePath);
+        if (it == files.end()) {
+            return nullptr;
+        }
+        fileSize = it->second.size;
+        return std::make_unique<char[]>(fileSize);
+    }
+
+    UniqueBinaryPtr mapCacheFile(const std::string &filePath, size_t &fileSize) override {
+        mapCacheFileCalled++;
+        return readCacheFile(filePath, fileSize);
+    }
+
+    bool removeCacheFile(const std::string &filePath) override {
+        removedFiles.push_back(filePath);
+        return files.erase(filePath) != 0u;
+    }
+
+    bool writeCacheFileAtomically(const std::string &filePath, const char *pBinary, size_t binarySize) override {
+        if (!writeResult) {
+            return false;
+        }
+        files[filePath] = CacheFileInfo{filePath, binarySize, ++currentTime};
+        return true;
+    }
+
+    size_t getCacheFileSize(const std::string &filePath) override {
+        auto it = files.find(filePath);
+        return (it == files.end()) ? 0u : it->second.size;
+    }
+
+    void markCacheFileUsed(const std::string &filePath) override {
+        files[filePath].lastUsedTime = ++currentTime;
+    }
+
+    std::vector<CacheFileInfo> getCacheFiles() override {
+        getCacheFilesCalled++;
+        std::vector<CacheFileInfo> ret;
+        for (const auto &file : files) {
+            ret.push_back(file.second);
+        }
+        return ret;
+    }
+
+    std::string getFilePath(const std::string &hash) {
+        return config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension;
+    }
+
+    std::map<std::string, CacheFileInfo> files;
+    std::vector<std::string> removedFiles;
+    uint64_t currentTime = 0u;
+    uint32_t mapCacheFileCalled = 0u;
+    uint32_t getCacheFilesCalled = 0u;
+    bool writeResult = true;
+};
+
+TEST(CompilerCacheTests, GivenMappedBinaryCacheLoadEnabledWhenLoadingDeviceBinaryThenCacheFileIsMapped) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 0u});
+    const char binary[64] = {};
+    EXPECT_TRUE(cache.cacheBinary("a", binary, sizeof(binary)));
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedDeviceBinary("a", size);
+    EXPECT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(1u, cache.mapCacheFileCalled);
+    EXPECT_EQ(1u, cache.getStatistics().hits.load());
+
+    EXPECT_EQ(nullptr, cache.loadCachedDeviceBinary("b", size));
+    EXPECT_EQ(0u, size);
+    EXPECT_EQ(2u, cache.mapCacheFileCalled);
+    EXPECT_EQ(1u, cache.getStatistics().misses.load());
+}
+
+TEST(CompilerCacheTests, GivenMappedBinaryCacheLoadDisabledWhenLoadingDeviceBinaryThenCacheFileIsRead) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableMappedBinaryCacheLoad.set(0);
+
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 0u});
+    const char binary[64] = {};
+    EXPECT_TRUE(cache.cacheBinary("a", binary, sizeof(binary)));
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedDeviceBinary("a", size);
+    EXPECT_NE(nullptr, loaded);
+    EXPECT_FALSE(loaded.get_deleter().isMapped());
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0u, cache.mapCacheFileCalled);
+    EXPECT_EQ(1u, cache.getStatistics().hits.load());
+}
+
+TEST(CompilerCacheTests, GivenUnlimitedCacheSizeWhenCachingBinaryThenNothingIsEvicted) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 0u});
+    const char binary[64] = {};
+
+    for (auto hash : {"a", "b", "c", "d"}) {
+        EXPECT_TRUE(cache.cacheBinary(hash, binary, sizeof(binary)));
+    }
+
+    EXPECT_EQ(4u, cache.files.size());
+    EXPECT_TRUE(cache.removedFiles.empty());
+    EXPECT_EQ(4u, cache.getStatistics().stores.load());
+    EXPECT_EQ(0u, cache.getStatistics().evictions.load());
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenCachingBinaryExceedsLimitThenLeastRecentlyUsedFilesAreEvicted) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 192u});
+    const char binary[64] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("a", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("b", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("c", binary, sizeof(binary)));
+
+    size_t size = 0u;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("a", size));
+    EXPECT_EQ(sizeof(binary), size);
+
+    EXPECT_TRUE(cache.cacheBinary("d", binary, sizeof(binary)));
+
+    ASSERT_EQ(1u, cache.removedFiles.size());
+    EXPECT_EQ(cache.getFilePath("b"), cache.removedFiles[0]);
+    EXPECT_EQ(3u, cache.files.size());
+    EXPECT_EQ(1u, cache.getStatistics().evictions.load());
+    EXPECT_EQ(sizeof(binary), cache.getStatistics().evictedBytes.load());
+    EXPECT_EQ(1u, cache.getStatistics().hits.load());
+
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("b", size));
+    EXPECT_EQ(1u, cache.getStatistics().misses.load());
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenEvictingThenOnlyRequiredNumberOfFilesIsRemoved) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 1024u});
+    const char binary[64] = {};
+
+    for (auto hash : {"a", "b", "c", "d"}) {
+        EXPECT_TRUE(cache.cacheBinary(hash, binary, sizeof(binary)));
+    }
+
+    cache.evictCache(2 * sizeof(binary) + 1);
+
+    ASSERT_EQ(2u, cache.removedFiles.size());
+    EXPECT_EQ(cache.getFilePath("a"), cache.removedFiles[0]);
+    EXPECT_EQ(cache.getFilePath("b"), cache.removedFiles[1]);
+    EXPECT_EQ(2u, cache.getStatistics().evictions.load());
+}
+
+TEST(CompilerCacheTests, GivenOrphanedTemporaryFilesWhenEvictingThenTheyAreRemovedWithoutCountingAsEvictions) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 1024u});
+    const char binary[64] = {};
+
+    for (auto hash : {"a", "b"}) {
+        EXPECT_TRUE(cache.cacheBinary(hash, binary, sizeof(binary)));
+    }
+    auto orphanedFilePath = cache.getFilePath("c") + ".a1b2c3";
+    cache.files[orphanedFilePath] = CompilerCache::CacheFileInfo{orphanedFilePath, 512u, 0u, true};
+
+    cache.evictCache(1024u);
+
+    ASSERT_EQ(1u, cache.removedFiles.size());
+    EXPECT_EQ(orphanedFilePath, cache.removedFiles[0]);
+    EXPECT_EQ(2 * sizeof(binary), cache.cacheSizeEstimate);
+    EXPECT_EQ(0u, cache.getStatistics().evictions.load());
+    EXPECT_EQ(0u, cache.getStatistics().evictedBytes.load());
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenCachingBinariesBelowLimitThenCacheDirectoryIsScannedOnlyOnce) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 192u});
+    const char binary[64] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("a", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("b", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("c", binary, sizeof(binary)));
+    EXPECT_EQ(1u, cache.getCacheFilesCalled);
+    EXPECT_TRUE(cache.removedFiles.empty());
+
+    EXPECT_TRUE(cache.cacheBinary("d", binary, sizeof(binary)));
+    EXPECT_EQ(2u, cache.getCacheFilesCalled);
+    EXPECT_EQ(1u, cache.removedFiles.size());
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenWritingCacheFileFailsThenCacheSizeEstimateIsNotIncreased) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 192u});
+    const char binary[64] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("a", binary, sizeof(binary)));
+    EXPECT_EQ(sizeof(binary), cache.cacheSizeEstimate);
+
+    cache.writeResult = false;
+    for (auto hash : {"b", "c", "d"}) {
+        EXPECT_FALSE(cache.cacheBinary(hash, binary, sizeof(binary)));
+    }
+    EXPECT_EQ(sizeof(binary), cache.cacheSizeEstimate);
+    EXPECT_EQ(1u, cache.getCacheFilesCalled);
+    EXPECT_EQ(1u, cache.getStatistics().stores.load());
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenCachedFileIsReplacedThenCacheSizeEstimateCountsItOnce) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 192u});
+    const char binary[64] = {};
+
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(cache.cacheBinary("a", binary, sizeof(binary)));
+    }
+    EXPECT_TRUE(cache.cacheBinary("a", binary, sizeof(binary) / 2));
+    EXPECT_EQ(sizeof(binary) / 2, cache.cacheSizeEstimate);
+    EXPECT_EQ(1u, cache.getCacheFilesCalled);
+    EXPECT_TRUE(cache.removedFiles.empty());
+}
+
+TEST(CompilerCacheTests, GivenBinaryBiggerThanCacheSizeLimitWhenCachingThenBinaryIsNotCached) {
+    CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 32u});
+    const char binary[64] = {};
+
+    EXPECT_FALSE(cache.cacheBinary("a", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.files.empty());
+    EXPECT_EQ(0u, cache.getStatistics().stores.load());
+}
+
+TEST(CompilerCacheTests, GivenPrintBinaryCacheStatisticsWhenCacheIsDestroyedThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintBinaryCacheStatistics.set(true);
+
+    testing::internal::CaptureStderr();
+    {
+        CompilerCacheWithInMemoryFiles cache(CompilerCacheConfig{true, ".cache", "dir", 0u});
+        size_t size = 0u;
+        cache.loadCachedBinary("a", size);
+    }
+    std::string output = testing::internal::GetCapturedStderr();
+    EXPECT_NE(std::string::npos, output.find("Binary cache dir: hits: 0, misses: 1, stores: 0, evictions: 0, evicted bytes: 0"));
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
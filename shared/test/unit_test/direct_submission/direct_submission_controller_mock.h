@@ -12,18 +12,33 @@
 namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::checkNewSubmissions;
+    using DirectSubmissionController::coalescingWindow;
     using DirectSubmissionController::directSubmissionControllingThread;
     using DirectSubmissionController::directSubmissions;
     using DirectSubmissionController::directSubmissionsMutex;
     using DirectSubmissionController::keepControlling;
+    using DirectSubmissionController::maxTimeout;
+    using DirectSubmissionController::nextCheckTime;
+    using DirectSubmissionController::runControlling;
+    using DirectSubmissionController::statistics;
+    using DirectSubmissionController::stopControlling;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
 
     void sleep() override {
-        DirectSubmissionController::sleep();
         this->sleepCalled = true;
+        DirectSubmissionController::sleep();
+    }
+
+    uint64_t getCurrentTimeUs() override {
+        if (callBaseGetCurrentTimeUs) {
+            return DirectSubmissionController::getCurrentTimeUs();
+        }
+        return currentTime;
     }
 
-    bool sleepCalled = false;
+    std::atomic_bool sleepCalled = false;
+    bool callBaseGetCurrentTimeUs = true;
+    uint64_t currentTime = 0u;
 };
 } // namespace NEO
\ No newline at end of file
@@ -46,9 +46,11 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     csr.taskCount.store(5u);
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
+    controller.stopControlling();
     controller.directSubmissionControllingThread->join();
     controller.directSubmissionControllingThread.reset();
+    controller.callBaseGetCurrentTimeUs = false;
+    controller.currentTime = 1000u;
     controller.registerDirectSubmission(&csr);
 
     controller.checkNewSubmissions();
@@ -60,6 +62,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
 
+    controller.currentTime += controller.timeout;
     controller.checkNewSubmissions();
     EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
@@ -76,6 +79,140 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     controller.unregisterDirectSubmission(&csr);
 }
 
+TEST(DirectSubmissionControllerTests, givenRingRestartedAfterShortIdleGapWhenCheckingSubmissionsThenIdleTimeoutIsExtendedToBridgeTheGap) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::Regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.directSubmissionControllingThread->join();
+    controller.directSubmissionControllingThread.reset();
+    controller.callBaseGetCurrentTimeUs = false;
+    controller.currentTime = 1000u;
+    controller.registerDirectSubmission(&csr);
+
+    csr.taskCount.store(1u);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(1000u + controller.timeout, controller.nextCheckTime);
+
+    controller.currentTime += controller.timeout;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(0u, controller.nextCheckTime);
+
+    controller.currentTime += 3000u;
+    csr.taskCount.store(2u);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(12000u, controller.directSubmissions[&csr].idleTimeout);
+    EXPECT_EQ(controller.currentTime + 12000u, controller.nextCheckTime);
+
+    controller.currentTime += 8000u;
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+
+    controller.currentTime += 4000u;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    auto statistics = controller.getStatistics();
+    EXPECT_EQ(2u, statistics.ringStarts);
+    EXPECT_EQ(2u, statistics.ringStops);
+    EXPECT_EQ(static_cast<uint64_t>(controller.timeout) + 12000u, statistics.ringIdleTime);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenRingRestartedAfterIdleGapLongerThanMaxTimeoutWhenCheckingSubmissionsThenBaseTimeoutIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionControllerMaxTimeout.set(20000);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::Regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    EXPECT_EQ(20000, controller.maxTimeout);
+    controller.stopControlling();
+    controller.directSubmissionControllingThread->join();
+    controller.directSubmissionControllingThread.reset();
+    controller.callBaseGetCurrentTimeUs = false;
+    controller.currentTime = 1000u;
+    controller.registerDirectSubmission(&csr);
+
+    csr.taskCount.store(1u);
+    controller.checkNewSubmissions();
+    controller.currentTime += controller.timeout;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    controller.currentTime += 15000u;
+    csr.taskCount.store(2u);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(0u, controller.directSubmissions[&csr].idleTimeout);
+
+    controller.currentTime += controller.timeout;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenCoalescingWindowWhenCheckingRunningRingThenNextCheckIsDueWithinWindow) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionCoalescingWindow.set(100);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::Regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+    csr.taskCount.store(5u);
+
+    DirectSubmissionControllerMock controller;
+    EXPECT_EQ(100u, controller.coalescingWindow);
+    EXPECT_FALSE(controller.isControlling());
+    controller.stopControlling();
+    controller.directSubmissionControllingThread->join();
+    controller.directSubmissionControllingThread.reset();
+    controller.callBaseGetCurrentTimeUs = false;
+    controller.currentTime = 1000u;
+    controller.registerDirectSubmission(&csr);
+
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.currentTime + 100u, controller.nextCheckTime);
+
+    controller.currentTime += 100u;
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.currentTime + 100u, controller.nextCheckTime);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenTimeoutThenDirectSubmissionsAreChecked) {
     MockExecutionEnvironment executionEnvironment;
     executionEnvironment.prepareRootDeviceEnvironments(1);
@@ -117,7 +254,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWithStarted
 
     while (!controller.sleepCalled) {
     }
-    controller.keepControlling.store(false);
+    controller.stopControlling();
     controller.directSubmissionControllingThread->join();
     controller.directSubmissionControllingThread.reset();
 }
@@ -128,7 +265,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWithNotStar
 
     while (!controller.sleepCalled) {
     }
-    controller.keepControlling.store(false);
+    controller.stopControlling();
     controller.directSubmissionControllingThread->join();
     controller.directSubmissionControllingThread.reset();
 }
@@ -170,7 +307,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     csr4.setupContext(*osContext4.get());
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
+    controller.stopControlling();
     controller.directSubmissionControllingThread->join();
     controller.directSubmissionControllingThread.reset();
 
@@ -274,7 +411,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     csr10.setupContext(*osContext10.get());
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
+    controller.stopControlling();
     controller.directSubmissionControllingThread->join();
     controller.directSubmissionControllingThread.reset();
 
@@ -357,7 +494,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerDirectSubmi
     csr4.setupContext(*osContext4.get());
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
+    controller.stopControlling();
     controller.directSubmissionControllingThread->join();
     controller.directSubmissionControllingThread.reset();
 
@@ -385,4 +522,21 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerDirectSubmi
     controller.unregisterDirectSubmission(&csr4);
 }
 
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerPrintStatisticsWhenControllerIsDestroyedThenStatisticsArePrintedToStderr) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionControllerPrintStatistics.set(true);
+
+    auto controller = std::make_unique<DirectSubmissionControllerMock>();
+    controller->statistics.ringStarts = 3u;
+    controller->statistics.ringStops = 2u;
+    controller->statistics.ringIdleTime = 5000u;
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    controller.reset();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+    std::string output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("Direct submission controller: ring starts: 3, ring stops: 2, ring idle time: 5000 us\n", output.c_str());
+}
+
 } // namespace NEO
\ No newline at end of file
@@ -281,6 +281,83 @@ HWTEST_F(DirectSubmissionTest, givenDirectSubmissionCurrentRingBuffersInUseWhenS
     pDevice->getRootDeviceEnvironmentRef().memoryOperationsInterface.release();
 }
 
+HWTEST_F(DirectSubmissionTest, givenMaxRingBuffersReachedWhenSwitchRingBufferToBusyRingThenReuseStallIsCounted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(2u);
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+    directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(0u, directSubmission.getRingBufferReuseStallsCount());
+
+    directSubmission.isCompletedReturn = false;
+    directSubmission.switchRingBuffersAllocations();
+    directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(2u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(2u, directSubmission.getRingBufferReuseStallsCount());
+}
+
+HWTEST_F(DirectSubmissionTest, givenPrintRingBufferStatisticsWhenDeallocatingResourcesThenRingBufferCountAndReuseStallsArePrintedToStderr) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(2u);
+    DebugManager.flags.DirectSubmissionPrintRingBufferStatistics.set(true);
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+    directSubmission.isCompletedReturn = false;
+    directSubmission.switchRingBuffersAllocations();
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    directSubmission.deallocateResources();
+    auto stdoutOutput = testing::internal::GetCapturedStdout();
+    auto stderrOutput = testing::internal::GetCapturedStderr();
+    DebugManager.flags.DirectSubmissionPrintRingBufferStatistics.set(false);
+
+    EXPECT_TRUE(stdoutOutput.empty());
+    EXPECT_NE(std::string::npos, stderrOutput.find("Ring buffers: 2, submissions stalled on ring buffer reuse: 1"));
+}
+
+HWTEST_F(DirectSubmissionTest, givenAdditionalRingBuffersWhenReleasingIdleRingBuffersThenOnlyCompletedNotCurrentRingsAboveInitialCountAreFreed) {
+    auto mockMemoryOperations = std::make_unique<MockMemoryOperations>();
+    pDevice->getRootDeviceEnvironmentRef().memoryOperationsInterface.reset(mockMemoryOperations.get());
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+    directSubmission.isCompletedReturn = false;
+    directSubmission.switchRingBuffersAllocations();
+    directSubmission.switchRingBuffersAllocations();
+    directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(5u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(4u, directSubmission.currentRingBuffer);
+
+    directSubmission.releaseIdleRingBuffers();
+    EXPECT_EQ(5u, directSubmission.ringBuffers.size());
+
+    directSubmission.isCompletedReturn = true;
+    directSubmission.currentRingBuffer = 3u;
+    auto currentRing = directSubmission.ringBuffers[3].ringBuffer;
+    directSubmission.releaseIdleRingBuffers();
+    EXPECT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(2u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(currentRing, directSubmission.ringBuffers[2].ringBuffer);
+    EXPECT_EQ(2u, mockMemoryOperations->evictCalledCount);
+
+    pDevice->getRootDeviceEnvironmentRef().memoryOperationsInterface.release();
+}
+
+HWTEST_F(DirectSubmissionTest, givenRingBufferSizeDebugFlagsSetWhenAllocatingResourcesThenRingBuffersHaveRequestedSize) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionRenderRingBufferSize.set(128);
+    DebugManager.flags.DirectSubmissionComputeRingBufferSize.set(128);
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(128 * MemoryConstants::kiloByte, directSubmission.ringBufferSize);
+
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+    EXPECT_EQ(128 * MemoryConstants::kiloByte, directSubmission.ringCommandStream.getMaxAvailableSpace());
+    EXPECT_LE(128 * MemoryConstants::kiloByte, directSubmission.ringBuffers[0].ringBuffer->getUnderlyingBufferSize());
+}
+
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionAllocateFailWhenRingIsStartedThenExpectRingNotStarted) {
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
     EXPECT_TRUE(directSubmission.disableCpuCacheFlush);
@@ -982,8 +1059,8 @@ HWTEST_F(DirectSubmissionTest,
     EXPECT_TRUE(directSubmission.ringStart);
     EXPECT_EQ(0u, directSubmission.disabledDiagnosticCalled);
     EXPECT_EQ(1u, NEO::IoFunctions::mockFopenCalled);
-    //1 - preamble, 1 - init time, 0 exec logs in mode 2
-    EXPECT_EQ(2u, NEO::IoFunctions::mockVfptrinfCalled);
+    //1 - preamble, 1 - init time, 1 - dispatch cost, 0 exec logs in mode 2
+    EXPECT_EQ(3u, NEO::IoFunctions::mockVfptrinfCalled);
     EXPECT_EQ(1u, NEO::IoFunctions::mockFcloseCalled);
     EXPECT_EQ(expectedSize, directSubmission.ringCommandStream.getUsed());
     EXPECT_EQ(expectedSemaphoreValue, directSubmission.currentQueueWorkCount);
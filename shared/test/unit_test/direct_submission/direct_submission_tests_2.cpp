@@ -22,6 +22,7 @@
 #include "shared/test/common/mocks/mock_direct_submission_hw.h"
 #include "shared/test/common/mocks/mock_io_functions.h"
 #include "shared/test/common/test_macros/hw_test.h"
+#include "shared/test/unit_test/direct_submission/direct_submission_controller_mock.h"
 #include "shared/test/unit_test/fixtures/direct_submission_fixture.h"
 #include "shared/test/unit_test/mocks/mock_direct_submission_diagnostic_collector.h"
 
@@ -901,4 +902,148 @@ HWTEST_F(DirectSubmissionDispatchBufferTest, givenDebugFlagSetWhenStoppingRingbu
 
         EXPECT_EQ(initialCounterValue + expectedCount, CpuIntrinsicsTests::sfenceCounter);
     }
-}
\ No newline at end of file
+}
+
+struct DirectSubmissionCoalescingTest : public DirectSubmissionDispatchBufferTest {
+    void SetUp() override {
+        DebugManager.flags.DirectSubmissionCoalescingWindow.set(10000000);
+        DirectSubmissionDispatchBufferTest::SetUp();
+
+        controller = std::make_unique<DirectSubmissionControllerMock>();
+        controller->stopControlling();
+        controller->directSubmissionControllingThread->join();
+        controller->directSubmissionControllingThread.reset();
+        controller->keepControlling.store(true);
+        controller->runControlling.store(true);
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<DirectSubmissionControllerMock> controller;
+};
+
+HWTEST_F(DirectSubmissionCoalescingTest, givenCoalescingWindowSetWhenDispatchingWithinWindowThenSemaphoreIsReleasedOnlyWhenPendingSubmissionsAreReleased) {
+    using Dispatcher = BlitterDispatcher<FamilyType>;
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    directSubmission.directSubmissionController = controller.get();
+    EXPECT_EQ(std::chrono::microseconds(10000000), directSubmission.coalescingWindow);
+    EXPECT_EQ(4 * MemoryConstants::kiloByte, directSubmission.coalescingMaxBytes);
+    EXPECT_TRUE(directSubmission.initialize(true, true));
+
+    uint32_t releasedQueueWorkCount = directSubmission.currentQueueWorkCount;
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(releasedQueueWorkCount, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_FALSE(directSubmission.hasPendingSubmissions());
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(releasedQueueWorkCount, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_TRUE(directSubmission.hasPendingSubmissions());
+
+    directSubmission.releasePendingSubmissions();
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_FALSE(directSubmission.hasPendingSubmissions());
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.hasPendingSubmissions());
+    EXPECT_TRUE(directSubmission.stopRingBuffer());
+    EXPECT_EQ(directSubmission.currentQueueWorkCount, directSubmission.semaphoreData->QueueWorkCount);
+    EXPECT_FALSE(directSubmission.hasPendingSubmissions());
+}
+
+HWTEST_F(DirectSubmissionCoalescingTest, givenCoalescingMaxBytesExceededWhenDispatchingWithinWindowThenSemaphoreIsReleased) {
+    DebugManager.flags.DirectSubmissionCoalescingMaxBytes.set(1);
+
+    using Dispatcher = BlitterDispatcher<FamilyType>;
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    directSubmission.directSubmissionController = controller.get();
+    EXPECT_EQ(1u, directSubmission.coalescingMaxBytes);
+    EXPECT_TRUE(directSubmission.initialize(true, true));
+
+    for (uint32_t dispatch = 0u; dispatch < 3u; dispatch++) {
+        uint32_t releasedQueueWorkCount = directSubmission.currentQueueWorkCount;
+        EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+        EXPECT_EQ(releasedQueueWorkCount, directSubmission.semaphoreData->QueueWorkCount);
+        EXPECT_FALSE(directSubmission.hasPendingSubmissions());
+    }
+}
+
+HWTEST_F(DirectSubmissionCoalescingTest, givenCoalescingWindowSetAndNoRunningControllerWhenDispatchingWithinWindowThenSemaphoreIsReleased) {
+    using Dispatcher = BlitterDispatcher<FamilyType>;
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(true, true));
+
+    auto expectEveryDispatchReleased = [&]() {
+        for (uint32_t dispatch = 0u; dispatch < 3u; dispatch++) {
+            uint32_t releasedQueueWorkCount = directSubmission.currentQueueWorkCount;
+            EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+            EXPECT_EQ(releasedQueueWorkCount, directSubmission.semaphoreData->QueueWorkCount);
+            EXPECT_FALSE(directSubmission.hasPendingSubmissions());
+        }
+    };
+
+    directSubmission.directSubmissionController = nullptr;
+    expectEveryDispatchReleased();
+
+    directSubmission.directSubmissionController = controller.get();
+    controller->runControlling.store(false);
+    expectEveryDispatchReleased();
+}
+
+HWTEST_F(DirectSubmissionCoalescingTest, givenPendingSubmissionsWhenCsrWaitsForCompletionThenPendingSubmissionsAreReleased) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    FlushStampTracker flushStamp(true);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(csr);
+    directSubmission.directSubmissionController = controller.get();
+    EXPECT_TRUE(directSubmission.initialize(true, true));
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.hasPendingSubmissions());
+
+    csr.directSubmission.reset(&directSubmission);
+    *csr.getTagAddress() = csr.peekTaskCount();
+    EXPECT_EQ(WaitStatus::Ready, csr.waitForCompletionWithTimeout(WaitParams{false, false, 0}, csr.peekTaskCount()));
+    EXPECT_FALSE(directSubmission.hasPendingSubmissions());
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, directSubmission.semaphoreData->QueueWorkCount);
+
+    csr.directSubmission.release();
+}
+
+HWTEST_F(DirectSubmissionCoalescingTest, givenPendingSubmissionsWhenControllerChecksRunningRingThenPendingSubmissionsAreReleased) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    FlushStampTracker flushStamp(true);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(csr);
+    directSubmission.directSubmissionController = controller.get();
+    EXPECT_TRUE(directSubmission.initialize(true, true));
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.hasPendingSubmissions());
+
+    csr.directSubmission.reset(&directSubmission);
+    controller->callBaseGetCurrentTimeUs = false;
+    controller->currentTime = 1000u;
+    controller->registerDirectSubmission(&csr);
+    auto &state = controller->directSubmissions[&csr];
+    state.isStopped = false;
+    state.taskCount = csr.peekTaskCount();
+    state.lastSubmissionTime = controller->currentTime;
+
+    controller->checkNewSubmissions();
+    EXPECT_FALSE(controller->directSubmissions[&csr].isStopped);
+    EXPECT_FALSE(directSubmission.hasPendingSubmissions());
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, directSubmission.semaphoreData->QueueWorkCount);
+
+    controller->unregisterDirectSubmission(&csr);
+    csr.directSubmission.release();
+}
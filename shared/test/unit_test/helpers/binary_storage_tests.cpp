@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/binary_storage.h"
+#include "shared/source/helpers/string.h"
+#include "shared/test/common/test_macros/test.h"
+
+using namespace NEO;
+
+namespace {
+uint32_t releaseCalled = 0u;
+size_t releasedSize = 0u;
+
+void mockRelease(char *ptr, size_t size) {
+    releaseCalled++;
+    releasedSize = size;
+    delete[] ptr;
+}
+} // namespace
+
+TEST(BinaryStorageTests, givenHeapAllocatedBinaryWhenMovedToUniqueBinaryPtrThenItIsNotMapped) {
+    const char data[] = "binary";
+    UniqueBinaryPtr binary = makeCopy(data, sizeof(data));
+
+    ASSERT_NE(nullptr, binary);
+    EXPECT_FALSE(binary.get_deleter().isMapped());
+    EXPECT_EQ(0, memcmp(data, binary.get(), sizeof(data)));
+}
+
+TEST(BinaryStorageTests, givenMappedBinaryWhenDestroyedThenReleaseFunctionIsCalledWithMappedSize) {
+    releaseCalled = 0u;
+    releasedSize = 0u;
+    {
+        UniqueBinaryPtr binary(new char[16], BinaryStorageDeleter(mockRelease, 16u));
+        EXPECT_TRUE(binary.get_deleter().isMapped());
+    }
+    EXPECT_EQ(1u, releaseCalled);
+    EXPECT_EQ(16u, releasedSize);
+}
+
+TEST(BinaryStorageTests, givenMappedBinaryWhenReplacedWithHeapBinaryThenMappingIsReleasedAndDeleterIsReset) {
+    releaseCalled = 0u;
+    UniqueBinaryPtr binary(new char[16], BinaryStorageDeleter(mockRelease, 16u));
+
+    binary = std::make_unique<char[]>(8);
+    EXPECT_EQ(1u, releaseCalled);
+    EXPECT_FALSE(binary.get_deleter().isMapped());
+}
+
+TEST(BinaryStorageTests, givenBinaryViewWhenDestroyedThenViewedStorageIsNotReleased) {
+    releaseCalled = 0u;
+    UniqueBinaryPtr binary(new char[16], BinaryStorageDeleter(mockRelease, 16u));
+    {
+        auto view = makeBinaryView(binary.get() + 4);
+        EXPECT_EQ(binary.get() + 4, view.get());
+        EXPECT_TRUE(view.get_deleter().isView());
+        EXPECT_FALSE(view.get_deleter().isMapped());
+    }
+    EXPECT_EQ(0u, releaseCalled);
+    EXPECT_FALSE(binary.get_deleter().isView());
+}
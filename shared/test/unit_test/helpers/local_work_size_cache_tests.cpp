@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/local_work_size_cache.h"
+#include "shared/test/common/test_macros/test.h"
+
+using namespace NEO;
+
+TEST(LocalWorkSizeCacheTest, givenStoredEntryWhenLookingUpSameKeyThenEntryIsReturnedAndHitIsCounted) {
+    LocalWorkSizeCache cache;
+    LocalWorkSizeCache::Key key{{1000, 6, 1}, 2u, 0u, 256u};
+    LocalWorkSizeCache::Entry entry;
+
+    EXPECT_FALSE(cache.find(key, entry));
+    auto storedEntry = cache.store(key, {8, 2, 1});
+    EXPECT_EQ(Vec3<size_t>(8, 2, 1), storedEntry.lws);
+
+    EXPECT_TRUE(cache.find(key, entry));
+    EXPECT_EQ(storedEntry.lws, entry.lws);
+
+    EXPECT_EQ(1u, cache.getStatistics().hits);
+    EXPECT_EQ(1u, cache.getStatistics().misses);
+}
+
+TEST(LocalWorkSizeCacheTest, givenStoredEntryWhenAnyKeyComponentDiffersThenEntryIsNotReturned) {
+    LocalWorkSizeCache cache;
+    LocalWorkSizeCache::Key key{{1024, 1, 1}, 1u, 0u, 256u};
+    LocalWorkSizeCache::Entry entry;
+    cache.store(key, {256, 1, 1});
+
+    EXPECT_FALSE(cache.find({{512, 1, 1}, 1u, 0u, 256u}, entry));
+    EXPECT_FALSE(cache.find({{1024, 1, 1}, 2u, 0u, 256u}, entry));
+    EXPECT_FALSE(cache.find({{1024, 1, 1}, 1u, 1024u, 256u}, entry));
+    EXPECT_FALSE(cache.find({{1024, 1, 1}, 1u, 0u, 128u}, entry));
+    EXPECT_EQ(4u, cache.getStatistics().misses);
+    EXPECT_EQ(0u, cache.getStatistics().hits);
+}
+
+TEST(LocalWorkSizeCacheTest, givenFullCacheWhenStoringNewEntryThenOldestEntryIsReplaced) {
+    LocalWorkSizeCache cache;
+    LocalWorkSizeCache::Entry entry;
+    for (size_t i = 0; i < LocalWorkSizeCache::maxEntries; i++) {
+        cache.store({{i + 1, 1, 1}, 1u, 0u, 256u}, {1, 1, 1});
+    }
+    EXPECT_EQ(LocalWorkSizeCache::maxEntries, cache.getEntriesCount());
+
+    cache.store({{LocalWorkSizeCache::maxEntries + 1, 1, 1}, 1u, 0u, 256u}, {1, 1, 1});
+    EXPECT_EQ(LocalWorkSizeCache::maxEntries, cache.getEntriesCount());
+    EXPECT_FALSE(cache.find({{1, 1, 1}, 1u, 0u, 256u}, entry));
+    EXPECT_TRUE(cache.find({{2, 1, 1}, 1u, 0u, 256u}, entry));
+    EXPECT_TRUE(cache.find({{LocalWorkSizeCache::maxEntries + 1, 1, 1}, 1u, 0u, 256u}, entry));
+}
+
+TEST(LocalWorkSizeCacheTest, givenCachedEntriesWhenInvalidatedThenCacheIsEmptyAndInvalidationIsCounted) {
+    LocalWorkSizeCache cache;
+    LocalWorkSizeCache::Entry entry;
+    cache.invalidate();
+    EXPECT_EQ(0u, cache.getStatistics().invalidations);
+
+    cache.store({{64, 1, 1}, 1u, 0u, 256u}, {64, 1, 1});
+    cache.invalidate();
+    EXPECT_EQ(0u, cache.getEntriesCount());
+    EXPECT_EQ(1u, cache.getStatistics().invalidations);
+    EXPECT_FALSE(cache.find({{64, 1, 1}, 1u, 0u, 256u}, entry));
+}
+
+TEST(LocalWorkSizeCacheTest, givenPrintingEnabledWhenPrintingStatisticsThenOutputGoesToStderr) {
+    LocalWorkSizeCache cache;
+    LocalWorkSizeCache::Entry entry;
+    testing::internal::CaptureStderr();
+    cache.printStatistics(true, "kernel");
+    EXPECT_TRUE(testing::internal::GetCapturedStderr().empty());
+
+    cache.find({{1024, 1, 1}, 1u, 0u, 256u}, entry);
+
+    testing::internal::CaptureStderr();
+    cache.printStatistics(false, "kernel");
+    EXPECT_TRUE(testing::internal::GetCapturedStderr().empty());
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    cache.printStatistics(true, "kernel");
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+    EXPECT_STREQ("Local work size cache of kernel kernel: hits: 0, misses: 1, invalidations: 0\n", testing::internal::GetCapturedStderr().c_str());
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/kernel/kernel_tuning_database.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <cstdio>
+
+using namespace NEO;
+
+TEST(KernelTuningDatabaseTest, givenStoredResultsWhenQueriedThenResultsAreReturnedOnlyForMatchingKeys) {
+    KernelTuningDatabase database("");
+    Vec3<size_t> gws{1024, 1, 1};
+    Vec3<size_t> lws{128, 1, 1};
+
+    Vec3<size_t> storedLws{0, 0, 0};
+    bool singleSubdevicePreferred = false;
+    EXPECT_FALSE(database.getWorkgroupSize(1u, gws, storedLws));
+    EXPECT_FALSE(database.getSingleSubdevicePreferred(1u, gws, lws, singleSubdevicePreferred));
+
+    database.storeWorkgroupSize(1u, gws, lws);
+    database.storeSingleSubdevicePreferred(1u, gws, lws, true);
+    EXPECT_EQ(2u, database.getEntriesCount());
+
+    EXPECT_TRUE(database.getWorkgroupSize(1u, gws, storedLws));
+    EXPECT_EQ(lws, storedLws);
+    EXPECT_TRUE(database.getSingleSubdevicePreferred(1u, gws, lws, singleSubdevicePreferred));
+    EXPECT_TRUE(singleSubdevicePreferred);
+
+    EXPECT_FALSE(database.getWorkgroupSize(2u, gws, storedLws));
+    EXPECT_FALSE(database.getWorkgroupSize(1u, {512, 1, 1}, storedLws));
+    EXPECT_FALSE(database.getSingleSubdevicePreferred(1u, gws, {64, 1, 1}, singleSubdevicePreferred));
+}
+
+TEST(KernelTuningDatabaseTest, givenSerializedDatabaseWhenDeserializedThenAllEntriesAreRestored) {
+    KernelTuningDatabase database("");
+    database.storeWorkgroupSize(0xabcdef0123456789u, {1024, 4, 1}, {64, 2, 1});
+    database.storeSingleSubdevicePreferred(0xabcdef0123456789u, {1024, 4, 1}, {64, 2, 1}, false);
+
+    KernelTuningDatabase restoredDatabase("");
+    restoredDatabase.deserialize(database.serialize(), true);
+    EXPECT_EQ(database.serialize(), restoredDatabase.serialize());
+
+    Vec3<size_t> storedLws{0, 0, 0};
+    bool singleSubdevicePreferred = true;
+    EXPECT_TRUE(restoredDatabase.getWorkgroupSize(0xabcdef0123456789u, {1024, 4, 1}, storedLws));
+    EXPECT_EQ(Vec3<size_t>(64, 2, 1), storedLws);
+    EXPECT_TRUE(restoredDatabase.getSingleSubdevicePreferred(0xabcdef0123456789u, {1024, 4, 1}, {64, 2, 1}, singleSubdevicePreferred));
+    EXPECT_FALSE(singleSubdevicePreferred);
+}
+
+TEST(KernelTuningDatabaseTest, givenMalformedLinesWhenDeserializingThenTheyAreIgnored) {
+    KernelTuningDatabase database("");
+    database.deserialize("# comment\n"
+                         "lws 1 1024 1 1\n"
+                         "lws 1 1024 1 1 0 1 1\n"
+                         "subdevice 1 1024 1 1 64 1 1\n"
+                         "unknown 1 1024 1 1 64 1 1\n"
+                         "lws 2 1024 1 1 64 1 1\n",
+                         true);
+    EXPECT_EQ(1u, database.getEntriesCount());
+
+    Vec3<size_t> storedLws{0, 0, 0};
+    EXPECT_TRUE(database.getWorkgroupSize(2u, {1024, 1, 1}, storedLws));
+    EXPECT_EQ(Vec3<size_t>(64, 1, 1), storedLws);
+}
+
+TEST(KernelTuningDatabaseTest, givenExistingEntryWhenDeserializingWithoutOverwriteThenLocalEntryIsPreserved) {
+    KernelTuningDatabase database("");
+    database.storeWorkgroupSize(1u, {1024, 1, 1}, {128, 1, 1});
+
+    database.deserialize("lws 1 1024 1 1 64 1 1\nlws 2 1024 1 1 32 1 1\n", false);
+
+    Vec3<size_t> storedLws{0, 0, 0};
+    EXPECT_TRUE(database.getWorkgroupSize(1u, {1024, 1, 1}, storedLws));
+    EXPECT_EQ(Vec3<size_t>(128, 1, 1), storedLws);
+    EXPECT_TRUE(database.getWorkgroupSize(2u, {1024, 1, 1}, storedLws));
+    EXPECT_EQ(Vec3<size_t>(32, 1, 1), storedLws);
+
+    database.deserialize("lws 1 1024 1 1 64 1 1\n", true);
+    EXPECT_TRUE(database.getWorkgroupSize(1u, {1024, 1, 1}, storedLws));
+    EXPECT_EQ(Vec3<size_t>(64, 1, 1), storedLws);
+}
+
+TEST(KernelTuningDatabaseTest, givenEmptyFilePathWhenSavingThenNothingIsWritten) {
+    KernelTuningDatabase database("");
+    database.storeWorkgroupSize(1u, {1024, 1, 1}, {128, 1, 1});
+    EXPECT_FALSE(database.save());
+    EXPECT_FALSE(database.load());
+}
+
+TEST(KernelTuningDatabaseTest, givenFilePathWhenDatabaseIsDestroyedThenResultsAreMergedWithFileAndLoadedByNextInstance) {
+    std::string fileName("kernel_tuning_test.db");
+    std::remove(fileName.c_str());
+
+    {
+        KernelTuningDatabase database(fileName);
+        EXPECT_FALSE(database.save());
+        database.storeWorkgroupSize(1u, {1024, 1, 1}, {128, 1, 1});
+    }
+    EXPECT_TRUE(fileExistsHasSize(fileName));
+
+    {
+        KernelTuningDatabase database(fileName);
+        EXPECT_EQ(1u, database.getEntriesCount());
+        database.storeSingleSubdevicePreferred(1u, {1024, 1, 1}, {128, 1, 1}, true);
+    }
+
+    KernelTuningDatabase database(fileName);
+    EXPECT_EQ(2u, database.getEntriesCount());
+    Vec3<size_t> storedLws{0, 0, 0};
+    bool singleSubdevicePreferred = false;
+    EXPECT_TRUE(database.getWorkgroupSize(1u, {1024, 1, 1}, storedLws));
+    EXPECT_EQ(Vec3<size_t>(128, 1, 1), storedLws);
+    EXPECT_TRUE(database.getSingleSubdevicePreferred(1u, {1024, 1, 1}, {128, 1, 1}, singleSubdevicePreferred));
+    EXPECT_TRUE(singleSubdevicePreferred);
+
+    std::remove(fileName.c_str());
+}
+
+TEST(KernelTuningDatabaseTest, givenDifferentKernelsOrDevicesWhenComputingKernelHashThenHashesDiffer) {
+    HardwareInfo hwInfo = {};
+    KernelInfo kernelInfo;
+    kernelInfo.kernelDescriptor.kernelMetadata.kernelName = "kernel";
+    char isa[] = {1, 2, 3, 4};
+    kernelInfo.heapInfo.pKernelHeap = isa;
+    kernelInfo.heapInfo.KernelHeapSize = sizeof(isa);
+
+    auto hash = KernelTuningDatabase::computeKernelHash(kernelInfo, hwInfo);
+    EXPECT_EQ(hash, KernelTuningDatabase::computeKernelHash(kernelInfo, hwInfo));
+
+    isa[0] = 5;
+    auto hashWithDifferentIsa = KernelTuningDatabase::computeKernelHash(kernelInfo, hwInfo);
+    EXPECT_NE(hash, hashWithDifferentIsa);
+
+    hwInfo.platform.usDeviceID += 1;
+    EXPECT_NE(hashWithDifferentIsa, KernelTuningDatabase::computeKernelHash(kernelInfo, hwInfo));
+}
@@ -58,24 +58,17 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDeviceA
         ASSERT_NE(testData.allocation, nullptr);
     }
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), ++expectedCacheSize);
-        bool foundInCache = false;
-        for (auto i = 0u; i < svmManager->usmDeviceAllocationsCache.allocations.size(); ++i) {
-            if (svmManager->usmDeviceAllocationsCache.allocations[i].allocation == testData.allocation) {
-                foundInCache = true;
-                break;
-            }
-        }
-        EXPECT_TRUE(foundInCache);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), ++expectedCacheSize);
+        EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(testData.allocation));
     }
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocatingAfterFreeThenReturnCorrectCachedAllocation) {
@@ -107,26 +100,26 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocat
     }
 
     size_t expectedCacheSize = 0u;
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
     std::vector<void *> allocationsToFree;
 
     for (auto &testData : testDataset) {
         auto secondAllocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, unifiedMemoryProperties);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size() - 1);
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size() - 1);
         EXPECT_EQ(secondAllocation, testData.allocation);
         svmManager->freeSVMAlloc(secondAllocation);
-        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+        EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
     }
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFreeThenReturnAllocationsInCacheStartingFromSmallest) {
@@ -154,29 +147,29 @@ TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
     size_t expectedCacheSize = testDataset.size();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto allocationLargerThanInCache = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), expectedCacheSize);
 
     auto firstAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(firstAllocation, testDataset[0].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto secondAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(secondAllocation, testDataset[1].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
     EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -184,7 +177,7 @@ TEST(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
     svmManager->freeSVMAlloc(allocationLargerThanInCache);
 
     svmManager->trimUSMDeviceAllocCache();
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 struct SvmDeviceAllocationCacheTestDataType {
@@ -253,12 +246,12 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         for (auto &testData : testDataset) {
             testData.allocation = svmManager->createUnifiedMemoryAllocation(testData.allocationSize, testData.unifiedMemoryProperties);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
         for (auto &testData : testDataset) {
             svmManager->freeSVMAlloc(testData.allocation);
         }
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
 
         auto allocationFromCache = svmManager->createUnifiedMemoryAllocation(allocationDataToVerify.allocationSize, allocationDataToVerify.unifiedMemoryProperties);
         EXPECT_EQ(allocationFromCache, allocationDataToVerify.allocation);
@@ -271,7 +264,7 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentFlagsWhenAllocat
         svmManager->freeSVMAlloc(allocationNotFromCache);
 
         svmManager->trimUSMDeviceAllocCache();
-        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+        ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     }
 }
 
@@ -294,20 +287,20 @@ TEST(SvmDeviceAllocationCacheTest, givenDeviceOutOfMemoryWhenAllocatingThenCache
 
     auto allocationInCache = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
     auto allocationInCache2 = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(allocationInCache);
     svmManager->freeSVMAlloc(allocationInCache2);
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 2u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 2u);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache), nullptr);
     ASSERT_NE(svmManager->getSVMAlloc(allocationInCache2), nullptr);
     auto ptr = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
     EXPECT_NE(ptr, nullptr);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
     svmManager->freeSVMAlloc(ptr);
 
     svmManager->trimUSMDeviceAllocCache();
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 }
 
 TEST(SvmDeviceAllocationCacheTest, givenCachedAllocationsWhenDestructorIsCalledThenCacheAllocationsAreFreed) {
@@ -336,14 +329,184 @@ TEST(SvmDeviceAllocationCacheTest, givenCachedAllocationsWhenDestructorIsCalledT
         ASSERT_NE(testData.allocation, nullptr);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
 
     for (auto const &testData : testDataset) {
         svmManager->freeSVMAlloc(testData.allocation);
     }
 
-    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), testDataset.size());
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), testDataset.size());
     ASSERT_EQ(memoryManager->freeGraphicsMemoryCalled, 0u);
     svmManager.reset();
     EXPECT_EQ(memoryManager->freeGraphicsMemoryCalled, testDataset.size());
-}
\ No newline at end of file
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenHostAllocationCacheEnabledWhenAllocatingAfterFreeThenReturnCachedHostAllocation) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableHostAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto memoryManager = std::make_unique<MockMemoryManager>(false, device->getExecutionEnvironment());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get(), false);
+    ASSERT_TRUE(svmManager->usmHostAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto allocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(allocation, nullptr);
+
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 1u);
+    EXPECT_TRUE(svmManager->usmHostAllocationsCache.isInCache(allocation));
+    EXPECT_EQ(memoryManager->freeGraphicsMemoryCalled, 0u);
+
+    auto allocationFromCache = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k / 2, unifiedMemoryProperties);
+    EXPECT_EQ(allocationFromCache, allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getStatistics().hits, 1u);
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->trimUSMAllocCaches();
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.getNumAllocations(), 0u);
+    EXPECT_EQ(memoryManager->freeGraphicsMemoryCalled, 1u);
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenSharedAllocationCacheEnabledWhenAllocatingAfterFreeThenReturnCachedSharedAllocation) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableSharedAllocationCache.set(1);
+    DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.set(0);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmSharedAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(allocation, nullptr);
+
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_TRUE(svmManager->usmSharedAllocationsCache.isInCache(allocation));
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+
+    auto allocationFromCache = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties, nullptr);
+    EXPECT_EQ(allocationFromCache, allocation);
+    EXPECT_EQ(svmManager->usmSharedAllocationsCache.getNumAllocations(), 0u);
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->trimUSMSharedAllocCache();
+    EXPECT_EQ(svmManager->usmSharedAllocationsCache.getNumAllocations(), 0u);
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenCacheMaxSizeReachedWhenFreeingDeviceAllocationThenAllocationIsFreedInsteadOfCached) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    DebugManager.flags.USMAllocationCacheMaxSize.set(MemoryConstants::pageSize64k);
+    auto device = deviceFactory->rootDevices[0];
+    auto memoryManager = std::make_unique<MockMemoryManager>(true, device->getExecutionEnvironment());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto firstAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto secondAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+
+    svmManager->freeSVMAlloc(firstAllocation);
+    svmManager->freeSVMAlloc(secondAllocation);
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(firstAllocation));
+    EXPECT_FALSE(svmManager->usmDeviceAllocationsCache.isInCache(secondAllocation));
+    EXPECT_EQ(svmManager->getSVMAlloc(secondAllocation), nullptr);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getStatistics().rejectedInserts, 1u);
+    EXPECT_EQ(memoryManager->freeGraphicsMemoryCalled, 1u);
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenLocalMemoryUsageAboveTrimThresholdWhenAllocationIsNotFoundInCacheThenCacheIsTrimmed) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    DebugManager.flags.USMAllocationCacheTrimThreshold.set(50);
+    auto device = deviceFactory->rootDevices[0];
+    auto memoryManager = std::make_unique<MockMemoryManager>(true, device->getExecutionEnvironment());
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 1u);
+
+    auto bankSelector = memoryManager->getLocalMemoryUsageBankSelector(AllocationType::BUFFER, mockRootDeviceIndex);
+    auto localMemorySize = memoryManager->getLocalMemorySize(mockRootDeviceIndex, static_cast<uint32_t>(mockDeviceBitfield.to_ulong()));
+    bankSelector->reserveOnBanks(static_cast<uint32_t>(mockDeviceBitfield.to_ulong()), localMemorySize);
+
+    auto largerAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
+    EXPECT_NE(largerAllocation, nullptr);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getNumAllocations(), 0u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.getStatistics().trims, 1u);
+
+    bankSelector->freeOnBanks(static_cast<uint32_t>(mockDeviceBitfield.to_ulong()), localMemorySize);
+    svmManager->freeSVMAlloc(largerAllocation);
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenPrintUSMAllocationCacheStatisticsWhenSvmManagerIsDestroyedThenStatisticsArePrinted) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    DebugManager.flags.PrintUSMAllocationCacheStatistics.set(true);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+    allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(allocation);
+
+    testing::internal::CaptureStderr();
+    svmManager.reset();
+    auto output = testing::internal::GetCapturedStderr();
+    EXPECT_NE(std::string::npos, output.find("USM device allocation cache: hits: 1, misses: 1, hit rate: 50.00%, rejected inserts: 0, trims: 0"));
+}
+
+TEST(SvmDeviceAllocationCacheTest, givenCachedAllocationMoreThanFourTimesBiggerThanRequestedWhenAllocatingThenItIsNotReused) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    constexpr auto allocationSizeBasis = MemoryConstants::pageSize64k;
+    auto bigAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis << 3, unifiedMemoryProperties);
+    ASSERT_NE(bigAllocation, nullptr);
+    svmManager->freeSVMAlloc(bigAllocation);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(bigAllocation));
+
+    auto smallAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
+    EXPECT_NE(smallAllocation, bigAllocation);
+    EXPECT_TRUE(svmManager->usmDeviceAllocationsCache.isInCache(bigAllocation));
+
+    auto allocationFromCache = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis << 1, unifiedMemoryProperties);
+    EXPECT_EQ(allocationFromCache, bigAllocation);
+
+    svmManager->freeSVMAlloc(smallAllocation);
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->trimUSMDeviceAllocCache();
+}
@@ -2693,6 +2693,38 @@ TEST_F(DrmMemoryManagerBasic, givenDrmMemoryManagerWhenAllocateGraphicsMemoryFor
     EXPECT_EQ(memoryManager->getSysMemAllocs().size(), 0u);
 }
 
+TEST_F(DrmMemoryManagerBasic, givenRegisteredAllocationsWhenUnregisteringFromMiddleThenLastAllocationTakesFreedSlot) {
+    std::unique_ptr<TestedDrmMemoryManager> memoryManager(new (std::nothrow) TestedDrmMemoryManager(false, false, false, executionEnvironment));
+    std::vector<std::unique_ptr<DrmAllocation>> allocations;
+    for (auto i = 0u; i < 4u; i++) {
+        allocations.push_back(std::make_unique<DrmAllocation>(0u, AllocationType::BUFFER, nullptr, nullptr, MemoryConstants::pageSize, static_cast<osHandle>(0u), MemoryPool::System4KBPages, 0u));
+    }
+    memoryManager->registerSysMemAlloc(allocations[0].get());
+    memoryManager->registerSysMemAlloc(allocations[1].get());
+    memoryManager->registerSysMemAlloc(allocations[2].get());
+    memoryManager->registerLocalMemAlloc(allocations[3].get(), 0u);
+    EXPECT_EQ(1u, allocations[1]->getRegistrationIndex());
+    EXPECT_EQ(0u, allocations[3]->getRegistrationIndex());
+
+    memoryManager->unregisterAllocation(allocations[0].get());
+    ASSERT_EQ(2u, memoryManager->getSysMemAllocs().size());
+    EXPECT_EQ(allocations[2].get(), memoryManager->getSysMemAllocs()[0]);
+    EXPECT_EQ(0u, allocations[2]->getRegistrationIndex());
+    EXPECT_EQ(allocations[1].get(), memoryManager->getSysMemAllocs()[1]);
+    EXPECT_EQ(std::numeric_limits<size_t>::max(), allocations[0]->getRegistrationIndex());
+
+    memoryManager->unregisterAllocation(allocations[0].get());
+    EXPECT_EQ(2u, memoryManager->getSysMemAllocs().size());
+
+    memoryManager->unregisterAllocation(allocations[3].get());
+    EXPECT_EQ(0u, memoryManager->getLocalMemAllocs(0u).size());
+    EXPECT_EQ(2u, memoryManager->getSysMemAllocs().size());
+
+    memoryManager->unregisterAllocation(allocations[1].get());
+    memoryManager->unregisterAllocation(allocations[2].get());
+    EXPECT_EQ(0u, memoryManager->getSysMemAllocs().size());
+}
+
 TEST_F(DrmMemoryManagerTest, givenDrmMemoryManagerWhenAllocateGraphicsMemoryForNonSvmHostPtrIsCalledWithHostPtrIsPassedAndWhenAllocUserptrFailsThenFails) {
     memoryManager->forceLimitedRangeAllocator(0xFFFFFFFFF);
 
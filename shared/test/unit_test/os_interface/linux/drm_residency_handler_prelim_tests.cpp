@@ -41,11 +41,13 @@ struct MockDrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandlerBin
 
     bool useBaseEvictUnused = true;
     uint32_t evictUnusedCalled = 0;
+    std::vector<std::pair<size_t, uint32_t>> evictUnusedRequests;
 
-    MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) override {
+    MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded, size_t bytesRequired, uint32_t vmHandleId) override {
         evictUnusedCalled++;
+        evictUnusedRequests.push_back({bytesRequired, vmHandleId});
         if (useBaseEvictUnused) {
-            return DrmMemoryOperationsHandlerBind::evictUnusedAllocations(waitForCompletion, isLockNeeded);
+            return DrmMemoryOperationsHandlerBind::evictUnusedAllocations(waitForCompletion, isLockNeeded, bytesRequired, vmHandleId);
         }
 
         return MemoryOperationsStatus::SUCCESS;
@@ -162,7 +164,11 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenNoSpaceLeftOnDeviceThenEvictUnuse
 
     EXPECT_EQ(operationHandler->evictUnusedCalled, 0u);
     operationHandler->makeResident(device, ArrayRef<GraphicsAllocation *>(&allocation, 1));
-    EXPECT_EQ(operationHandler->evictUnusedCalled, 1u);
+    // least recently used allocations first, then all unused ones
+    EXPECT_EQ(operationHandler->evictUnusedCalled, 2u);
+    EXPECT_EQ(operationHandler->evictUnusedRequests[0].first, static_cast<DrmAllocation *>(allocation)->getBO()->peekSize());
+    EXPECT_EQ(operationHandler->evictUnusedRequests[0].second, 0u);
+    EXPECT_EQ(operationHandler->evictUnusedRequests[1].first, 0u);
 
     memoryManager->freeGraphicsMemory(allocation);
 }
@@ -187,7 +193,7 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, givenObjectAlwaysResidentAndNotUsedWh
     }
 
     EXPECT_EQ(mock->context.vmBindCalled, 2u);
-    operationHandler->evictUnusedAllocations(false, true);
+    operationHandler->evictUnusedAllocations(false, true, 0u, 0u);
 
     EXPECT_EQ(mock->context.vmBindCalled, 2u);
     EXPECT_EQ(mock->context.vmUnbindCalled, 1u);
@@ -256,7 +262,7 @@ HWTEST_F(DrmMemoryOperationsHandlerBindTest, whenEvictUnusedResourcesWithWaitFor
     auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
     csr.latestWaitForCompletionWithTimeoutTaskCount.store(123u);
 
-    const auto status = operationHandler->evictUnusedAllocations(true, true);
+    const auto status = operationHandler->evictUnusedAllocations(true, true, 0u, 0u);
     EXPECT_EQ(MemoryOperationsStatus::SUCCESS, status);
 
     auto latestWaitTaskCount = csr.latestWaitForCompletionWithTimeoutTaskCount.load();
@@ -272,7 +278,7 @@ HWTEST_F(DrmMemoryOperationsHandlerBindTest, givenGpuHangWhenEvictUnusedResource
     csr.callBaseWaitForCompletionWithTimeout = false;
     csr.returnWaitForCompletionWithTimeout = WaitStatus::GpuHang;
 
-    const auto status = operationHandler->evictUnusedAllocations(true, true);
+    const auto status = operationHandler->evictUnusedAllocations(true, true, 0u, 0u);
     EXPECT_EQ(MemoryOperationsStatus::GPU_HANG_DETECTED_DURING_OPERATION, status);
 
     memoryManager->freeGraphicsMemory(allocation);
@@ -300,7 +306,7 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenRunningOutOfMemoryThenUnusedAlloc
 
     EXPECT_EQ(mock->context.vmBindCalled, 2u);
 
-    operationHandler->evictUnusedAllocations(false, true);
+    operationHandler->evictUnusedAllocations(false, true, 0u, 0u);
 
     EXPECT_EQ(mock->context.vmBindCalled, 2u);
     EXPECT_EQ(mock->context.vmUnbindCalled, 1u);
@@ -329,7 +335,7 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, givenUsedAllocationInBothSubdevicesWh
 
     EXPECT_EQ(mock->context.vmBindCalled, 2u);
 
-    operationHandler->evictUnusedAllocations(false, true);
+    operationHandler->evictUnusedAllocations(false, true, 0u, 0u);
 
     EXPECT_EQ(mock->context.vmBindCalled, 2u);
     EXPECT_EQ(mock->context.vmUnbindCalled, 0u);
@@ -337,6 +343,48 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, givenUsedAllocationInBothSubdevicesWh
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenBytesRequiredWhenEvictUnusedThenLeastRecentlyUsedAllocationsAreUnboundUntilRequestIsSatisfied) {
+    GraphicsAllocation *allocations[3] = {};
+    uint32_t lastUsedTaskCounts[3] = {9u, 3u, 6u};
+    for (auto i = 0u; i < 3u; i++) {
+        allocations[i] = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+        for (auto &engine : device->getAllEngines()) {
+            *engine.commandStreamReceiver->getTagAddress() = 10;
+            allocations[i]->updateTaskCount(lastUsedTaskCounts[i], engine.osContext->getContextId());
+            EXPECT_EQ(operationHandler->makeResidentWithinOsContext(engine.osContext, ArrayRef<GraphicsAllocation *>(&allocations[i], 1), true), MemoryOperationsStatus::SUCCESS);
+        }
+    }
+    EXPECT_EQ(mock->context.vmBindCalled, 6u);
+
+    operationHandler->evictUnusedAllocations(false, true, allocations[1]->getUnderlyingBufferSize(), 1u);
+    EXPECT_EQ(mock->context.vmUnbindCalled, 1u);
+    EXPECT_EQ(operationHandler->getEvictionStatistics().evictionRequests, 1u);
+    EXPECT_EQ(operationHandler->getEvictionStatistics().evictedAllocations, 1u);
+    EXPECT_EQ(operationHandler->getEvictionStatistics().evictedBytes, allocations[1]->getUnderlyingBufferSize());
+
+    // only the subdevice which failed to bind is walked
+    for (auto &engine : device->getAllEngines()) {
+        auto bo = static_cast<DrmAllocation *>(allocations[1])->getBO();
+        EXPECT_TRUE(bo->bindInfo[bo->getOsContextId(engine.osContext)][0u]);
+        EXPECT_FALSE(bo->bindInfo[bo->getOsContextId(engine.osContext)][1u]);
+    }
+    for (auto &allocation : {allocations[0], allocations[2]}) {
+        for (auto &engine : device->getAllEngines()) {
+            auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+            EXPECT_TRUE(bo->bindInfo[bo->getOsContextId(engine.osContext)][0u]);
+            EXPECT_TRUE(bo->bindInfo[bo->getOsContextId(engine.osContext)][1u]);
+        }
+    }
+
+    operationHandler->evictUnusedAllocations(false, true, 0u, 0u);
+    EXPECT_EQ(mock->context.vmUnbindCalled, 6u);
+    EXPECT_EQ(operationHandler->getEvictionStatistics().evictionRequests, 2u);
+
+    for (auto &allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, givenResidencyWithinOsContextFailsThenThenMergeWithResidencyContainertReturnsError) {
     struct MockDrmMemoryOperationsHandlerBindResidencyFail : public DrmMemoryOperationsHandlerBind {
         MockDrmMemoryOperationsHandlerBindResidencyFail(RootDeviceEnvironment &rootDeviceEnvironment, uint32_t rootDeviceIndex)
@@ -345,6 +345,168 @@ TEST_F(PageFaultManagerTest, givenHandlerRegisteredAndUntrackedPageFaultAddressW
     EXPECT_FALSE(retVal);
 }
 
+TEST_F(PageFaultManagerTest, givenManyTrackedAllocationsWhenVerifyingPageFaultAddressThenContainingAllocationIsFound) {
+    const size_t allocSize = 0x100;
+    for (uintptr_t i = 0; i < 1000; i++) {
+        pageFaultManager->insertAllocation(reinterpret_cast<void *>(0x10000 + i * 2 * allocSize), allocSize, unifiedMemoryManager.get(), nullptr, {});
+    }
+    EXPECT_EQ(1000u, pageFaultManager->memoryData.size());
+
+    void *allocPtr = reinterpret_cast<void *>(0x10000 + 500 * 2 * allocSize);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(allocPtr, allocSize - 1)));
+    EXPECT_EQ(allocPtr, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(allocSize, pageFaultManager->accessAllowedSize);
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(allocPtr, allocSize)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0xFFFF)));
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+}
+
+TEST_F(PageFaultManagerTest, whenPageFaultsAreVerifiedThenHandledAndUnresolvedFaultsAreCountedSeparatelyInStatistics) {
+    void *alloc = reinterpret_cast<void *>(0x1000);
+    pageFaultManager->insertAllocation(alloc, 10, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_EQ(0u, pageFaultManager->getStatistics().faultsCount);
+    EXPECT_EQ(0u, pageFaultManager->getStatistics().missesCount);
+
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 9));
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 10));
+
+    auto statistics = pageFaultManager->getStatistics();
+    EXPECT_EQ(2u, statistics.faultsCount);
+    EXPECT_EQ(1u, statistics.missesCount);
+    EXPECT_LE(statistics.maxFaultHandlingTimeNs, statistics.totalFaultHandlingTimeNs);
+}
+
+TEST_F(PageFaultManagerTest, givenPrintPageFaultStatisticsWhenPageFaultManagerIsDestroyedThenStatisticsArePrinted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.PrintPageFaultStatistics.set(true);
+
+    void *alloc = reinterpret_cast<void *>(0x1000);
+    pageFaultManager->insertAllocation(alloc, 10, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 10));
+
+    testing::internal::CaptureStderr();
+    pageFaultManager.reset();
+    auto output = testing::internal::GetCapturedStderr();
+
+    EXPECT_NE(std::string::npos, output.find("Page fault statistics: handled faults: 1, unresolved faults: 1,"));
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetWhenInsertingAllocationThenChunkDomainsAreTrackedOnlyForAllocationsLargerThanChunk) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSize.set(1);
+
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(alloc1, MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 2 * MemoryConstants::pageSize + 1, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_EQ(0u, pageFaultManager->memoryData[alloc1].chunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc1].chunkDomains.empty());
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->memoryData[alloc2].chunkSize);
+    ASSERT_EQ(3u, pageFaultManager->memoryData[alloc2].chunkDomains.size());
+    for (auto &chunkDomain : pageFaultManager->memoryData[alloc2].chunkDomains) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, chunkDomain);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetAndAubOrTbxHandlerWhenInsertingAllocationThenWholeAllocationIsMigrated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSize.set(MemoryConstants::pageSize);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    pageFaultManager->gpuDomainHandler = &MockPageFaultManager::handleGpuDomainTransferForAubAndTbx;
+    pageFaultManager->insertAllocation(alloc, 4 * MemoryConstants::pageSize, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].chunkDomains.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInGpuDomainWhenVerifyingPageFaultThenOnlyFaultedChunkIsTransferredToCpuDomain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSize.set(MemoryConstants::pageSize);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t size = 3 * MemoryConstants::pageSize + 16;
+    pageFaultManager->insertAllocation(alloc, size, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(size, pageFaultManager->transferToGpuSize);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, MemoryConstants::pageSize + 8)));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, MemoryConstants::pageSize), pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(ptrOffset(alloc, MemoryConstants::pageSize), pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, pageFaultManager->accessAllowedSize);
+    ASSERT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+    EXPECT_EQ(alloc, unifiedMemoryManager->nonGpuDomainAllocs[0]);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, size - 1)));
+    EXPECT_EQ(2, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, 3 * MemoryConstants::pageSize), pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(16u, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    auto &chunkDomains = pageFaultManager->memoryData[alloc].chunkDomains;
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, chunkDomains[0]);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, chunkDomains[1]);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, chunkDomains[2]);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, chunkDomains[3]);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationWithCpuChunksWhenMovingToGpuDomainThenOnlyCpuChunksAreTransferred) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSize.set(MemoryConstants::pageSize);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t size = 4 * MemoryConstants::pageSize;
+    pageFaultManager->insertAllocation(alloc, size, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, MemoryConstants::pageSize));
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * MemoryConstants::pageSize));
+    pageFaultManager->transferToGpuCalled = 0;
+    pageFaultManager->protectMemoryCalled = 0;
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, MemoryConstants::pageSize), pageFaultManager->transferToGpuAddress);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, pageFaultManager->transferToGpuSize);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(ptrOffset(alloc, MemoryConstants::pageSize), pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(0u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    for (auto &chunkDomain : pageFaultManager->memoryData[alloc].chunkDomains) {
+        EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, chunkDomain);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationWithGpuChunksWhenRemovingAllocationThenWholeAllocationIsAccessible) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSize.set(MemoryConstants::pageSize);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t size = 2 * MemoryConstants::pageSize;
+    pageFaultManager->insertAllocation(alloc, size, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->allowMemoryAccessCalled = 0;
+
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(alloc, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(size, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(0u, pageFaultManager->memoryData.size());
+}
+
 TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProperAllocIsTransferredToCpuDomain) {
     void *alloc1 = reinterpret_cast<void *>(0x1);
     void *alloc2 = reinterpret_cast<void *>(0x100);
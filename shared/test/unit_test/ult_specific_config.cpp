@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,8 +20,9 @@ bool CompressionSelector::preferCompressedAllocation(const AllocationProperties
 }
 void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
 }
-void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
+void PageFaultManager::transferToGpu(void *ptr, size_t size, void *cmdQ) {
 }
+bool PageFaultManager::chunkedMigrationApiSupport = true;
 CompilerCacheConfig getDefaultCompilerCacheConfig() { return {}; }
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) { return nullptr; }
 } // namespace NEO
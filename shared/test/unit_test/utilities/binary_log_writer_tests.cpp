@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/utilities/binary_log_writer.h"
+#include "shared/test/common/test_macros/test.h"
+#include "shared/test/common/utilities/logger_tests.h"
+
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::string decodeLogFile(const std::string &fileName) {
+    size_t size = 0;
+    auto data = loadDataFromFile(fileName.c_str(), size);
+    std::stringstream decoded;
+    EXPECT_TRUE(BinaryLogWriter::decode(data.get(), size, decoded));
+    return decoded.str();
+}
+
+struct WhiteBoxBinaryLogWriter : public BinaryLogWriter {
+    using BinaryLogWriter::BinaryLogWriter;
+    using BinaryLogWriter::drain;
+};
+
+size_t countOccurrences(const std::string &str, const std::string &pattern) {
+    size_t count = 0u;
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + pattern.size())) {
+        count++;
+    }
+    return count;
+}
+} // namespace
+
+TEST(BinaryLogWriterTest, givenLoggedRecordsWhenFlushedThenDecodedFileContainsAllRecords) {
+    std::string fileName = "binary_log_writer_test.bin";
+    {
+        BinaryLogWriter writer(fileName, false);
+        writer.logApiCall("clEnqueueNDRangeKernel", true, 0);
+        writer.logApiCall("clEnqueueNDRangeKernel", false, -5);
+        writer.logAllocation("BUFFER", "LocalMemory", 1u, 0x10000u, 0x1000u);
+        writer.logText("ThreadID 1 taskCount 7\n");
+        writer.flush();
+
+        auto decoded = decodeLogFile(fileName);
+        EXPECT_NE(std::string::npos, decoded.find("Function Enter: clEnqueueNDRangeKernel\n"));
+        EXPECT_NE(std::string::npos, decoded.find("Function Leave (-5): clEnqueueNDRangeKernel\n"));
+        EXPECT_NE(std::string::npos, decoded.find("AllocationType: BUFFER MemoryPool: LocalMemory Root device index: 1 GPU address: 0x10000 - 0x10fff\n"));
+        EXPECT_NE(std::string::npos, decoded.find("ThreadID 1 taskCount 7\n"));
+        EXPECT_EQ(0u, writer.getDroppedRecordsCount());
+    }
+    std::remove(fileName.c_str());
+}
+
+TEST(BinaryLogWriterTest, givenTextLoggedBetweenApiCallsWhenDecodingThenRecordsAreOrderedByTimestamp) {
+    std::string fileName = "binary_log_writer_test.bin";
+    {
+        BinaryLogWriter writer(fileName, false);
+        writer.logApiCall("clFinish", true, 0);
+        writer.logText("waiting for completion\n");
+        writer.logApiCall("clFinish", false, 0);
+        writer.flush();
+
+        auto decoded = decodeLogFile(fileName);
+        auto enterPos = decoded.find("Function Enter: clFinish");
+        auto textPos = decoded.find("waiting for completion");
+        auto leavePos = decoded.find("Function Leave (0): clFinish");
+        ASSERT_NE(std::string::npos, enterPos);
+        ASSERT_NE(std::string::npos, textPos);
+        ASSERT_NE(std::string::npos, leavePos);
+        EXPECT_LT(enterPos, textPos);
+        EXPECT_LT(textPos, leavePos);
+    }
+    std::remove(fileName.c_str());
+}
+
+TEST(BinaryLogWriterTest, givenNoNewRecordsWhenDrainingThenNothingIsWritten) {
+    std::string fileName = "binary_log_writer_test.bin";
+    {
+        WhiteBoxBinaryLogWriter writer(fileName, false);
+        EXPECT_FALSE(writer.drain());
+
+        writer.logApiCall("clFinish", true, 0);
+        EXPECT_TRUE(writer.drain());
+        EXPECT_FALSE(writer.drain());
+
+        writer.logText("text\n");
+        EXPECT_TRUE(writer.drain());
+        EXPECT_FALSE(writer.drain());
+    }
+    std::remove(fileName.c_str());
+}
+
+TEST(BinaryLogWriterTest, givenFullThreadBufferWhenLoggingThenRecordsAreDroppedAndReported) {
+    std::string fileName = "binary_log_writer_test.bin";
+    {
+        BinaryLogWriter writer(fileName, false);
+        for (size_t i = 0; i < BinaryLogWriter::threadBufferRecords + 10; i++) {
+            writer.logApiCall("zeCommandListAppendLaunchKernel", true, 0);
+        }
+        EXPECT_EQ(10u, writer.getDroppedRecordsCount());
+        writer.flush();
+
+        writer.logApiCall("zeCommandListAppendLaunchKernel", true, 0);
+        writer.flush();
+
+        auto decoded = decodeLogFile(fileName);
+        EXPECT_EQ(BinaryLogWriter::threadBufferRecords + 1, countOccurrences(decoded, "Function Enter: zeCommandListAppendLaunchKernel"));
+        EXPECT_EQ(1u, countOccurrences(decoded, "Dropped 10 log records\n"));
+    }
+    std::remove(fileName.c_str());
+}
+
+TEST(BinaryLogWriterTest, givenMultipleThreadsLoggingWhenWriterIsDestroyedThenAllRecordsAreWritten) {
+    std::string fileName = "binary_log_writer_test.bin";
+    constexpr size_t numThreads = 4u;
+    constexpr size_t recordsPerThread = 2 * BinaryLogWriter::threadBufferRecords;
+    uint64_t droppedRecords = 0u;
+    {
+        BinaryLogWriter writer(fileName, true);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < numThreads; i++) {
+            threads.emplace_back([&writer] {
+                for (size_t j = 0; j < recordsPerThread; j++) {
+                    writer.logApiCall("clFinish", (j % 2) == 0, 0);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        droppedRecords = writer.getDroppedRecordsCount();
+    }
+
+    auto decoded = decodeLogFile(fileName);
+    EXPECT_EQ(numThreads * recordsPerThread - droppedRecords, countOccurrences(decoded, ": clFinish\n"));
+    std::remove(fileName.c_str());
+}
+
+TEST(BinaryLogWriterTest, givenInvalidDataWhenDecodingThenFalseIsReturned) {
+    std::stringstream decoded;
+    EXPECT_FALSE(BinaryLogWriter::decode("NOTALOG!", 8, decoded));
+
+    const char truncated[] = {'N', 'E', 'O', 'B', 'L', 'O', 'G', '1', 2, 0, 0, 0, 32, 0, 0, 0};
+    EXPECT_FALSE(BinaryLogWriter::decode(truncated, sizeof(truncated), decoded));
+}
+
+TEST(BinaryLogWriterTest, givenLogBinaryFormatEnabledWhenFileLoggerLogsThenRecordsAreWrittenToBinaryFile) {
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    flags.LogBinaryFormat.set(true);
+    FullyEnabledFileLogger fileLogger(std::string("binary_logger_test.log"), flags);
+    ASSERT_NE(nullptr, fileLogger.binaryLogWriter);
+
+    fileLogger.logApiCall("searchString", true, 0);
+    fileLogger.log(true, "searchString2");
+    EXPECT_FALSE(fileLogger.wasFileCreated(fileLogger.getLogFileName()));
+
+    fileLogger.binaryLogWriter->flush();
+    auto decoded = decodeLogFile(fileLogger.getLogFileName());
+    EXPECT_NE(std::string::npos, decoded.find("Function Enter: searchString\n"));
+    EXPECT_NE(std::string::npos, decoded.find("searchString2"));
+}
+
+TEST(BinaryLogWriterTest, givenLogBinaryFormatDisabledWhenFileLoggerIsCreatedThenBinaryWriterIsNotCreated) {
+    DebugVariables flags;
+    flags.LogApiCalls.set(true);
+    FullyEnabledFileLogger fileLogger(std::string("binary_logger_test.log"), flags);
+    EXPECT_EQ(nullptr, fileLogger.binaryLogWriter);
+
+    flags.LogBinaryFormat.set(true);
+    FullyDisabledFileLogger disabledFileLogger(std::string("binary_logger_test.log"), flags);
+    EXPECT_EQ(nullptr, disabledFileLogger.binaryLogWriter);
+}
@@ -30,14 +30,14 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     size_t getThresholdSize() const { return this->sizeThreshold; }
     using HeapAllocator::defragment;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &vec, size_t requiredAlignment) {
+    uint64_t getFromFreedChunks(size_t size, FreedChunks &vec, size_t requiredAlignment) {
         size_t sizeOfFreedChunk;
         return HeapAllocator::getFromFreedChunks(size, vec, sizeOfFreedChunk, requiredAlignment);
     }
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedChunks &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
 
-    std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
-    std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    FreedChunks &getFreedChunksSmall() { return this->freedChunksSmall; };
+    FreedChunks &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
 };
@@ -78,10 +78,10 @@ TEST(HeapAllocatorTest, GivenExactSizeChunkInFreedChunksWhenGetIsCalledThenChunk
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrFreed = 0x101000llu;
     size_t sizeFreed = MemoryConstants::pageSize * 2;
-    freedChunks.emplace_back(ptrFreed, sizeFreed);
+    freedChunks.insert(ptrFreed, sizeFreed);
 
     auto ptrReturned = heapAllocator->getFromFreedChunks(sizeFreed, freedChunks, allocationAlignment);
 
@@ -94,15 +94,15 @@ TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledTh
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x101000llu, 4096);
-    freedChunks.emplace_back(0x105000llu, 4096);
-    freedChunks.emplace_back(0x104000llu, 4096);
-    freedChunks.emplace_back(0x102000llu, 8192);
-    freedChunks.emplace_back(0x109000llu, 8192);
-    freedChunks.emplace_back(0x107000llu, 4096);
+    freedChunks.insert(0x100000llu, 4096);
+    freedChunks.insert(0x101000llu, 4096);
+    freedChunks.insert(0x105000llu, 4096);
+    freedChunks.insert(0x104000llu, 4096);
+    freedChunks.insert(0x102000llu, 8192);
+    freedChunks.insert(0x109000llu, 8192);
+    freedChunks.insert(0x107000llu, 4096);
 
     EXPECT_EQ(7u, freedChunks.size());
 
@@ -119,21 +119,21 @@ TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
 
     pUpperBound -= 4096;
-    freedChunks.emplace_back(pUpperBound, 4096);
+    freedChunks.insert(pUpperBound, 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
+    freedChunks.insert(pUpperBound, 5 * 4096);
     pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
-    ptrExpected = pUpperBound;
+    freedChunks.insert(pUpperBound, 4 * 4096);
 
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
+    freedChunks.insert(pUpperBound, 5 * 4096);
     pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
+    freedChunks.insert(pUpperBound, 4 * 4096);
+    ptrExpected = pUpperBound; // equally sized chunks are taken from the lowest address
 
     EXPECT_EQ(5u, freedChunks.size());
 
@@ -150,15 +150,15 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 3 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 7 * 4096);
+    freedChunks.insert(pLowerBound, 7 * 4096);
 
     size_t deltaSize = 7 * 4096 - requestedSize;
     ptrExpected = pLowerBound + deltaSize;
@@ -170,8 +170,8 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
     EXPECT_EQ(ptrExpected, ptrReturned);
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(pLowerBound, freedChunks[2].ptr);
-    EXPECT_EQ(deltaSize, freedChunks[2].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find(pLowerBound));
+    EXPECT_EQ(deltaSize, freedChunks.find(pLowerBound)->second);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -181,18 +181,18 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
     pLowerBound += 9 * 4096;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find(ptrExpected));
+    EXPECT_EQ(expectedSize, freedChunks.find(ptrExpected)->second);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -205,8 +205,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find(ptrExpected));
+    EXPECT_EQ(expectedSize, freedChunks.find(ptrExpected)->second);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -216,11 +216,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
     pLowerBound += 4096; // space between stored chunk and chunk to store
 
@@ -228,11 +228,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
     size_t sizeToStore = 2 * 4096;
     pLowerBound += sizeToStore;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find(ptrExpected));
+    EXPECT_EQ(expectedSize, freedChunks.find(ptrExpected)->second);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -243,8 +243,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find(ptrExpected));
+    EXPECT_EQ(expectedSize, freedChunks.find(ptrExpected)->second);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
@@ -254,11 +254,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
 
     pLowerBound += 9 * 4096;
@@ -272,8 +272,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(ptrToStore, freedChunks[2].ptr);
-    EXPECT_EQ(sizeToStore, freedChunks[2].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find(ptrToStore));
+    EXPECT_EQ(sizeToStore, freedChunks.find(ptrToStore)->second);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCalledThenChunksAreMerged) {
@@ -281,10 +281,10 @@ TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCall
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x103000llu, 4096);
+    freedChunks.insert(0x100000llu, 4096);
+    freedChunks.insert(0x103000llu, 4096);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -767,7 +767,7 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksBig();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -794,21 +794,19 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0,1,2 - merged on free
+    // 6,7,8,10 - merged on free
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(basePtr, freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find(basePtr));
+    EXPECT_EQ(3 * allocSize, freedChunks.find(basePtr)->second);
 
-    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find((basePtr + 6 * allocSize)));
+    EXPECT_EQ(5 * allocSize, freedChunks.find((basePtr + 6 * allocSize))->second);
 }
 
 TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented) {
@@ -824,7 +822,7 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -851,21 +849,19 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0,1,2 - merged on free
+    // 6,7,8,10 - merged on free
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find((upperLimitPtr - 3 * allocSize)));
+    EXPECT_EQ(3 * allocSize, freedChunks.find((upperLimitPtr - 3 * allocSize))->second);
 
-    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    ASSERT_NE(freedChunks.end(), freedChunks.find((upperLimitPtr - 10 * allocSize)));
+    EXPECT_EQ(5 * allocSize, freedChunks.find((upperLimitPtr - 10 * allocSize))->second);
 }
 
 TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastChunkFreedReturnsWholeSpaceToFreeRange) {
@@ -875,7 +871,7 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastCh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -911,8 +907,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallSp
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -972,8 +968,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -1423,3 +1419,119 @@ TEST(HeapAllocatorTest, givenZeroAlignmentPassedWhenAllocatingMemoryWithCustomAl
     uint64_t ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, 0u);
     EXPECT_EQ(alignUp(heapBase, allocationAlignment), ptr);
 }
+
+TEST(HeapAllocatorTest, givenHeavilyFragmentedHeapWhenInterleavedAllocationsAndFreesArePerformedThenFreedChunksAreReusedAndCoalesced) {
+    const uint64_t heapBase = 0x100000000llu;
+    const uint64_t heapSize = 64 * MemoryConstants::gigaByte;
+    const size_t smallSize = MemoryConstants::pageSize;
+    const size_t bigSize = sizeThreshold + MemoryConstants::pageSize;
+    const size_t customAlignment = 16 * MemoryConstants::pageSize;
+    const uint32_t fragmentsCount = 64;
+    const uint32_t allocFreePairsCount = 1024;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold);
+
+    std::vector<std::pair<uint64_t, size_t>> fragments;
+    fragments.reserve(4 * fragmentsCount);
+    for (uint32_t i = 0; i < 2 * fragmentsCount; i++) {
+        size_t size = smallSize;
+        fragments.emplace_back(heapAllocator.allocate(size), size);
+        size = bigSize;
+        fragments.emplace_back(heapAllocator.allocate(size), size);
+    }
+    for (size_t i = 0; i < fragments.size(); i += 4) {
+        heapAllocator.free(fragments[i].first, fragments[i].second);
+        heapAllocator.free(fragments[i + 1].first, fragments[i + 1].second);
+        fragments[i].first = 0llu;
+        fragments[i + 1].first = 0llu;
+    }
+    EXPECT_EQ(fragmentsCount, heapAllocator.getFreedChunksSmall().size());
+    EXPECT_EQ(fragmentsCount, heapAllocator.getFreedChunksBig().size());
+    const auto usedSizeBefore = heapAllocator.getUsedSize();
+
+    // every allocation is a lookup in the freed chunks, some of them with custom alignment
+    std::ranlux24 generator(1);
+    std::vector<std::pair<uint64_t, size_t>> liveAllocations(64, {0llu, 0u});
+    for (uint32_t i = 0; i < allocFreePairsCount; i++) {
+        auto &slot = liveAllocations[i % liveAllocations.size()];
+        heapAllocator.free(slot.first, slot.second);
+
+        const auto random = generator();
+        slot.second = (random % 2) ? ((random >> 1) % 3 + 1) * smallSize : ((random >> 1) % 3 + 1) * bigSize;
+        if ((random >> 3) % 4 == 0) {
+            slot.first = heapAllocator.allocateWithCustomAlignment(slot.second, customAlignment);
+            ASSERT_TRUE(isAligned(slot.first, customAlignment));
+        } else {
+            slot.first = heapAllocator.allocate(slot.second);
+        }
+        ASSERT_NE(0llu, slot.first);
+    }
+    for (auto &slot : liveAllocations) {
+        heapAllocator.free(slot.first, slot.second);
+    }
+    EXPECT_EQ(usedSizeBefore, heapAllocator.getUsedSize());
+    EXPECT_EQ(fragmentsCount, heapAllocator.getFreedChunksSmall().size());
+    EXPECT_EQ(fragmentsCount, heapAllocator.getFreedChunksBig().size());
+
+    for (auto &fragment : fragments) {
+        heapAllocator.free(fragment.first, fragment.second);
+    }
+    EXPECT_EQ(0u, heapAllocator.getUsedSize());
+    EXPECT_EQ(0u, heapAllocator.getFreedChunksSmall().size());
+    EXPECT_EQ(0u, heapAllocator.getFreedChunksBig().size());
+    EXPECT_EQ(heapBase, heapAllocator.getLeftBound());
+    EXPECT_EQ(heapBase + heapSize, heapAllocator.getRightBound());
+}
+
+TEST(HeapAllocatorTest, givenFreedChunkLargerThanTwiceRequestedSizeWhenAllocatingWithCustomAlignmentThenAlignedHeadOfChunkIsReturned) {
+    const uint64_t heapBase = 0x100000000llu;
+    const size_t heapSize = 1024 * MemoryConstants::pageSize;
+    const size_t customAlignment = 4 * MemoryConstants::pageSize;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold);
+
+    auto chunkAddress = heapBase + 64 * MemoryConstants::pageSize;
+    heapAllocator.storeInFreedChunks(chunkAddress, 7 * MemoryConstants::pageSize, heapAllocator.getFreedChunksSmall());
+
+    size_t ptrSize = MemoryConstants::pageSize;
+    EXPECT_EQ(chunkAddress, heapAllocator.getFromFreedChunks(ptrSize, heapAllocator.getFreedChunksSmall(), customAlignment));
+    ASSERT_EQ(1u, heapAllocator.getFreedChunksSmall().size());
+    EXPECT_EQ(chunkAddress + MemoryConstants::pageSize, heapAllocator.getFreedChunksSmall().begin()->first);
+    EXPECT_EQ(6 * MemoryConstants::pageSize, heapAllocator.getFreedChunksSmall().begin()->second);
+
+    EXPECT_EQ(chunkAddress + 6 * MemoryConstants::pageSize, heapAllocator.getFromFreedChunks(ptrSize, heapAllocator.getFreedChunksSmall(), allocationAlignment));
+}
+
+TEST(HeapAllocatorTest, givenMisalignedFreedChunksWhenSearchingBestFitWithCustomAlignmentThenSmallestAlignedChunkIsReturned) {
+    const uint64_t base = 0x100000000llu;
+    const size_t chunkStride = 16 * MemoryConstants::pageSize;
+    const size_t size = 2 * MemoryConstants::pageSize;
+    FreedChunks freedChunks;
+
+    for (uint64_t i = 0; i < 16; i++) {
+        freedChunks.store(base + 2 * i * chunkStride + MemoryConstants::pageSize, size);
+    }
+    freedChunks.store(base + 64 * chunkStride, 4 * size);
+    freedChunks.store(base + 96 * chunkStride, 2 * size);
+    freedChunks.store(base + 128 * chunkStride, 2 * size);
+    EXPECT_EQ(19u, freedChunks.size());
+
+    auto chunk = freedChunks.findBestFit(size, MemoryConstants::pageSize);
+    ASSERT_NE(freedChunks.end(), chunk);
+    EXPECT_EQ(base + MemoryConstants::pageSize, chunk->first);
+
+    chunk = freedChunks.findBestFit(size, chunkStride);
+    ASSERT_NE(freedChunks.end(), chunk);
+    EXPECT_EQ(base + 96 * chunkStride, chunk->first);
+
+    chunk = freedChunks.findBestFit(3 * size, chunkStride);
+    ASSERT_NE(freedChunks.end(), chunk);
+    EXPECT_EQ(base + 64 * chunkStride, chunk->first);
+
+    const size_t bigAlignment = 8 * MemoryConstants::megaByte;
+    chunk = freedChunks.findBestFit(size, bigAlignment);
+    ASSERT_NE(freedChunks.end(), chunk);
+    EXPECT_EQ(base + 128 * chunkStride, chunk->first);
+
+    freedChunks.erase(chunk);
+    EXPECT_EQ(freedChunks.end(), freedChunks.findBestFit(size, bigAlignment));
+    EXPECT_EQ(freedChunks.end(), freedChunks.findBestFit(5 * size, chunkStride));
+}
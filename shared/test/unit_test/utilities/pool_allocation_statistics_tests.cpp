@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/pool_allocation_statistics.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(PoolAllocationStatisticsTest, givenStatisticsWhenGettingHitRateAndSavedAllocationsThenPoolsAreAccountedFor) {
+    PoolAllocationStatistics statistics;
+    EXPECT_EQ(0.0, statistics.getHitRate());
+    EXPECT_EQ(0u, statistics.getSavedAllocations());
+
+    statistics.allocationsFromPool = 3u;
+    statistics.allocationsNotFromPool = 1u;
+    statistics.poolsCreated = 1u;
+    EXPECT_EQ(75.0, statistics.getHitRate());
+    EXPECT_EQ(2u, statistics.getSavedAllocations());
+
+    statistics.poolsCreated = 4u;
+    EXPECT_EQ(0u, statistics.getSavedAllocations());
+}
+
+TEST(PoolAllocationStatisticsTest, givenPrintingEnabledWhenPrintingStatisticsThenOutputGoesToStderr) {
+    PoolAllocationStatistics statistics;
+    statistics.allocationsFromPool = 3u;
+    statistics.allocationsNotFromPool = 1u;
+    statistics.poolsCreated = 1u;
+    statistics.poolsReleased = 1u;
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    statistics.print(true, "Test pool", "chunks");
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+    std::string output = testing::internal::GetCapturedStderr();
+    EXPECT_STREQ("Test pool: chunks from pool: 3, chunks not from pool: 1, pool hit rate: 75.00%, pools created: 1, pools released: 1, saved graphics allocations: 2\n", output.c_str());
+}
+
+TEST(PoolAllocationStatisticsTest, givenPrintingDisabledWhenPrintingStatisticsThenNothingIsPrinted) {
+    PoolAllocationStatistics statistics;
+
+    testing::internal::CaptureStderr();
+    statistics.print(false, "Test pool", "chunks");
+    EXPECT_TRUE(testing::internal::GetCapturedStderr().empty());
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/utilities/trace_exporter.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_ostime.h"
+#include "shared/test/common/mocks/mock_timestamp_container.h"
+#include "shared/test/common/mocks/mock_timestamp_packet.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <cstdio>
+
+using namespace NEO;
+
+namespace {
+class ReferenceDeviceTime : public MockDeviceTime {
+  public:
+    ReferenceDeviceTime(const TimeStampData &reference) : reference(reference) {}
+
+    bool getCpuGpuTime(TimeStampData *pGpuCpuTime, OSTime *osTime) override {
+        *pGpuCpuTime = reference;
+        return true;
+    }
+
+    TimeStampData reference;
+};
+
+class ReferenceOSTime : public MockOSTime {
+  public:
+    ReferenceOSTime(const TimeStampData &reference) {
+        this->deviceTime = std::make_unique<ReferenceDeviceTime>(reference);
+    }
+};
+
+void setGlobalTimestamps(TagNodeBase *node, uint32_t packetIndex, uint32_t globalStart, uint32_t globalEnd) {
+    auto &packet = static_cast<TagNode<MockTimestampPackets32> *>(node)->tagForCpuAccess->packets[packetIndex];
+    packet.globalStart = globalStart;
+    packet.globalEnd = globalEnd;
+}
+} // namespace
+
+TEST(TraceExporterTest, givenHostSpansWhenSerializedThenChromeTraceEventsAreWritten) {
+    TraceExporter traceExporter("", MockOSTime::create());
+    traceExporter.addHostSpan("clFinish", "api", 1500u, 4500u);
+    traceExporter.addHostSpan("kernel \"a\\b\"", "submission", 2000000u, 2000001u);
+    EXPECT_EQ(2u, traceExporter.getSpansCount());
+
+    auto trace = traceExporter.serialize();
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"clFinish\",\"cat\":\"api\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.find("\"ts\":1.500,\"dur\":3.000}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"kernel \\\"a\\\\b\\\"\",\"cat\":\"submission\""));
+    EXPECT_NE(std::string::npos, trace.find("\"ts\":2000.000,\"dur\":0.001}"));
+    EXPECT_EQ(std::string::npos, trace.find("thread_name"));
+}
+
+TEST(TraceExporterTest, givenDefaultDebugFlagsWhenScopeIsUsedThenNothingIsTraced) {
+    EXPECT_EQ(nullptr, traceExporterInstance());
+    TraceExporterScope traceScope("clFinish", "api");
+}
+
+TEST(TraceExporterTest, givenNamedTimestampPacketsWhenAddedThenGpuSpansAreConvertedToCpuTimeOnce) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(executionEnvironment);
+    MockTagAllocator<MockTimestampPackets32> allocator(0, &memoryManager, 4);
+
+    TimeStampData reference = {100u, 1000000u};
+    ReferenceOSTime deviceOsTime(reference);
+    TraceExporter traceExporter("", MockOSTime::create());
+
+    MockTimestampPacketContainer namedPackets(allocator, 1);
+    namedPackets.getNode(0)->setPacketsUsed(2);
+    setGlobalTimestamps(namedPackets.getNode(0), 0, 50u, 75u);
+    setGlobalTimestamps(namedPackets.getNode(0), 1, 0xFFFFFF00u, 60u);
+    traceExporter.setTimestampPacketsName(namedPackets, "testKernel");
+
+    MockTimestampPacketContainer unnamedPackets(allocator, 1);
+    setGlobalTimestamps(unnamedPackets.getNode(0), 0, 50u, 75u);
+
+    traceExporter.addTimestampPackets(unnamedPackets, deviceOsTime, 2.0, 36u, 1u);
+    EXPECT_EQ(0u, traceExporter.getSpansCount());
+
+    traceExporter.addTimestampPackets(namedPackets, deviceOsTime, 2.0, 36u, 1u);
+    EXPECT_EQ(2u, traceExporter.getSpansCount());
+    traceExporter.addTimestampPackets(namedPackets, deviceOsTime, 2.0, 36u, 1u);
+    EXPECT_EQ(2u, traceExporter.getSpansCount());
+
+    auto trace = traceExporter.serialize();
+    auto gpuTrackId = std::to_string(TraceExporter::gpuTrackIdBase + 1);
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":" + gpuTrackId + ",\"args\":{\"name\":\"GPU 1\"}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"testKernel\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":"));
+    // 50 and 25 ticks before the reference, 2ns per tick
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":" + gpuTrackId + ",\"ts\":999.900,\"dur\":0.050}"));
+    // start recorded before the 32-bit wrap of the stored timestamp
+    EXPECT_NE(std::string::npos, trace.find("\"tid\":" + gpuTrackId + ",\"ts\":999.288,\"dur\":0.632}"));
+}
+
+TEST(TraceExporterTest, givenNotWrittenTimestampPacketsWhenAddedThenTheyAreSkipped) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(executionEnvironment);
+    MockTagAllocator<MockTimestampPackets32> allocator(0, &memoryManager, 1);
+
+    ReferenceOSTime deviceOsTime({100u, 1000000u});
+    TraceExporter traceExporter("", MockOSTime::create());
+
+    MockTimestampPacketContainer timestampPackets(allocator, 1);
+    traceExporter.setTimestampPacketsName(timestampPackets, "testKernel");
+    traceExporter.addTimestampPackets(timestampPackets, deviceOsTime, 2.0, 36u, 0u);
+    EXPECT_EQ(0u, traceExporter.getSpansCount());
+}
+
+TEST(TraceExporterTest, givenFileNameWhenExporterIsDestroyedThenTraceIsWrittenToFile) {
+    std::string fileName = "trace_exporter_test.json";
+    std::remove(fileName.c_str());
+    {
+        TraceExporter traceExporter(fileName, MockOSTime::create());
+        auto start = traceExporter.getCpuTimestamp();
+        traceExporter.addHostSpan("clFlush", "api", start, traceExporter.getCpuTimestamp());
+    }
+    ASSERT_TRUE(fileExistsHasSize(fileName));
+
+    size_t size = 0;
+    auto data = loadDataFromFile(fileName.c_str(), size);
+    std::string trace(data.get(), size);
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"clFlush\""));
+    EXPECT_EQ(0u, trace.compare(trace.size() - 4, 4, "\n]}\n"));
+    std::remove(fileName.c_str());
+}
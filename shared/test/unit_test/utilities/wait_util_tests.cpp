@@ -12,6 +12,8 @@
 
 #include "gtest/gtest.h"
 
+#include <limits>
+
 using namespace NEO;
 
 namespace CpuIntrinsicsTests {
@@ -90,3 +92,96 @@ TEST(WaitTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsCriteriaThenPaus
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+TEST(WaitTest, givenAdaptiveWaitPolicyDebugFlagWhenInitializingThenAdaptiveWaitIsEnabledOnlyWhenRequested) {
+    DebugManagerStateRestore restore;
+    VariableBackup<bool> backupAdaptiveWaitEnabled(&WaitUtils::adaptiveWaitEnabled);
+
+    WaitUtils::init();
+    EXPECT_FALSE(WaitUtils::adaptiveWaitEnabled);
+
+    DebugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+    WaitUtils::init();
+    EXPECT_TRUE(WaitUtils::adaptiveWaitEnabled);
+
+    DebugManager.flags.EnableAdaptiveWaitPolicy.set(0);
+    WaitUtils::init();
+    EXPECT_FALSE(WaitUtils::adaptiveWaitEnabled);
+}
+
+TEST(AdaptiveWaitPolicyTest, givenNoWaitHistoryWhenGettingPhaseThenMinimalSpinTimeIsUsedBeforeYieldAndSleep) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+
+    EXPECT_EQ(WaitUtils::WaitPhase::Spin, waitPolicy.getPhase(0u));
+    EXPECT_EQ(WaitUtils::WaitPhase::Yield, waitPolicy.getPhase(WaitUtils::AdaptiveWaitPolicy::minSpinTimeNs));
+    EXPECT_EQ(WaitUtils::WaitPhase::Sleep, waitPolicy.getPhase(WaitUtils::AdaptiveWaitPolicy::minYieldTimeNs));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenRecordedWaitsWhenGettingPhaseThenSpinAndYieldTimesFollowEstimatedLatency) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+
+    waitPolicy.recordWait(10'000u);
+    EXPECT_EQ(10'000u, waitPolicy.getEstimatedLatencyNs());
+    EXPECT_EQ(WaitUtils::WaitPhase::Spin, waitPolicy.getPhase(19'999u));
+    EXPECT_EQ(WaitUtils::WaitPhase::Yield, waitPolicy.getPhase(20'000u));
+    EXPECT_EQ(WaitUtils::WaitPhase::Sleep, waitPolicy.getPhase(WaitUtils::AdaptiveWaitPolicy::minYieldTimeNs));
+
+    waitPolicy.recordWait(570'000u);
+    EXPECT_EQ(80'000u, waitPolicy.getEstimatedLatencyNs());
+    EXPECT_EQ(2u, waitPolicy.getWaitsCount());
+    EXPECT_EQ(WaitUtils::WaitPhase::Spin, waitPolicy.getPhase(WaitUtils::AdaptiveWaitPolicy::maxSpinTimeNs - 1));
+    EXPECT_EQ(WaitUtils::WaitPhase::Yield, waitPolicy.getPhase(319'999u));
+    EXPECT_EQ(WaitUtils::WaitPhase::Sleep, waitPolicy.getPhase(320'000u));
+
+    waitPolicy.recordWait(100'000'000u);
+    EXPECT_EQ(WaitUtils::WaitPhase::Spin, waitPolicy.getPhase(WaitUtils::AdaptiveWaitPolicy::maxSpinTimeNs - 1));
+    EXPECT_EQ(WaitUtils::WaitPhase::Yield, waitPolicy.getPhase(WaitUtils::AdaptiveWaitPolicy::maxSpinTimeNs));
+    EXPECT_EQ(WaitUtils::WaitPhase::Sleep, waitPolicy.getPhase(WaitUtils::AdaptiveWaitPolicy::maxYieldTimeNs));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenWaitTimesWhenRecordingWaitsThenHistogramBucketsAreUpdated) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+
+    EXPECT_EQ(0u, WaitUtils::AdaptiveWaitPolicy::getHistogramBucketIndex(999u));
+    EXPECT_EQ(1u, WaitUtils::AdaptiveWaitPolicy::getHistogramBucketIndex(1'000u));
+    EXPECT_EQ(2u, WaitUtils::AdaptiveWaitPolicy::getHistogramBucketIndex(2'000u));
+    EXPECT_EQ(2u, WaitUtils::AdaptiveWaitPolicy::getHistogramBucketIndex(3'999u));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::histogramBucketsCount - 1, WaitUtils::AdaptiveWaitPolicy::getHistogramBucketIndex(std::numeric_limits<uint64_t>::max()));
+
+    waitPolicy.recordWait(500u);
+    waitPolicy.recordWait(3'000u);
+    waitPolicy.recordWait(3'500u);
+    EXPECT_EQ(1u, waitPolicy.getHistogramBucket(0u));
+    EXPECT_EQ(0u, waitPolicy.getHistogramBucket(1u));
+    EXPECT_EQ(2u, waitPolicy.getHistogramBucket(2u));
+
+    testing::internal::CaptureStderr();
+    waitPolicy.printStatistics("bcs");
+    std::string output = testing::internal::GetCapturedStderr();
+    EXPECT_NE(std::string::npos, output.find("Wait statistics for bcs: waits: 3"));
+    EXPECT_NE(std::string::npos, output.find("  < 1 us: 1\n"));
+    EXPECT_NE(std::string::npos, output.find("  < 4 us: 2\n"));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenSpinPhaseWhenWaitingThenPauseIsCalledBeforePolling) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    volatile uint32_t pollValue = 1u;
+
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    EXPECT_FALSE(waitPolicy.waitFunction(&pollValue, 2u, 0u));
+    EXPECT_EQ(oldCount + WaitUtils::AdaptiveWaitPolicy::spinPauseCount, CpuIntrinsicsTests::pauseCounter);
+
+    pollValue = 2u;
+    EXPECT_TRUE(waitPolicy.waitFunction(&pollValue, 2u, 0u));
+}
+
+TEST(AdaptiveWaitPolicyTest, givenYieldOrSleepPhaseWhenWaitingThenPauseIsNotCalled) {
+    WaitUtils::AdaptiveWaitPolicy waitPolicy;
+    volatile uint32_t pollValue = 1u;
+
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    EXPECT_FALSE(waitPolicy.waitFunction(&pollValue, 2u, WaitUtils::AdaptiveWaitPolicy::minSpinTimeNs));
+    EXPECT_FALSE(waitPolicy.waitFunction(&pollValue, 2u, WaitUtils::AdaptiveWaitPolicy::maxYieldTimeNs));
+    EXPECT_TRUE(waitPolicy.waitFunction(&pollValue, 1u, WaitUtils::AdaptiveWaitPolicy::maxYieldTimeNs));
+    EXPECT_EQ(oldCount, CpuIntrinsicsTests::pauseCounter);
+}